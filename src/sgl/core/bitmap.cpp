@@ -50,6 +50,7 @@ derivative works thereof, in binary and source code form.
 #include "sgl/core/macros.h"
 #include "sgl/core/error.h"
 #include "sgl/core/logger.h"
+#include "sgl/core/maths.h"
 #include "sgl/core/file_stream.h"
 #include "sgl/core/string.h"
 #include "sgl/core/thread.h"
@@ -94,11 +95,191 @@ derivative works thereof, in binary and source code form.
 #include <stb_image_write.h>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <queue>
 
 SGL_DISABLE_MSVC_WARNING(4611)
 
 namespace sgl {
 
+/**
+ * Receives decoded rows when reading an image in blocks.
+ *
+ * Readers supporting incremental decoding call \c begin once the header is known,
+ * decode blocks of rows into \c data() and pass them on using \c end_block.
+ * The sink crops the rows to the region of interest, optionally downsamples them
+ * (averaging in linear space) and passes the resulting block to the user callback.
+ */
+struct Bitmap::BlockSink {
+    const ReadBlockCallback& callback;
+    const ReadBlocksOptions& options;
+
+    /// Bitmap holding the image header.
+    const Bitmap* header{nullptr};
+    /// Region of the image to read.
+    Region region;
+    /// Number of image rows per block.
+    uint32_t block_rows{0};
+    /// Size of an image row in bytes.
+    size_t row_size{0};
+    /// Buffer for decoding a block of image rows.
+    std::unique_ptr<uint8_t[]> block_data;
+
+    uint32_t output_width{0};
+    ref<Struct> output_struct;
+    std::unique_ptr<uint8_t[]> output_data;
+
+    // Downsampling state.
+    ref<StructConverter> to_linear;
+    ref<StructConverter> from_linear;
+    std::vector<double> linear_row;
+    std::vector<double> box_sums;
+
+    BlockSink(const ReadBlockCallback& callback, const ReadBlocksOptions& options)
+        : callback(callback)
+        , options(options)
+    {
+    }
+
+    bool started() const { return header != nullptr; }
+
+    /// First image row to decode.
+    uint32_t row_begin() const { return region.y; }
+
+    /// Last image row (exclusive) to decode.
+    uint32_t row_end() const { return region.y + region.height; }
+
+    /// Buffer to decode the rows of a block into.
+    uint8_t* data()
+    {
+        if (!block_data)
+            block_data = std::make_unique<uint8_t[]>(block_rows * row_size);
+        return block_data.get();
+    }
+
+    /// Start reading blocks. Returns the number of rows per block.
+    /// \param granularity Number of rows the reader prefers blocks to be a multiple of (e.g. tile height).
+    uint32_t begin(const Bitmap* header_, uint32_t granularity)
+    {
+        header = header_;
+        region = header->get_region(options.region);
+        row_size = header->width() * header->bytes_per_pixel();
+
+        const uint32_t downsample = options.downsample;
+        block_rows = align_to(downsample, std::max(options.block_height, 1u));
+        if (granularity > 1)
+            block_rows = align_to(std::lcm(downsample, granularity), block_rows);
+        block_rows = std::min(block_rows, region.height);
+
+        output_width = div_round_up(region.width, downsample);
+        return block_rows;
+    }
+
+    /// Pass a block of decoded image rows starting at image row \c y.
+    void end_block(const uint8_t* rows, uint32_t y, uint32_t height)
+    {
+        SGL_ASSERT(y >= row_begin() && y + height <= row_end());
+
+        const Struct* pixel_struct = header->pixel_struct();
+        const size_t pixel_size = header->bytes_per_pixel();
+        const uint32_t downsample = options.downsample;
+
+        if (!output_struct)
+            output_struct = make_ref<Struct>(*pixel_struct);
+
+        // Rows can be passed on directly if no cropping or downsampling is needed.
+        if (downsample == 1 && region.x == 0 && region.width == header->width()) {
+            emit(const_cast<uint8_t*>(rows), y - region.y, height);
+            return;
+        }
+
+        if (!output_data)
+            output_data = std::make_unique<uint8_t[]>(
+                size_t(div_round_up(block_rows, downsample)) * output_width * pixel_size
+            );
+
+        if (downsample == 1) {
+            for (uint32_t i = 0; i < height; ++i)
+                std::memcpy(
+                    output_data.get() + i * region.width * pixel_size,
+                    rows + i * row_size + region.x * pixel_size,
+                    region.width * pixel_size
+                );
+            emit(output_data.get(), y - region.y, height);
+            return;
+        }
+
+        // Downsample by averaging boxes of pixels in linear space.
+        const size_t channel_count = pixel_struct->field_count();
+        if (!to_linear) {
+            ref<Struct> linear_struct = make_ref<Struct>();
+            for (const auto& field : *pixel_struct)
+                linear_struct->append(field.name, Struct::Type::float64);
+            to_linear = make_ref<StructConverter>(pixel_struct, linear_struct);
+            from_linear = make_ref<StructConverter>(linear_struct, pixel_struct);
+            linear_row.resize(region.width * channel_count);
+            box_sums.resize(output_width * channel_count, 0.0);
+        }
+
+        uint32_t output_rows = 0;
+        for (uint32_t i = 0; i < height; ++i) {
+            to_linear->convert(rows + i * row_size + region.x * pixel_size, linear_row.data(), region.width);
+            for (uint32_t x = 0; x < region.width; ++x)
+                for (size_t c = 0; c < channel_count; ++c)
+                    box_sums[(x / downsample) * channel_count + c] += linear_row[x * channel_count + c];
+
+            uint32_t region_y = y + i - region.y;
+            if ((region_y + 1) % downsample == 0 || y + i + 1 == row_end()) {
+                uint32_t box_height = region_y % downsample + 1;
+                for (uint32_t x = 0; x < output_width; ++x) {
+                    uint32_t box_width = std::min(downsample, region.width - x * downsample);
+                    double scale = 1.0 / (box_width * box_height);
+                    for (size_t c = 0; c < channel_count; ++c)
+                        box_sums[x * channel_count + c] *= scale;
+                }
+                from_linear->convert(
+                    box_sums.data(),
+                    output_data.get() + output_rows * output_width * pixel_size,
+                    output_width
+                );
+                std::fill(box_sums.begin(), box_sums.end(), 0.0);
+                output_rows++;
+            }
+        }
+        emit(output_data.get(), (y - region.y) / downsample, output_rows);
+    }
+
+    /// Pass an already decoded image in blocks.
+    void feed(const Bitmap* bitmap)
+    {
+        uint32_t rows = begin(bitmap, 1);
+        for (uint32_t y = row_begin(); y < row_end(); y += rows) {
+            uint32_t height = std::min(rows, row_end() - y);
+            end_block(bitmap->uint8_data() + y * row_size, y, height);
+        }
+    }
+
+private:
+    void emit(uint8_t* data, uint32_t y, uint32_t height)
+    {
+        ref<Bitmap> block = make_ref<Bitmap>(
+            header->pixel_format(),
+            header->component_type(),
+            output_width,
+            height,
+            header->channel_count(),
+            header->channel_names(),
+            data
+        );
+        block->m_pixel_struct = output_struct;
+        block->m_srgb_gamma = header->srgb_gamma();
+        callback(block, y);
+    }
+};
+
 Bitmap::Bitmap(
     PixelFormat pixel_format,
     ComponentType component_type,
@@ -165,6 +346,12 @@ Bitmap::Bitmap(const std::filesystem::path& path, FileFormat format)
     read(&stream, format);
 }
 
+Bitmap::Bitmap(Stream* stream, FileFormat format, BlockSink* sink)
+    : m_owns_data(true)
+{
+    read(stream, format, sink);
+}
+
 Bitmap::~Bitmap()
 {
     if (!m_owns_data)
@@ -190,6 +377,31 @@ std::vector<ref<Bitmap>> Bitmap::read_multiple(std::span<std::filesystem::path>
     return bitmaps;
 }
 
+Bitmap::ReadBlocksOptions::ReadBlocksOptions() { }
+
+void Bitmap::read_blocks(Stream* stream, const ReadBlockCallback& callback, const ReadBlocksOptions& options)
+{
+    SGL_CHECK_NOT_NULL(stream);
+    SGL_CHECK_GT(options.downsample, 0u);
+
+    BlockSink sink(callback, options);
+    ref<Bitmap> bitmap(new Bitmap(stream, options.format, &sink));
+
+    // Formats that cannot be decoded incrementally are decoded in full.
+    if (!sink.started())
+        sink.feed(bitmap);
+}
+
+void Bitmap::read_blocks(
+    const std::filesystem::path& path,
+    const ReadBlockCallback& callback,
+    const ReadBlocksOptions& options
+)
+{
+    FileStream stream(path, FileStream::Mode::read);
+    read_blocks(&stream, callback, options);
+}
+
 void Bitmap::write(Stream* stream, FileFormat format, int quality) const
 {
     SGL_UNUSED(quality);
@@ -401,7 +613,7 @@ std::vector<std::pair<std::string, ref<Bitmap>>> Bitmap::split() const
         }
 
         StructConverter converter(m_pixel_struct, target_struct);
-        converter.convert(data(), target->data(), pixel_count());
+        converter.convert_parallel(data(), target->data(), pixel_count());
 
         result.push_back({prefix, target});
         it = range.second;
@@ -436,11 +648,100 @@ void Bitmap::convert(Bitmap* target) const
             target->height()
         );
 
+    ref<Struct> dst_struct = conversion_struct(target->pixel_struct());
+    ref<StructConverter> converter = make_ref<StructConverter>(pixel_struct(), dst_struct);
+    converter->convert_parallel(data(), target->data(), pixel_count());
+}
+
+Bitmap::TransformOptions::TransformOptions() { }
+
+void Bitmap::transform(void* dst, size_t dst_size, const Struct* dst_struct, const TransformOptions& options) const
+{
+    SGL_CHECK_NOT_NULL(dst_struct);
+
+    const Region region = get_region(options.region);
+    const size_t row_pitch = transform_row_pitch(dst_struct, options);
+    const size_t required_size = transform_size(dst_struct, options);
+    SGL_CHECK(
+        dst_size >= required_size,
+        "Destination buffer is too small ({} bytes, {} bytes required).",
+        dst_size,
+        required_size
+    );
+    if (required_size == 0)
+        return;
+    SGL_CHECK_NOT_NULL(dst);
+
+    ref<Struct> conversion_dst_struct = conversion_struct(dst_struct);
+    ref<StructConverter> converter = make_ref<StructConverter>(pixel_struct(), conversion_dst_struct);
+
+    const size_t src_pixel_size = bytes_per_pixel();
+    const size_t src_row_pitch = static_cast<size_t>(m_width) * src_pixel_size;
+    const uint8_t* src_data = uint8_data() + region.y * src_row_pitch + region.x * src_pixel_size;
+
+    // Flipping starts at the last source row and walks the rows bottom-up.
+    ptrdiff_t src_step = static_cast<ptrdiff_t>(src_row_pitch);
+    if (options.flip_y) {
+        src_data += (region.height - 1) * src_row_pitch;
+        src_step = -src_step;
+    }
+
+    converter->convert_rows(src_data, src_step, dst, static_cast<ptrdiff_t>(row_pitch), region.width, region.height);
+}
+
+size_t Bitmap::transform_row_pitch(const Struct* dst_struct, const TransformOptions& options) const
+{
+    SGL_CHECK_NOT_NULL(dst_struct);
+    const Region region = get_region(options.region);
+    const size_t row_size = region.width * dst_struct->size();
+    if (options.row_pitch != 0) {
+        SGL_CHECK(
+            options.row_pitch >= row_size,
+            "Row pitch ({} bytes) is smaller than the row size ({} bytes).",
+            options.row_pitch,
+            row_size
+        );
+        return options.row_pitch;
+    }
+    SGL_CHECK_GT(options.row_alignment, 0);
+    return align_to(options.row_alignment, row_size);
+}
+
+size_t Bitmap::transform_size(const Struct* dst_struct, const TransformOptions& options) const
+{
+    const Region region = get_region(options.region);
+    if (region.width == 0 || region.height == 0)
+        return 0;
+    // The last row does not need to be padded to the full row pitch.
+    return (region.height - 1) * transform_row_pitch(dst_struct, options) + region.width * dst_struct->size();
+}
+
+Bitmap::Region Bitmap::get_region(const std::optional<Region>& region_) const
+{
+    if (!region_)
+        return Region{.x = 0, .y = 0, .width = m_width, .height = m_height};
+
+    const Region& region = *region_;
+    SGL_CHECK(
+        uint64_t(region.x) + region.width <= m_width && uint64_t(region.y) + region.height <= m_height,
+        "Region (x={}, y={}, width={}, height={}) exceeds bitmap dimensions ({}x{}).",
+        region.x,
+        region.y,
+        region.width,
+        region.height,
+        m_width,
+        m_height
+    );
+    return region;
+}
+
+ref<Struct> Bitmap::conversion_struct(const Struct* target) const
+{
     bool src_is_rgb = m_pixel_format == PixelFormat::rgb || m_pixel_format == PixelFormat::rgba;
     bool src_is_y = m_pixel_format == PixelFormat::y || m_pixel_format == PixelFormat::ya;
 
     const Struct* src_struct = pixel_struct();
-    ref<Struct> dst_struct = make_ref<Struct>(*target->pixel_struct());
+    ref<Struct> dst_struct = make_ref<Struct>(*target);
 
     for (Struct::Field& field : *dst_struct) {
         if (src_struct->has_field(field.name)) {
@@ -481,8 +782,7 @@ void Bitmap::convert(Bitmap* target) const
         SGL_THROW("Unable to convert bitmap: cannot determine how to derive field \"{}\" in target image!", field.name);
     }
 
-    ref<StructConverter> converter = make_ref<StructConverter>(src_struct, dst_struct);
-    converter->convert(data(), target->data(), pixel_count());
+    return dst_struct;
 }
 
 bool Bitmap::operator==(const Bitmap& other) const
@@ -559,12 +859,124 @@ Bitmap::FileFormat Bitmap::detect_file_format(Stream* stream)
     return format;
 }
 
+#if SGL_HAS_OPENEXR
+
+/**
+ * OpenEXR thread pool provider running line buffer and tile tasks on the global thread pool.
+ *
+ * At most \c numThreads() tasks are executed concurrently. OpenEXR blocks the thread that added
+ * a group of tasks until all of them are done. If that thread is itself a worker of the global
+ * thread pool (e.g. when reading multiple images with \c Bitmap::read_multiple), the tasks are
+ * executed in place instead. This avoids deadlocks when all workers are blocked, and images are
+ * decoded in parallel rather than their individual lines.
+ */
+class EXRThreadPoolProvider : public IlmThread::ThreadPoolProvider {
+public:
+    EXRThreadPoolProvider(int thread_count)
+        : m_thread_count(thread_count)
+    {
+    }
+
+    ~EXRThreadPoolProvider() override { finish(); }
+
+    int numThreads() const override { return m_thread_count; }
+
+    void setNumThreads(int count) override
+    {
+        finish();
+        m_thread_count = count;
+    }
+
+    void addTask(IlmThread::Task* task) override
+    {
+        if (m_thread_count == 0 || thread::is_worker_thread()) {
+            run(task);
+            return;
+        }
+
+        bool spawn_worker = false;
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push(task);
+            if (m_worker_count < m_thread_count) {
+                m_worker_count++;
+                spawn_worker = true;
+            }
+        }
+        if (spawn_worker)
+            thread::global_thread_pool().push_task([this]() { work(); });
+    }
+
+    void finish() override
+    {
+        std::unique_lock lock(m_mutex);
+        m_idle.wait(lock, [this]() { return m_tasks.empty() && m_worker_count == 0; });
+    }
+
+private:
+    static void run(IlmThread::Task* task)
+    {
+        task->execute();
+        delete task;
+    }
+
+    /// Process queued tasks until the queue is empty.
+    void work()
+    {
+        std::unique_lock lock(m_mutex);
+        while (!m_tasks.empty()) {
+            IlmThread::Task* task = m_tasks.front();
+            m_tasks.pop();
+            lock.unlock();
+            run(task);
+            lock.lock();
+        }
+        if (--m_worker_count == 0)
+            m_idle.notify_all();
+    }
+
+    std::atomic<int> m_thread_count;
+    std::mutex m_mutex;
+    std::condition_variable m_idle;
+    std::queue<IlmThread::Task*> m_tasks;
+    int m_worker_count{0};
+};
+
+#endif // SGL_HAS_OPENEXR
+
+void Bitmap::set_exr_thread_count(uint32_t count)
+{
+#if SGL_HAS_OPENEXR
+    IlmThread::ThreadPool::globalThreadPool().setNumThreads(static_cast<int>(count));
+#else
+    SGL_UNUSED(count);
+#endif
+}
+
+uint32_t Bitmap::exr_thread_count()
+{
+#if SGL_HAS_OPENEXR
+    return static_cast<uint32_t>(IlmThread::ThreadPool::globalThreadPool().numThreads());
+#else
+    return 0;
+#endif
+}
+
 void Bitmap::static_init()
 {
-    // IlmThread::ThreadPool::globalThreadPool().setThreadProvider(new EXRThreadPool());
+#if SGL_HAS_OPENEXR
+    // The thread pool takes ownership of the provider.
+    IlmThread::ThreadPool::globalThreadPool().setThreadProvider(
+        new EXRThreadPoolProvider(static_cast<int>(thread::global_thread_pool().get_thread_count()))
+    );
+#endif
 }
 
-void Bitmap::static_shutdown() { }
+void Bitmap::static_shutdown()
+{
+    // Wait for pending tasks and execute any further tasks in place, as the global thread pool is shut down next.
+    set_exr_thread_count(0);
+}
 
 void Bitmap::rebuild_pixel_struct(uint32_t channel_count, const std::vector<std::string>& channel_names)
 {
@@ -616,7 +1028,7 @@ void Bitmap::rebuild_pixel_struct(uint32_t channel_count, const std::vector<std:
     }
 }
 
-void Bitmap::read(Stream* stream, FileFormat format)
+void Bitmap::read(Stream* stream, FileFormat format, BlockSink* sink)
 {
     if (format == FileFormat::auto_)
         format = detect_file_format(stream);
@@ -624,7 +1036,7 @@ void Bitmap::read(Stream* stream, FileFormat format)
     switch (format) {
     case FileFormat::png:
 #if SGL_HAS_PNG
-        read_png(stream);
+        read_png(stream, sink);
 #else
         SGL_THROW("PNG support is not available!");
 #endif
@@ -647,7 +1059,7 @@ void Bitmap::read(Stream* stream, FileFormat format)
         break;
     case FileFormat::exr:
 #if SGL_HAS_OPENEXR
-        read_exr(stream);
+        read_exr(stream, sink);
 #else
         SGL_THROW("OpenEXR support is not available!");
 #endif
@@ -719,7 +1131,7 @@ static void png_warn_func(png_structp, png_const_charp msg)
     log_warn("libpng warning: {}\n", msg);
 }
 
-void Bitmap::read_png(Stream* stream)
+void Bitmap::read_png(Stream* stream, BlockSink* sink)
 {
     // Create buffers.
     png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, &png_error_func, &png_warn_func);
@@ -848,6 +1260,33 @@ void Bitmap::read_png(Stream* stream)
         m_component_type
     );
 
+    // Decode non-interlaced images in blocks into the buffer of the sink.
+    // Interlaced images are decoded in full and passed to the sink afterwards.
+    if (sink && interlace_type == PNG_INTERLACE_NONE) {
+        try {
+            size_t row_bytes = png_get_rowbytes(png_ptr, info_ptr);
+            SGL_ASSERT(row_bytes == m_width * bytes_per_pixel());
+
+            uint32_t block_rows = sink->begin(this, 1);
+
+            // Rows before the region still need to be decoded.
+            for (uint32_t y = 0; y < sink->row_begin(); ++y)
+                png_read_row(png_ptr, sink->data(), nullptr);
+
+            for (uint32_t y = sink->row_begin(); y < sink->row_end(); y += block_rows) {
+                uint32_t rows = std::min(block_rows, sink->row_end() - y);
+                for (uint32_t i = 0; i < rows; ++i)
+                    png_read_row(png_ptr, sink->data() + i * row_bytes, nullptr);
+                sink->end_block(sink->data(), y, rows);
+            }
+        } catch (...) {
+            png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+            throw;
+        }
+        png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+        return;
+    }
+
     size_t size = buffer_size();
     m_data = std::unique_ptr<uint8_t[]>(new uint8_t[size]);
     m_owns_data = true;
@@ -1484,7 +1923,7 @@ private:
     Stream* m_stream;
 };
 
-void Bitmap::read_exr(Stream* stream)
+void Bitmap::read_exr(Stream* stream, BlockSink* sink)
 {
     EXRIStream is(stream);
     Imf::InputFile file(is);
@@ -1674,16 +2113,26 @@ void Bitmap::read_exr(Stream* stream)
     size_t pixel_count = this->pixel_count();
     size_t row_stride = pixel_stride * m_width;
 
-    m_data = std::unique_ptr<uint8_t[]>(new uint8_t[row_stride * m_height]);
-    m_owns_data = true;
+    // When reading in blocks, rows are decoded into the block buffer of the sink.
+    uint32_t block_rows = 0;
+    uint8_t* ptr = nullptr;
+    if (sink) {
+        uint32_t granularity = header.hasTileDescription() ? header.tileDescription().ySize : 1;
+        block_rows = sink->begin(this, granularity);
+        ptr = sink->data()
+            - (data_window.min.x + (data_window.min.y + ptrdiff_t(sink->row_begin())) * ptrdiff_t(m_width))
+                * ptrdiff_t(pixel_stride);
+    } else {
+        m_data = std::unique_ptr<uint8_t[]>(new uint8_t[row_stride * m_height]);
+        m_owns_data = true;
+        ptr = m_data.get() - (data_window.min.x + data_window.min.y * m_width) * pixel_stride;
+    }
 
 #if 0
     using ResampleBuffer = std::pair<std::string, ref<Bitmap>>;
     std::vector<ResampleBuffer> resample_buffers;
 #endif
 
-    uint8_t* ptr = m_data.get() - (data_window.min.x + data_window.min.y * m_width) * pixel_stride;
-
     // Tell OpenEXR where the image data should be put.
     Imf::FrameBuffer framebuffer;
     for (const auto& field : *m_pixel_struct) {
@@ -1732,45 +2181,15 @@ void Bitmap::read_exr(Stream* stream)
         m_component_type
     );
 
-    file.setFrameBuffer(framebuffer);
-    file.readPixels(data_window.min.y, data_window.max.y);
-
-#if 0
-    for (auto& buf : resample_buffers) {
-        Log(Debug,
-            "Upsampling layer \"%s\" from %ix%i to %ix%i pixels",
-            buf.first,
-            buf.second->width(),
-            buf.second->height(),
-            m_size.x(),
-            m_size.y());
-
-        buf.second = buf.second->resample(m_size);
-        const Struct::Field& field = m_struct->field(buf.first);
-
-        size_t comp_size = field.size;
-        uint8_t* dst = uint8_data() + field.offset;
-        uint8_t* src = buf.second->uint8_data();
-
-        for (size_t j = 0; j < pixel_count; ++j) {
-            std::memcpy(dst, src, comp_size);
-            src += comp_size;
-            dst += pixel_stride;
-        }
-
-        buf.second = nullptr;
-    }
-#endif
-
-    if (luminance_chroma_format) {
-        log_debug("Converting from Luminance-Chroma to RGB format ...");
-        Imath::V3f yw = Imf::RgbaYca::computeYw(file_chroma);
-
+    // Convert from luminance-chroma to RGB in place.
+    Imath::V3f yw = Imf::RgbaYca::computeYw(file_chroma);
+    auto convert_luminance_chroma = [&](uint8_t* data, size_t count)
+    {
         auto convert = [&](auto* data)
         {
             using T = std::decay_t<decltype(*data)>;
 
-            for (size_t j = 0; j < pixel_count; ++j) {
+            for (size_t j = 0; j < count; ++j) {
                 double y = double(data[0]);
                 double ry = double(data[1]);
                 double by = double(data[2]);
@@ -1793,32 +2212,86 @@ void Bitmap::read_exr(Stream* stream)
                     b = b * scale + .5f;
                 }
 
-                data[0] = T(R);
-                data[1] = T(G);
-                data[2] = T(B);
+                data[0] = T(r);
+                data[1] = T(g);
+                data[2] = T(b);
                 data += channel_count();
             }
         };
 
         switch (m_component_type) {
         case ComponentType::float16:
-            convert(reinterpret_cast<math::float16_t*>(m_data.get()));
+            convert(reinterpret_cast<math::float16_t*>(data));
             break;
         case ComponentType::float32:
-            convert(reinterpret_cast<float*>(m_data.get()));
+            convert(reinterpret_cast<float*>(data));
             break;
         case ComponentType::uint32:
-            convert(reinterpret_cast<uint32_t*>(m_data.get()));
+            convert(reinterpret_cast<uint32_t*>(data));
             break;
         default:
             SGL_THROW("Internal error!");
         }
+    };
 
+    if (luminance_chroma_format) {
+        log_debug("Converting from Luminance-Chroma to RGB format ...");
         set_suffix(m_pixel_struct->operator[](0).name, "R");
         set_suffix(m_pixel_struct->operator[](1).name, "G");
         set_suffix(m_pixel_struct->operator[](2).name, "B");
     }
 
+    file.setFrameBuffer(framebuffer);
+
+    if (sink) {
+        for (uint32_t y = sink->row_begin(); y < sink->row_end(); y += block_rows) {
+            uint32_t rows = std::min(block_rows, sink->row_end() - y);
+            if (y != sink->row_begin()) {
+                // Move the slices to decode the next block into the start of the block buffer.
+                for (auto it = framebuffer.begin(); it != framebuffer.end(); ++it)
+                    it.slice().base -= ptrdiff_t(block_rows) * ptrdiff_t(row_stride);
+                file.setFrameBuffer(framebuffer);
+            }
+            file.readPixels(data_window.min.y + int(y), data_window.min.y + int(y + rows) - 1);
+            if (luminance_chroma_format)
+                convert_luminance_chroma(sink->data(), size_t(rows) * m_width);
+            sink->end_block(sink->data(), y, rows);
+        }
+        return;
+    }
+
+    file.readPixels(data_window.min.y, data_window.max.y);
+
+    if (luminance_chroma_format)
+        convert_luminance_chroma(m_data.get(), pixel_count);
+
+#if 0
+    for (auto& buf : resample_buffers) {
+        Log(Debug,
+            "Upsampling layer \"%s\" from %ix%i to %ix%i pixels",
+            buf.first,
+            buf.second->width(),
+            buf.second->height(),
+            m_size.x(),
+            m_size.y());
+
+        buf.second = buf.second->resample(m_size);
+        const Struct::Field& field = m_struct->field(buf.first);
+
+        size_t comp_size = field.size;
+        uint8_t* dst = uint8_data() + field.offset;
+        uint8_t* src = buf.second->uint8_data();
+
+        for (size_t j = 0; j < pixel_count; ++j) {
+            std::memcpy(dst, src, comp_size);
+            src += comp_size;
+            dst += pixel_stride;
+        }
+
+        buf.second = nullptr;
+    }
+#endif
+
 #if 0
     if (Imf::hasChromaticities(file.header())
         && (m_pixel_format == PixelFormat::RGB || m_pixel_format == PixelFormat::RGBA)) {
@@ -53,8 +53,10 @@ derivative works thereof, in binary and source code form.
 #include "sgl/core/struct.h"
 
 #include <filesystem>
+#include <functional>
 #include <future>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -123,6 +125,28 @@ public:
 
     using ComponentType = Struct::Type;
 
+    /// Rectangular region of a bitmap in pixels.
+    struct Region {
+        uint32_t x{0};
+        uint32_t y{0};
+        uint32_t width{0};
+        uint32_t height{0};
+    };
+
+    /// Options for \c Bitmap::transform.
+    struct SGL_API TransformOptions {
+        /// Flip the rows vertically while converting.
+        bool flip_y{false};
+        /// Row pitch of the destination in bytes (0 to use tightly packed rows aligned to \c row_alignment).
+        size_t row_pitch{0};
+        /// Row alignment of the destination in bytes (only used if \c row_pitch is 0).
+        size_t row_alignment{1};
+        /// Region of the bitmap to convert (converts the full bitmap if not set).
+        std::optional<Region> region;
+
+        TransformOptions();
+    };
+
     Bitmap(
         PixelFormat pixel_format,
         ComponentType component_type,
@@ -150,6 +174,46 @@ public:
     static std::vector<ref<Bitmap>>
     read_multiple(std::span<std::filesystem::path> paths, FileFormat format = FileFormat::auto_);
 
+    /// Options for \c Bitmap::read_blocks.
+    struct SGL_API ReadBlocksOptions {
+        /// File format (detected automatically by default).
+        FileFormat format{FileFormat::auto_};
+        /// Number of image rows decoded per block (rounded up to a multiple of \c downsample and the tile height).
+        uint32_t block_height{64};
+        /// Downsampling factor. Each output pixel is the average of a box of \c downsample x \c downsample pixels.
+        uint32_t downsample{1};
+        /// Region of the image to read in image pixels (reads the full image if not set).
+        std::optional<Region> region;
+
+        ReadBlocksOptions();
+    };
+
+    /// Callback receiving a block of rows from \c Bitmap::read_blocks.
+    /// The block bitmap is only valid during the call. \c y is the index of the first row in the output image.
+    using ReadBlockCallback = std::function<void(const Bitmap* block, uint32_t y)>;
+
+    /**
+     * \brief Read an image in blocks of rows using bounded memory.
+     *
+     * PNG (non-interlaced) and OpenEXR (scanline and tiled) images are decoded incrementally,
+     * only keeping a single block of rows in memory. Other formats are decoded in full and
+     * then passed to the callback in blocks. Decoding can be overlapped with processing and
+     * upload by handing the blocks to other threads from within the callback.
+     *
+     * \param stream Stream to read from.
+     * \param callback Callback receiving the blocks of rows in order.
+     * \param options Read options.
+     */
+    static void
+    read_blocks(Stream* stream, const ReadBlockCallback& callback, const ReadBlocksOptions& options = {});
+
+    /// Read an image file in blocks of rows using bounded memory. See \c read_blocks.
+    static void read_blocks(
+        const std::filesystem::path& path,
+        const ReadBlockCallback& callback,
+        const ReadBlocksOptions& options = {}
+    );
+
     void write(Stream* stream, FileFormat format = FileFormat::auto_, int quality = -1) const;
     void write(const std::filesystem::path& path, FileFormat format = FileFormat::auto_, int quality = -1) const;
 
@@ -242,6 +306,27 @@ public:
 
     void convert(Bitmap* target) const;
 
+    /**
+     * \brief Convert the bitmap into a destination buffer in a single pass.
+     *
+     * Pixels are converted to the layout described by \c dst_struct and written row by row
+     * directly into \c dst (e.g. a mapped upload buffer). Vertical flipping, destination row pitch
+     * and the region of interest are applied during the conversion, avoiding intermediate copies.
+     * Missing channels are derived in the same way as in \c convert.
+     *
+     * \param dst Destination buffer.
+     * \param dst_size Size of the destination buffer in bytes.
+     * \param dst_struct Struct describing the destination pixel layout.
+     * \param options Transform options.
+     */
+    void transform(void* dst, size_t dst_size, const Struct* dst_struct, const TransformOptions& options = {}) const;
+
+    /// Row pitch in bytes of the destination buffer written by \c transform.
+    size_t transform_row_pitch(const Struct* dst_struct, const TransformOptions& options = {}) const;
+
+    /// Size in bytes of the destination buffer required by \c transform.
+    size_t transform_size(const Struct* dst_struct, const TransformOptions& options = {}) const;
+
     /// Equality operator.
     bool operator==(const Bitmap& other) const;
 
@@ -252,13 +337,37 @@ public:
 
     static FileFormat detect_file_format(Stream* stream);
 
+    /**
+     * \brief Set the maximum number of threads used for encoding/decoding a single OpenEXR image.
+     *
+     * OpenEXR line buffer and tile tasks run on the global thread pool. A count of zero disables
+     * multi-threaded encoding/decoding. Defaults to the number of threads of the global thread pool.
+     * Images read from within tasks on the global thread pool (e.g. by \c read_multiple) are always
+     * decoded on a single thread, as they are already processed in parallel.
+     */
+    static void set_exr_thread_count(uint32_t count);
+
+    /// The maximum number of threads used for encoding/decoding a single OpenEXR image.
+    static uint32_t exr_thread_count();
+
     static void static_init();
     static void static_shutdown();
 
 private:
+    /// Receives decoded rows when reading an image in blocks (see \c read_blocks).
+    struct BlockSink;
+
+    Bitmap(Stream* stream, FileFormat format, BlockSink* sink);
+
     void rebuild_pixel_struct(uint32_t channel_count = 0, const std::vector<std::string>& channel_names = {});
 
-    void read(Stream* stream, FileFormat format);
+    /// Derive the struct used to convert pixels of this bitmap to the \c target pixel layout.
+    ref<Struct> conversion_struct(const Struct* target) const;
+
+    /// Validate a region of the bitmap (returns the full bitmap if none is specified).
+    Region get_region(const std::optional<Region>& region) const;
+
+    void read(Stream* stream, FileFormat format, BlockSink* sink = nullptr);
 
     void check_required_format(
         std::string_view file_format,
@@ -266,7 +375,7 @@ private:
         std::vector<Bitmap::ComponentType> allowed_component_types
     ) const;
 
-    void read_png(Stream* stream);
+    void read_png(Stream* stream, BlockSink* sink = nullptr);
     void write_png(Stream* stream, int compression) const;
 
     void read_jpg(Stream* stream);
@@ -281,7 +390,7 @@ private:
     void read_hdr(Stream* stream);
     void write_hdr(Stream* stream) const;
 
-    void read_exr(Stream* stream);
+    void read_exr(Stream* stream, BlockSink* sink = nullptr);
     void write_exr(Stream* stream, int quality) const;
 
     PixelFormat m_pixel_format;
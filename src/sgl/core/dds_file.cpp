@@ -621,26 +621,44 @@ using namespace detail;
 
 DDSFile::DDSFile(Stream* stream)
 {
-    m_size = stream->size();
+    read(stream);
+}
+
+DDSFile::DDSFile(const std::filesystem::path& path, bool memory_mapped)
+{
+    if (!memory_mapped) {
+        read(ref(new FileStream(path, FileStream::Mode::read)));
+        return;
+    }
+
+    m_mapped_file
+        = std::make_unique<MemoryMappedFile>(path, MemoryMappedFile::WHOLE_FILE, MemoryMappedFile::AccessHint::sequential);
+    if (!m_mapped_file->is_open())
+        SGL_THROW("{}: I/O error while attempting to open file", path);
+
+    m_data = static_cast<const uint8_t*>(m_mapped_file->data());
+    m_size = m_mapped_file->mapped_size();
     if (m_size < MIN_HEADER_SIZE)
         SGL_THROW("DDS file is too small");
 
-    m_data = new uint8_t[m_size];
-    stream->read(m_data, m_size);
-
     if (!decode_header(m_data, m_size))
         SGL_THROW("DDS file has invalid header");
 }
 
-DDSFile::DDSFile(const std::filesystem::path& path)
-    : DDSFile(ref(new FileStream(path, FileStream::Mode::read)))
-{
-}
+DDSFile::~DDSFile() { }
 
-DDSFile::~DDSFile()
+void DDSFile::read(Stream* stream)
 {
-    if (m_data)
-        delete[] m_data;
+    m_size = stream->size();
+    if (m_size < MIN_HEADER_SIZE)
+        SGL_THROW("DDS file is too small");
+
+    m_owned_data.reset(new uint8_t[m_size]);
+    stream->read(m_owned_data.get(), m_size);
+    m_data = m_owned_data.get();
+
+    if (!decode_header(m_data, m_size))
+        SGL_THROW("DDS file has invalid header");
 }
 
 const uint8_t* DDSFile::get_subresource_data(uint32_t mip, uint32_t slice)
@@ -5,8 +5,10 @@
 #include "sgl/core/object.h"
 #include "sgl/core/enum.h"
 #include "sgl/core/stream.h"
+#include "sgl/core/memory_mapped_file.h"
 
 #include <filesystem>
+#include <memory>
 
 namespace sgl {
 
@@ -18,8 +20,17 @@ class SGL_API DDSFile : public Object {
 public:
     SGL_NON_COPYABLE_AND_MOVABLE(DDSFile);
 
+    /// Load a DDS file from a stream. The file is read into memory.
     explicit DDSFile(Stream* stream);
-    explicit DDSFile(const std::filesystem::path& path);
+
+    /**
+     * \brief Load a DDS file from disk.
+     *
+     * \param path File path.
+     * \param memory_mapped If true, the file is memory mapped and \c data(), \c resource_data() and
+     * \c get_subresource_data() point directly into the mapping instead of into a copy of the file.
+     */
+    explicit DDSFile(const std::filesystem::path& path, bool memory_mapped = true);
     ~DDSFile();
 
     enum class TextureType {
@@ -42,6 +53,9 @@ public:
     const uint8_t* data() const { return m_data; }
     size_t size() const { return m_size; }
 
+    /// True if the file data is memory mapped.
+    bool memory_mapped() const { return m_mapped_file != nullptr; }
+
     const uint8_t* resource_data() const { return m_data + m_header_size; }
     size_t resource_size() const { return m_size - m_header_size; }
 
@@ -76,10 +90,13 @@ public:
     static bool detect_dds_file(Stream* stream);
 
 private:
+    void read(Stream* stream);
     bool decode_header(const uint8_t* data, size_t size);
 
-    uint8_t* m_data{nullptr};
+    const uint8_t* m_data{nullptr};
     size_t m_size{0};
+    std::unique_ptr<uint8_t[]> m_owned_data;
+    std::unique_ptr<MemoryMappedFile> m_mapped_file;
 
     uint32_t m_dxgi_format;
     TextureType m_type;
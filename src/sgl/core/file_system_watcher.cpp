@@ -4,11 +4,14 @@
 
 #include "sgl/core/error.h"
 
+#include <algorithm>
 #include <map>
 
 #if SGL_LINUX
+#include <sys/eventfd.h>
 #include <sys/inotify.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 #endif
 
@@ -16,7 +19,8 @@ namespace sgl {
 
 struct FileSystemWatchState {
 #if SGL_LINUX
-    int watch_descriptor;
+    /// Watch descriptors of the watched directory (and its subdirectories for recursive watches).
+    std::vector<int> watch_descriptors;
 #endif
 #if !SGL_LINUX
     std::map<std::filesystem::path, std::filesystem::file_time_type> files;
@@ -25,53 +29,84 @@ struct FileSystemWatchState {
     FileSystemWatchDesc desc;
 };
 
+#if SGL_LINUX
+static constexpr uint32_t INOTIFY_MASK = IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO;
+#endif
+
 #if !SGL_LINUX
 static std::map<std::filesystem::path, std::filesystem::file_time_type>
-get_directory_files(const std::filesystem::path& directory)
+get_directory_files(const std::filesystem::path& directory, bool recursive)
 {
     if (!std::filesystem::exists(directory))
         return {};
 
     std::map<std::filesystem::path, std::filesystem::file_time_type> files;
-    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-        if (entry.is_regular_file()) {
-            std::error_code ec;
-            std::filesystem::path rel_path = std::filesystem::relative(entry.path(), directory, ec);
-            if (ec) {
-                log_warn("Failed to get relative path for file \"{}\"", entry.path());
-                continue;
-            }
-            std::filesystem::file_time_type write_time = std::filesystem::last_write_time(entry.path(), ec);
-            if (ec) {
-                log_warn("Failed to get last write time for file \"{}\"", entry.path());
-                continue;
-            }
-            files.emplace(rel_path, write_time);
+    auto add_file = [&](const std::filesystem::directory_entry& entry)
+    {
+        if (!entry.is_regular_file())
+            return;
+        std::error_code ec;
+        std::filesystem::path rel_path = std::filesystem::relative(entry.path(), directory, ec);
+        if (ec) {
+            log_warn("Failed to get relative path for file \"{}\"", entry.path());
+            return;
         }
+        std::filesystem::file_time_type write_time = std::filesystem::last_write_time(entry.path(), ec);
+        if (ec) {
+            log_warn("Failed to get last write time for file \"{}\"", entry.path());
+            return;
+        }
+        files.emplace(rel_path, write_time);
+    };
+
+    std::error_code ec;
+    if (recursive) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(
+                 directory,
+                 std::filesystem::directory_options::skip_permission_denied,
+                 ec
+             ))
+            add_file(entry);
+    } else {
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+            add_file(entry);
     }
     return files;
 }
 #endif
 
+/// Coalesce events in place. Repeated events of the same kind for a file are merged into the
+/// first one (with the time of the last one) and modifications of added files are dropped.
+static void coalesce_events(std::vector<FileSystemWatchEvent>& events)
+{
+    std::map<std::filesystem::path, size_t> last_event;
+    size_t count = 0;
+    for (FileSystemWatchEvent& event : events) {
+        auto it = last_event.find(event.absolute_path);
+        if (it != last_event.end()) {
+            FileSystemWatchEvent& last = events[it->second];
+            bool merge = last.change == event.change
+                || (last.change == FileSystemWatcherChange::added && event.change == FileSystemWatcherChange::modified);
+            if (merge) {
+                last.time = event.time;
+                continue;
+            }
+        }
+        last_event[event.absolute_path] = count;
+        if (&events[count] != &event)
+            events[count] = std::move(event);
+        count++;
+    }
+    events.resize(count);
+}
+
 FileSystemWatcher::FileSystemWatcher()
 {
 #if SGL_LINUX
-    m_inotify_file_descriptor = inotify_init();
+    m_inotify_file_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
     if (m_inotify_file_descriptor < 0) {
         SGL_THROW("Failed to initialize inotify file descriptor");
     }
-
-    int flags = fcntl(m_inotify_file_descriptor, F_GETFL, 0);
-    if (flags == -1) {
-        close(m_inotify_file_descriptor);
-        SGL_THROW("Failed to get inotify file descriptor flags");
-    }
-
-    flags |= O_NONBLOCK;
-    if (fcntl(m_inotify_file_descriptor, F_SETFL, flags) == -1) {
-        close(m_inotify_file_descriptor);
-        SGL_THROW("Failed to set inotify file descriptor flags to non-blocking");
-    }
 #endif
 
 #if !SGL_LINUX
@@ -81,6 +116,8 @@ FileSystemWatcher::FileSystemWatcher()
 
 FileSystemWatcher::~FileSystemWatcher()
 {
+    stop_background_thread();
+
     for (const auto& pair : m_watches) {
         stop_watch(pair.second);
     }
@@ -97,9 +134,7 @@ FileSystemWatcher::~FileSystemWatcher()
 
 uint32_t FileSystemWatcher::add_watch(const FileSystemWatchDesc& desc)
 {
-#if !SGL_LINUX
     std::lock_guard<std::mutex> lock(m_watches_mutex);
-#endif
 
     // Check watch doesn't already exist
     for (const auto& pair : m_watches) {
@@ -119,19 +154,15 @@ uint32_t FileSystemWatcher::add_watch(const FileSystemWatchDesc& desc)
     state->watcher = this;
 
 #if SGL_LINUX
-    // On linux, add a watch to the inotify file descriptor.
-    state->watch_descriptor = inotify_add_watch(
-        m_inotify_file_descriptor,
-        state->desc.directory.c_str(),
-        IN_CREATE | IN_DELETE | IN_MODIFY
-    );
-    if (state->watch_descriptor < 0) {
+    // On linux, add a watch to the inotify file descriptor (for each subdirectory if recursive).
+    add_directory_watch(state.get(), {}, false);
+    if (state->watch_descriptors.empty()) {
         SGL_THROW("Failed to add watch to inotify file descriptor");
     }
 #endif
 
 #if !SGL_LINUX
-    state->files = get_directory_files(state->desc.directory);
+    state->files = get_directory_files(state->desc.directory, state->desc.recursive);
 #endif
 
     m_watches[id] = std::move(state);
@@ -140,9 +171,7 @@ uint32_t FileSystemWatcher::add_watch(const FileSystemWatchDesc& desc)
 
 void FileSystemWatcher::remove_watch(uint32_t id)
 {
-#if !SGL_LINUX
     std::lock_guard<std::mutex> lock(m_watches_mutex);
-#endif
 
     stop_watch(m_watches[id]);
     m_watches.erase(id);
@@ -150,9 +179,7 @@ void FileSystemWatcher::remove_watch(uint32_t id)
 
 void FileSystemWatcher::remove_watch(const std::filesystem::path& directory)
 {
-#if !SGL_LINUX
     std::lock_guard<std::mutex> lock(m_watches_mutex);
-#endif
 
     for (const auto& pair : m_watches) {
         if (pair.second->desc.directory == directory) {
@@ -166,7 +193,10 @@ void FileSystemWatcher::remove_watch(const std::filesystem::path& directory)
 void FileSystemWatcher::stop_watch(const std::unique_ptr<FileSystemWatchState>& state)
 {
 #if SGL_LINUX
-    inotify_rm_watch(m_inotify_file_descriptor, state->watch_descriptor);
+    if (!state)
+        return;
+    while (!state->watch_descriptors.empty())
+        remove_directory_watch(state.get(), state->watch_descriptors.back());
 #endif
 #if !SGL_LINUX
     SGL_UNUSED(state);
@@ -194,82 +224,278 @@ void FileSystemWatcher::_notify_change(
         .time = now,
     };
     {
-#if !SGL_LINUX
         std::lock_guard<std::mutex> lock(m_queued_events_mutex);
-#endif
         m_queued_events.push_back(event);
+        m_last_event = now;
     }
-    m_last_event = now;
 }
 
 void FileSystemWatcher::update()
 {
 #if SGL_LINUX
-    // Attempt non-blocking read from inotify, and return if no data.
-    char buffer[4096];
-    int length = read(m_inotify_file_descriptor, buffer, sizeof(buffer));
-    if (length >= 0) {
+    read_events();
+#endif
+
+    report_events();
+}
+
+void FileSystemWatcher::report_events()
+{
+    std::vector<FileSystemWatchEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(m_queued_events_mutex);
+        if (m_queued_events.empty())
+            return;
+        auto duration = std::chrono::system_clock::now() - m_last_event;
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+        if (millis <= m_output_delay_ms)
+            return;
+        std::swap(events, m_queued_events);
+    }
+
+    // The callback is called without holding the lock, so it can safely add or remove watches.
+    coalesce_events(events);
+    if (m_on_change)
+        m_on_change(events);
+}
+
+#if SGL_LINUX
+
+void FileSystemWatcher::add_directory_watch(
+    FileSystemWatchState* state,
+    const std::filesystem::path& path,
+    bool report_files
+)
+{
+    std::filesystem::path directory = state->desc.directory / path;
+    int watch_descriptor = inotify_add_watch(m_inotify_file_descriptor, directory.c_str(), INOTIFY_MASK);
+    if (watch_descriptor < 0) {
+        // Subdirectories can disappear before they are watched.
+        if (!path.empty())
+            log_debug("Failed to add watch for directory \"{}\"", directory);
+        return;
+    }
+
+    std::vector<DirectoryWatch>& directory_watches = m_directory_watches[watch_descriptor];
+    bool watched = std::any_of(
+        directory_watches.begin(),
+        directory_watches.end(),
+        [state](const DirectoryWatch& watch) { return watch.state == state; }
+    );
+    if (!watched) {
+        directory_watches.push_back({.state = state, .path = path});
+        state->watch_descriptors.push_back(watch_descriptor);
+    }
+
+    if (!state->desc.recursive && !report_files)
+        return;
+
+    // Watch subdirectories. When a new directory is added, its content may have been created
+    // before the watch was added, so report it as added.
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        std::filesystem::path entry_path = path / entry.path().filename();
+        if (report_files)
+            _notify_change(state, entry_path, FileSystemWatcherChange::added);
+        if (state->desc.recursive && entry.is_directory(ec) && !entry.is_symlink(ec))
+            add_directory_watch(state, entry_path, report_files);
+    }
+}
+
+void FileSystemWatcher::remove_directory_watch(FileSystemWatchState* state, int watch_descriptor)
+{
+    std::erase(state->watch_descriptors, watch_descriptor);
+
+    auto it = m_directory_watches.find(watch_descriptor);
+    if (it == m_directory_watches.end())
+        return;
+    std::erase_if(it->second, [state](const DirectoryWatch& watch) { return watch.state == state; });
+    if (it->second.empty()) {
+        inotify_rm_watch(m_inotify_file_descriptor, watch_descriptor);
+        m_directory_watches.erase(it);
+    }
+}
+
+void FileSystemWatcher::remove_directory_watches(FileSystemWatchState* state, const std::filesystem::path& path)
+{
+    std::vector<int> watch_descriptors = state->watch_descriptors;
+    for (int watch_descriptor : watch_descriptors) {
+        const std::vector<DirectoryWatch>& directory_watches = m_directory_watches[watch_descriptor];
+        bool is_subdirectory = std::any_of(
+            directory_watches.begin(),
+            directory_watches.end(),
+            [&](const DirectoryWatch& watch)
+            {
+                return watch.state == state
+                    && std::mismatch(path.begin(), path.end(), watch.path.begin(), watch.path.end()).first
+                    == path.end();
+            }
+        );
+        if (is_subdirectory)
+            remove_directory_watch(state, watch_descriptor);
+    }
+}
+
+void FileSystemWatcher::read_events()
+{
+    std::lock_guard<std::mutex> lock(m_watches_mutex);
+
+    // Drain the inotify event queue.
+    alignas(inotify_event) char buffer[64 * 1024];
+    while (true) {
+        ssize_t length = read(m_inotify_file_descriptor, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EBADF && errno != EINTR)
+                SGL_THROW("Failed to read from inotify file descriptor");
+            break;
+        }
+
         // Iterate over the inotify events and call '_notify_change' on the watcher for each one.
-        int offset = 0;
+        ssize_t offset = 0;
         while (offset < length) {
             auto event = reinterpret_cast<inotify_event*>(buffer + offset);
-            std::filesystem::path path{event->name};
-            FileSystemWatcherChange change = FileSystemWatcherChange::invalid;
+            offset += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                log_warn("File system watcher event queue overflowed, some changes were not detected");
+                continue;
+            }
+
+            auto it = m_directory_watches.find(event->wd);
+            if (it == m_directory_watches.end())
+                continue;
 
-            if (event->mask & IN_CREATE) {
+            if (event->mask & IN_IGNORED) {
+                // Watched directory was removed.
+                for (const DirectoryWatch& watch : it->second)
+                    std::erase(watch.state->watch_descriptors, event->wd);
+                m_directory_watches.erase(it);
+                continue;
+            }
+
+            FileSystemWatcherChange change = FileSystemWatcherChange::invalid;
+            if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
                 change = FileSystemWatcherChange::added;
-            } else if (event->mask & IN_DELETE) {
+            } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
                 change = FileSystemWatcherChange::removed;
             } else if (event->mask & IN_MODIFY) {
                 change = FileSystemWatcherChange::modified;
             }
+            if (change == FileSystemWatcherChange::invalid)
+                continue;
 
-            if (change != FileSystemWatcherChange::invalid) {
-                auto it = std::find_if(
-                    m_watches.begin(),
-                    m_watches.end(),
-                    [event](const auto& pair) { return pair.second->watch_descriptor == event->wd; }
-                );
-                if (it != m_watches.end()) {
-                    _notify_change(it->second.get(), path, change);
+            // Copy the watches, as adding a subdirectory watch can modify the map.
+            std::vector<DirectoryWatch> watches = it->second;
+            for (const DirectoryWatch& watch : watches) {
+                std::filesystem::path path = watch.path / event->name;
+                _notify_change(watch.state, path, change);
+                if ((event->mask & IN_ISDIR) && watch.state->desc.recursive) {
+                    // Update watches of subdirectories created, moved or removed.
+                    if (change == FileSystemWatcherChange::added)
+                        add_directory_watch(watch.state, path, true);
+                    else
+                        remove_directory_watches(watch.state, path);
                 }
             }
-            offset += sizeof(struct inotify_event) + event->len;
         }
-    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EBADF) {
-        SGL_THROW("Failed to read from inotify file descriptor");
     }
-#endif
+}
 
-    // Process queued events.
-    {
-#if !SGL_LINUX
-        std::lock_guard<std::mutex> lock(m_queued_events_mutex);
-#endif
-        if (m_queued_events.size() > 0) {
-            auto duration = std::chrono::system_clock::now() - m_last_event;
-            auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-            if (millis > m_output_delay_ms) {
-                m_on_change(m_queued_events);
-                m_queued_events.clear();
+void FileSystemWatcher::start_background_thread()
+{
+    if (m_background_thread_running)
+        return;
+
+    m_wake_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wake_file_descriptor < 0)
+        SGL_THROW("Failed to create event file descriptor");
+
+    m_background_thread_running = true;
+    m_thread = std::thread([this]() { thread_func(); });
+}
+
+void FileSystemWatcher::stop_background_thread()
+{
+    if (!m_background_thread_running)
+        return;
+
+    uint64_t value = 1;
+    [[maybe_unused]] ssize_t written = write(m_wake_file_descriptor, &value, sizeof(value));
+    if (m_thread.joinable())
+        m_thread.join();
+    close(m_wake_file_descriptor);
+    m_wake_file_descriptor = -1;
+    m_background_thread_running = false;
+}
+
+void FileSystemWatcher::thread_func()
+{
+    pollfd fds[2] = {
+        {.fd = m_inotify_file_descriptor, .events = POLLIN, .revents = 0},
+        {.fd = m_wake_file_descriptor, .events = POLLIN, .revents = 0},
+    };
+
+    while (true) {
+        // Block until events arrive, or until queued events are due to be reported.
+        int timeout = -1;
+        {
+            std::lock_guard<std::mutex> lock(m_queued_events_mutex);
+            if (!m_queued_events.empty()) {
+                auto due = m_last_event + std::chrono::milliseconds(m_output_delay_ms + 1);
+                auto remaining = due - std::chrono::system_clock::now();
+                timeout = int(std::max<int64_t>(
+                    0,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count() + 1
+                ));
             }
         }
+
+        int result = poll(fds, 2, timeout);
+        if (result < 0 && errno != EINTR) {
+            log_error("File system watcher failed to wait for events");
+            break;
+        }
+        if (fds[1].revents & POLLIN)
+            break;
+
+        try {
+            if (fds[0].revents & POLLIN)
+                read_events();
+            report_events();
+        } catch (const std::exception& e) {
+            log_error("File system watcher failed to process events: {}", e.what());
+        }
     }
 }
 
+#endif // SGL_LINUX
+
 #if !SGL_LINUX
+void FileSystemWatcher::start_background_thread()
+{
+    // Changes are always detected on the polling thread, which also reports them while enabled.
+    m_background_thread_running = true;
+}
+
+void FileSystemWatcher::stop_background_thread()
+{
+    m_background_thread_running = false;
+}
+
 void FileSystemWatcher::thread_func()
 {
     uint32_t counter = 0;
     while (!m_stop_thread) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (m_background_thread_running)
+            report_events();
         if (counter++ % 10 != 0)
             continue;
 
         std::lock_guard<std::mutex> lock(m_watches_mutex);
         for (const auto& [_, state] : m_watches) {
             std::map<std::filesystem::path, std::filesystem::file_time_type> files
-                = get_directory_files(state->desc.directory);
+                = get_directory_files(state->desc.directory, state->desc.recursive);
 
             // Detect added and modified files.
             for (const auto& [path, write_time] : files) {
@@ -14,6 +14,8 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace sgl {
 
@@ -30,6 +32,9 @@ struct FileSystemWatchDesc {
 
     /// Directory to monitor.
     std::filesystem::path directory;
+
+    /// Monitor all subdirectories (including subdirectories created later on).
+    bool recursive{false};
 };
 
 /// Data reported on a given file system event to a file monitored
@@ -54,7 +59,10 @@ struct FileSystemWatchState;
 
 /// Monitors directories for changes and calls a callback when they're detected.
 /// The watcher automatically queues up changes until disk has been idle for
-/// a period. Relies on regular polling of update().
+/// a period. Queued changes are coalesced, i.e. repeated changes of the same
+/// kind to a file are reported once.
+/// Relies on regular polling of update(), or on a background thread started
+/// with start_background_thread(), which calls the callback from the thread.
 class SGL_API FileSystemWatcher : public Object {
     SGL_OBJECT(FileSystemWatcher)
 public:
@@ -87,6 +95,17 @@ public:
     /// Update function to poll the watcher + report events.
     void update();
 
+    /// Start a background thread that waits for file system events and reports them
+    /// (from the background thread) once the disk has been idle for the delay period.
+    /// Calling update() is not required while the thread is running.
+    void start_background_thread();
+
+    /// Stop the background thread.
+    void stop_background_thread();
+
+    /// True if the background thread is running.
+    bool is_background_thread_running() const { return m_background_thread_running; }
+
     /// Delay period before queued events are output.
     uint32_t delay() { return m_output_delay_ms; }
 
@@ -100,6 +119,9 @@ private:
     /// Releases OS monitoring for a given watch.
     void stop_watch(const std::unique_ptr<FileSystemWatchState>&);
 
+    /// Report queued events if the disk has been idle for the delay period.
+    void report_events();
+
     /// Next unique id to be assigned to a given watch.
     uint32_t m_next_id{1};
 
@@ -118,18 +140,51 @@ private:
     /// Time last event was recorded.
     std::chrono::system_clock::time_point m_last_event;
 
-#if SGL_LINUX
-    /// File descriptor for linux inotify watcher.
-    int m_inotify_file_descriptor;
-#endif
-
-#if !SGL_LINUX
     /// Mutex to protect the watch map.
     std::mutex m_watches_mutex;
 
     /// Mutex to protect the queued events.
     std::mutex m_queued_events_mutex;
 
+    /// True if the background thread is running.
+    std::atomic<bool> m_background_thread_running{false};
+
+#if SGL_LINUX
+    /// Watch of a single directory (subdirectory of a recursive watch).
+    struct DirectoryWatch {
+        FileSystemWatchState* state;
+        /// Path of the directory relative to the watched directory.
+        std::filesystem::path path;
+    };
+
+    /// Add an inotify watch for a directory (and its subdirectories for recursive watches).
+    void add_directory_watch(FileSystemWatchState* state, const std::filesystem::path& path, bool report_files);
+
+    /// Remove a single inotify watch of a watch state.
+    void remove_directory_watch(FileSystemWatchState* state, int watch_descriptor);
+
+    /// Remove the inotify watches of a subdirectory (and its subdirectories) of a watch state.
+    void remove_directory_watches(FileSystemWatchState* state, const std::filesystem::path& path);
+
+    /// Read and process all pending inotify events.
+    void read_events();
+
+    /// File descriptor for linux inotify watcher.
+    int m_inotify_file_descriptor;
+
+    /// Event file descriptor to wake up the background thread.
+    int m_wake_file_descriptor{-1};
+
+    /// Map of inotify watch descriptor -> directory watches (a descriptor is shared
+    /// by all watches of the same directory).
+    std::unordered_map<int, std::vector<DirectoryWatch>> m_directory_watches;
+
+    /// Background thread waiting for inotify events.
+    std::thread m_thread;
+    void thread_func();
+#endif
+
+#if !SGL_LINUX
     /// Thread to poll for file system changes.
     std::thread m_thread;
     std::atomic<bool> m_stop_thread{false};
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hash.h"
+
+#include <cstring>
+
+namespace sgl {
+
+namespace {
+
+    constexpr uint64_t PRIME1 = 0x9e3779b185ebca87ull;
+    constexpr uint64_t PRIME2 = 0xc2b2ae3d27d4eb4full;
+    constexpr uint64_t PRIME3 = 0x165667b19e3779f9ull;
+    constexpr uint64_t PRIME4 = 0x85ebca77c2b2ae63ull;
+    constexpr uint64_t PRIME5 = 0x27d4eb2f165667c5ull;
+
+    inline uint64_t rotl64(uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // Unaligned little-endian loads (all supported platforms are little-endian).
+    inline uint64_t read64(const uint8_t* ptr)
+    {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t read32(const uint8_t* ptr)
+    {
+        uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t round(uint64_t acc, uint64_t input)
+    {
+        acc += input * PRIME2;
+        acc = rotl64(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t merge_round(uint64_t acc, uint64_t value)
+    {
+        acc ^= round(0, value);
+        return acc * PRIME1 + PRIME4;
+    }
+
+} // namespace
+
+uint64_t hash_data(const void* data, size_t len, uint64_t seed)
+{
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end = ptr + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        // Process 32 byte stripes in four independent lanes.
+        uint64_t v1 = seed + PRIME1 + PRIME2;
+        uint64_t v2 = seed + PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = round(v1, read64(ptr));
+            v2 = round(v2, read64(ptr + 8));
+            v3 = round(v3, read64(ptr + 16));
+            v4 = round(v4, read64(ptr + 24));
+            ptr += 32;
+        } while (ptr <= limit);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + PRIME5;
+    }
+
+    h += uint64_t(len);
+
+    // Process remaining bytes.
+    while (ptr + 8 <= end) {
+        h ^= round(0, read64(ptr));
+        h = rotl64(h, 27) * PRIME1 + PRIME4;
+        ptr += 8;
+    }
+    if (ptr + 4 <= end) {
+        h ^= uint64_t(read32(ptr)) * PRIME1;
+        h = rotl64(h, 23) * PRIME2 + PRIME3;
+        ptr += 4;
+    }
+    while (ptr < end) {
+        h ^= (*ptr) * PRIME5;
+        h = rotl64(h, 11) * PRIME1;
+        ptr++;
+    }
+
+    // Final avalanche.
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+} // namespace sgl
@@ -2,11 +2,26 @@
 
 #pragma once
 
+#include "sgl/core/macros.h"
+
 #include <utility>
 #include <functional>
+#include <cstddef>
+#include <cstdint>
 
 namespace sgl {
 
+/**
+ * Compute a fast 64-bit non-cryptographic hash (XXH64) of the given data.
+ * Processes 32 bytes per iteration, which makes it much faster than \c SHA1 for
+ * change detection of larger blobs (i.e. file contents).
+ * \param data Data to hash.
+ * \param len Length of data in bytes.
+ * \param seed Hash seed.
+ * \return 64-bit hash.
+ */
+SGL_API uint64_t hash_data(const void* data, size_t len, uint64_t seed = 0);
+
 inline size_t hash_combine(size_t hash1, size_t hash2)
 {
     return hash2 ^ (hash1 + 0x9e3779b9 + (hash2 << 6) + (hash2 >> 2));
@@ -8,8 +8,13 @@
 
 #include <fmt/color.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <thread>
 
 #if SGL_WINDOWS
 #ifndef WIN32_LEAN_AND_MEAN
@@ -72,8 +77,12 @@ void ConsoleLoggerOutput::write(LogLevel level, const std::string_view module, c
         else
             fmt::print(stream, "[{}] ({}) {}\n", level_str, module, msg);
     }
+}
 
-    ::fflush(stream);
+void ConsoleLoggerOutput::flush()
+{
+    ::fflush(stdout);
+    ::fflush(stderr);
 }
 
 std::string ConsoleLoggerOutput::to_string() const
@@ -129,6 +138,10 @@ void FileLoggerOutput::write(LogLevel level, const std::string_view module, cons
         fmt::print(static_cast<FILE*>(m_file), "[{}] {}\n", s_level_str[int(level)], msg);
     else
         fmt::print(static_cast<FILE*>(m_file), "[{}] ({}) {}\n", s_level_str[int(level)], module, msg);
+}
+
+void FileLoggerOutput::flush()
+{
     ::fflush(static_cast<FILE*>(m_file));
 }
 
@@ -161,6 +174,229 @@ std::string DebugConsoleLoggerOutput::to_string() const
     return "DebugConsoleLoggerOutput()";
 }
 
+/**
+ * Background writer for asynchronous logging.
+ *
+ * Messages are pushed into a bounded lock-free multi-producer single-consumer ring buffer
+ * (based on Dmitry Vyukov's bounded MPMC queue). Each slot stores a sequence number that
+ * tells producers and the consumer whether the slot is free or holds a message.
+ * Slots keep their string storage, so pushing a message does not allocate once the queue is warm.
+ *
+ * The writer thread drains the queue in batches and writes the messages to the logger outputs.
+ * Outputs are flushed every \c FLUSH_INTERVAL (if anything was written) and on request.
+ * Producers only wake the writer thread (which requires a lock) when it is idle.
+ *
+ * Producers may block on the writer (full queue, fatal messages, flush) while holding arbitrary locks.
+ * The writer therefore only calls outputs that support asynchronous logging, i.e. outputs that never wait
+ * for a lock held by a logging thread (such as the Python GIL). It also never copies output references,
+ * as adjusting the reference count of an object owned by Python acquires the GIL as well.
+ */
+struct Logger::AsyncWriter {
+    /// Maximum number of messages written per batch (while holding the logger mutex).
+    static constexpr size_t MAX_BATCH_SIZE = 256;
+    /// Interval for flushing outputs.
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{100};
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        std::string msg;
+    };
+
+    Logger* logger;
+    LogOverflowPolicy overflow_policy;
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+
+    alignas(64) std::atomic<size_t> enqueue_pos{0};
+    alignas(64) size_t dequeue_pos{0};
+
+    std::atomic<bool> idle{false};
+    std::mutex mutex;
+    std::condition_variable wake_cv;
+    std::condition_variable flushed_cv;
+    bool wake_requested{false};
+    bool stop{false};
+    size_t flush_target{0};
+    size_t flushed_pos{0};
+
+    std::thread thread;
+
+    AsyncWriter(Logger* logger_, size_t capacity, LogOverflowPolicy overflow_policy_)
+        : logger(logger_)
+        , overflow_policy(overflow_policy_)
+    {
+        size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        slots = std::make_unique<Slot[]>(size);
+        for (size_t i = 0; i < size; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        mask = size - 1;
+        thread = std::thread(&AsyncWriter::run, this);
+    }
+
+    ~AsyncWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake_cv.notify_one();
+        thread.join();
+    }
+
+    bool try_push(LogLevel level, std::string_view msg)
+    {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & mask];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(sequence) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                // Queue is full.
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->level = level;
+        slot->msg.assign(msg);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Push a message. Returns false if the message was dropped.
+    bool push(LogLevel level, std::string_view msg)
+    {
+        while (!try_push(level, msg)) {
+            if (overflow_policy == LogOverflowPolicy::drop && level < LogLevel::error)
+                return false;
+            if (idle.load(std::memory_order_relaxed))
+                wake();
+            std::this_thread::yield();
+        }
+        // Pairs with the fence in run() to make sure an idle writer either sees the message or is woken up.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idle.load(std::memory_order_relaxed))
+            wake();
+        return true;
+    }
+
+    void wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            wake_requested = true;
+        }
+        wake_cv.notify_one();
+    }
+
+    /// Block until all messages pushed so far are written and the outputs are flushed.
+    void flush()
+    {
+        // Flushing from the writer thread (i.e. from within an output) would deadlock.
+        if (std::this_thread::get_id() == thread.get_id())
+            return;
+        size_t target = enqueue_pos.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(mutex);
+        flush_target = std::max(flush_target, target);
+        wake_requested = true;
+        wake_cv.notify_one();
+        flushed_cv.wait(lock, [&] { return flushed_pos >= target; });
+    }
+
+    bool has_message() const
+    {
+        return slots[dequeue_pos & mask].sequence.load(std::memory_order_acquire) == dequeue_pos + 1;
+    }
+
+    /// Write up to \c MAX_BATCH_SIZE queued messages. Returns the number of written messages.
+    size_t write_batch()
+    {
+        std::lock_guard<std::mutex> lock(logger->m_mutex);
+        size_t count = 0;
+        for (; count < MAX_BATCH_SIZE && has_message(); ++count) {
+            Slot& slot = slots[dequeue_pos & mask];
+            for (const auto& output : logger->m_outputs)
+                output->write(slot.level, logger->m_name, slot.msg);
+            slot.sequence.store(dequeue_pos + mask + 1, std::memory_order_release);
+            dequeue_pos++;
+        }
+        return count;
+    }
+
+    void flush_outputs()
+    {
+        std::lock_guard<std::mutex> lock(logger->m_mutex);
+        for (const auto& output : logger->m_outputs)
+            output->flush();
+    }
+
+    /// Publish that all written messages are flushed.
+    void notify_flushed()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            flushed_pos = dequeue_pos;
+        }
+        flushed_cv.notify_all();
+    }
+
+    void run()
+    {
+        using clock = std::chrono::steady_clock;
+        auto last_flush = clock::now();
+        bool dirty = false;
+
+        while (true) {
+            if (write_batch() > 0) {
+                dirty = true;
+                // Flush periodically while busy.
+                if (clock::now() - last_flush >= FLUSH_INTERVAL) {
+                    flush_outputs();
+                    dirty = false;
+                    last_flush = clock::now();
+                    notify_flushed();
+                }
+                continue;
+            }
+
+            // Queue is empty. Flush if requested, when stopping or when the flush interval has passed.
+            std::unique_lock<std::mutex> lock(mutex);
+            if (dirty && (flush_target > flushed_pos || stop || clock::now() - last_flush >= FLUSH_INTERVAL)) {
+                lock.unlock();
+                flush_outputs();
+                dirty = false;
+                last_flush = clock::now();
+                lock.lock();
+            }
+            if (!dirty) {
+                flushed_pos = dequeue_pos;
+                flushed_cv.notify_all();
+            }
+            if (has_message())
+                continue;
+            if (stop)
+                break;
+
+            // Wait for new messages. The timeout also bounds the delay of a missed wake-up.
+            idle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto timeout = FLUSH_INTERVAL;
+            if (dirty)
+                timeout -= std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - last_flush);
+            wake_cv.wait_for(lock, timeout, [&] { return wake_requested || stop || has_message(); });
+            idle.store(false, std::memory_order_relaxed);
+            wake_requested = false;
+        }
+    }
+};
+
 Logger::Logger(LogLevel log_level, const std::string_view name, bool use_default_outputs)
     : m_level(log_level)
     , m_name(name)
@@ -172,6 +408,11 @@ Logger::Logger(LogLevel log_level, const std::string_view name, bool use_default
     }
 }
 
+Logger::~Logger()
+{
+    disable_async();
+}
+
 ref<LoggerOutput> Logger::add_console_output(bool colored)
 {
     ref<LoggerOutput> output = make_ref<ConsoleLoggerOutput>(colored);
@@ -203,6 +444,11 @@ void Logger::use_same_outputs(const Logger& other)
 void Logger::add_output(ref<LoggerOutput> output)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
+    SGL_CHECK(
+        !is_async() || output->supports_async(),
+        "Logger output \"{}\" does not support asynchronous logging",
+        output->to_string()
+    );
     m_outputs.insert(output);
 }
 
@@ -232,28 +478,104 @@ void Logger::set_name(std::string_view name)
 
 LogLevel Logger::level() const
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_level;
+    return m_level.load(std::memory_order_relaxed);
 }
 
 void Logger::set_level(LogLevel level)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_level = level;
+    m_level.store(level, std::memory_order_relaxed);
 }
 
 void Logger::log(LogLevel level, const std::string_view msg, LogFrequency frequency)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    if (level != LogLevel::none && level < m_level)
+    if (level != LogLevel::none && level < m_level.load(std::memory_order_relaxed))
         return;
 
+    // Only errors and fatal messages are flushed immediately, so they are not lost on a crash.
+    bool flush = level >= LogLevel::error;
+
+    // Only touch the shared user counter when async mode is likely enabled. The writer is reloaded
+    // after registering as a user, so a concurrent disable_async() is still handled correctly.
+    if (m_async_writer.load(std::memory_order_relaxed)) {
+        m_async_users.fetch_add(1);
+        if (AsyncWriter* writer = m_async_writer.load()) {
+            bool duplicate = false;
+            if (frequency == LogFrequency::once) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                duplicate = is_duplicate(msg);
+            }
+            if (!duplicate) {
+                if (!writer->push(level, msg))
+                    m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+                else if (flush)
+                    writer->flush();
+            }
+            m_async_users.fetch_sub(1);
+            return;
+        }
+        m_async_users.fetch_sub(1);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (frequency == LogFrequency::once && is_duplicate(msg))
         return;
 
-    for (const auto& output : m_outputs)
+    for (const auto& output : m_outputs) {
         output->write(level, m_name, msg);
+        if (flush)
+            output->flush();
+    }
+}
+
+void Logger::enable_async(size_t queue_capacity, LogOverflowPolicy overflow_policy)
+{
+    SGL_CHECK(queue_capacity > 0, "Invalid queue capacity, must be larger than 0");
+
+    std::lock_guard<std::mutex> lock(m_async_mutex);
+    AsyncWriter* previous;
+    {
+        // Check and install the writer under the mutex so no unsupported output can be added in between.
+        std::lock_guard<std::mutex> outputs_lock(m_mutex);
+        for (const auto& output : m_outputs)
+            SGL_CHECK(
+                output->supports_async(),
+                "Logger output \"{}\" does not support asynchronous logging",
+                output->to_string()
+            );
+        AsyncWriter* writer = new AsyncWriter(this, queue_capacity, overflow_policy);
+        previous = m_async_writer.exchange(writer);
+    }
+    if (previous) {
+        // Wait for threads still pushing to the previous writer before destroying it (which writes its messages).
+        while (m_async_users.load() > 0)
+            std::this_thread::yield();
+        delete previous;
+    }
+}
+
+void Logger::disable_async()
+{
+    std::lock_guard<std::mutex> lock(m_async_mutex);
+    AsyncWriter* writer = m_async_writer.exchange(nullptr);
+    if (!writer)
+        return;
+    while (m_async_users.load() > 0)
+        std::this_thread::yield();
+    delete writer;
+}
+
+void Logger::flush()
+{
+    m_async_users.fetch_add(1);
+    if (AsyncWriter* writer = m_async_writer.load()) {
+        writer->flush();
+    } else {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& output : m_outputs)
+            output->flush();
+    }
+    m_async_users.fetch_sub(1);
 }
 
 static Logger* s_logger;
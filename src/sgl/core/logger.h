@@ -6,6 +6,7 @@
 #include "sgl/core/object.h"
 #include "sgl/core/format.h"
 
+#include <atomic>
 #include <mutex>
 #include <string_view>
 #include <set>
@@ -32,6 +33,14 @@ enum class LogFrequency {
     once,
 };
 
+/// Policy for handling a full message queue in asynchronous logging mode.
+enum class LogOverflowPolicy {
+    /// Block the logging thread until there is space in the queue.
+    block,
+    /// Drop the message. Messages with level \c error or higher are never dropped.
+    drop,
+};
+
 /// Abstract base class for logger outputs.
 class SGL_API LoggerOutput : public Object {
     SGL_OBJECT(LoggerOutput)
@@ -43,6 +52,13 @@ public:
     /// \param module The module name.
     /// \param msg The message.
     virtual void write(LogLevel level, const std::string_view module, const std::string_view msg) = 0;
+
+    /// Flush buffered messages.
+    virtual void flush() { }
+
+    /// True if the output can be written from the background thread used in asynchronous logging mode.
+    /// Outputs that need to acquire a lock held by logging threads (e.g. the Python GIL) must return false.
+    virtual bool supports_async() const { return true; }
 };
 
 /// Logger output that writes to the console.
@@ -54,6 +70,8 @@ public:
 
     void write(LogLevel level, const std::string_view module, const std::string_view msg) override;
 
+    void flush() override;
+
     std::string to_string() const override;
 
 private:
@@ -72,6 +90,8 @@ public:
 
     void write(LogLevel level, const std::string_view module, const std::string_view msg) override;
 
+    void flush() override;
+
     std::string to_string() const override;
 
 private:
@@ -123,6 +143,7 @@ public:
     /// \param name The name of the logger.
     /// \param use_default_outputs Whether to use the default outputs (console + debug console on windows).
     Logger(LogLevel level = LogLevel::info, const std::string_view name = {}, bool use_default_outputs = true);
+    ~Logger();
 
     static ref<Logger>
     create(LogLevel level = LogLevel::info, const std::string_view name = {}, bool use_default_outputs = true)
@@ -149,6 +170,7 @@ public:
     void use_same_outputs(const Logger& other);
 
     /// Add a logger output.
+    /// Throws if asynchronous logging is enabled and the output does not support it.
     /// \param output The logger output to add.
     void add_output(ref<LoggerOutput> output);
 
@@ -173,6 +195,28 @@ public:
     /// \param frequency The log frequency.
     void log(LogLevel level, const std::string_view msg, LogFrequency frequency = LogFrequency::always);
 
+    /// Enable asynchronous logging.
+    /// In asynchronous mode, logging threads only push messages into a bounded lock-free queue.
+    /// A background thread writes the queued messages to the outputs in batches and flushes the outputs
+    /// periodically (instead of after every message).
+    /// Error and fatal messages are flushed immediately.
+    /// Throws if any of the outputs does not support asynchronous logging (see \c LoggerOutput::supports_async).
+    /// \param queue_capacity The capacity of the message queue (rounded up to a power of two).
+    /// \param overflow_policy How to handle messages logged while the queue is full.
+    void enable_async(size_t queue_capacity = 4096, LogOverflowPolicy overflow_policy = LogOverflowPolicy::block);
+
+    /// Disable asynchronous logging. Writes all queued messages before returning.
+    void disable_async();
+
+    /// True if asynchronous logging is enabled.
+    bool is_async() const { return m_async_writer.load() != nullptr; }
+
+    /// Number of messages dropped due to a full message queue.
+    uint64_t dropped_count() const { return m_dropped_count.load(); }
+
+    /// Block until all logged messages are written and flush all outputs.
+    void flush();
+
     // Define logging functions.
     SGL_LOG_FUNC_FAMILY(debug, LogLevel::debug, log)
     SGL_LOG_FUNC_FAMILY(info, LogLevel::info, log)
@@ -190,13 +234,22 @@ private:
     /// Checks if the given message has already been logged.
     bool is_duplicate(const std::string_view msg);
 
-    LogLevel m_level{LogLevel::info};
+    /// Background writer used in asynchronous mode.
+    struct AsyncWriter;
+
+    std::atomic<LogLevel> m_level{LogLevel::info};
     std::string m_name;
 
     std::set<ref<LoggerOutput>> m_outputs;
     std::set<std::string, std::less<>> m_messages;
 
     mutable std::mutex m_mutex;
+
+    std::atomic<AsyncWriter*> m_async_writer{nullptr};
+    /// Number of threads currently accessing the async writer.
+    std::atomic<uint32_t> m_async_users{0};
+    std::atomic<uint64_t> m_dropped_count{0};
+    std::mutex m_async_mutex;
 };
 
 // Define global logging functions.
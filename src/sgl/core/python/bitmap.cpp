@@ -8,6 +8,31 @@
 
 #include "sgl/stl/bit.h" // Replace with <bit> when available on all platforms.
 
+namespace sgl {
+
+inline Bitmap::TransformOptions make_transform_options(
+    bool flip_y,
+    size_t row_pitch,
+    size_t row_alignment,
+    std::optional<std::array<uint32_t, 4>> region
+)
+{
+    Bitmap::TransformOptions options;
+    options.flip_y = flip_y;
+    options.row_pitch = row_pitch;
+    options.row_alignment = row_alignment;
+    if (region)
+        options.region = Bitmap::Region{
+            .x = (*region)[0],
+            .y = (*region)[1],
+            .width = (*region)[2],
+            .height = (*region)[3],
+        };
+    return options;
+}
+
+} // namespace sgl
+
 SGL_PY_EXPORT(core_bitmap)
 {
     using namespace sgl;
@@ -136,6 +161,67 @@ SGL_PY_EXPORT(core_bitmap)
             "srgb_gamma"_a.none() = nb::none(),
             D(Bitmap, convert)
         )
+        .def(
+            "transform",
+            [](const Bitmap& self,
+               nb::ndarray<nb::device::cpu> dst,
+               const Struct* dst_struct,
+               bool flip_y,
+               size_t row_pitch,
+               size_t row_alignment,
+               std::optional<std::array<uint32_t, 4>> region)
+            {
+                SGL_CHECK(is_ndarray_contiguous(dst), "dst is not contiguous.");
+                self.transform(
+                    dst.data(),
+                    dst.nbytes(),
+                    dst_struct,
+                    make_transform_options(flip_y, row_pitch, row_alignment, region)
+                );
+            },
+            "dst"_a,
+            "dst_struct"_a,
+            "flip_y"_a = false,
+            "row_pitch"_a = 0,
+            "row_alignment"_a = 1,
+            "region"_a.none() = nb::none(),
+            D(Bitmap, transform)
+        )
+        .def(
+            "transform_row_pitch",
+            [](const Bitmap& self,
+               const Struct* dst_struct,
+               size_t row_pitch,
+               size_t row_alignment,
+               std::optional<std::array<uint32_t, 4>> region)
+            {
+                return self.transform_row_pitch(
+                    dst_struct,
+                    make_transform_options(false, row_pitch, row_alignment, region)
+                );
+            },
+            "dst_struct"_a,
+            "row_pitch"_a = 0,
+            "row_alignment"_a = 1,
+            "region"_a.none() = nb::none(),
+            D(Bitmap, transform_row_pitch)
+        )
+        .def(
+            "transform_size",
+            [](const Bitmap& self,
+               const Struct* dst_struct,
+               size_t row_pitch,
+               size_t row_alignment,
+               std::optional<std::array<uint32_t, 4>> region)
+            {
+                return self.transform_size(dst_struct, make_transform_options(false, row_pitch, row_alignment, region));
+            },
+            "dst_struct"_a,
+            "row_pitch"_a = 0,
+            "row_alignment"_a = 1,
+            "region"_a.none() = nb::none(),
+            D(Bitmap, transform_size)
+        )
         .def(
             "write",
             nb::overload_cast<const std::filesystem::path&, Bitmap::FileFormat, int>(&Bitmap::write, nb::const_),
@@ -159,6 +245,48 @@ SGL_PY_EXPORT(core_bitmap)
             "format"_a = Bitmap::FileFormat::auto_,
             D(Bitmap, read_multiple)
         )
+        .def_static(
+            "set_exr_thread_count",
+            &Bitmap::set_exr_thread_count,
+            "count"_a,
+            D(Bitmap, set_exr_thread_count)
+        )
+        .def_static("exr_thread_count", &Bitmap::exr_thread_count, D(Bitmap, exr_thread_count))
+        .def_static(
+            "read_blocks",
+            [](const std::filesystem::path& path,
+               std::function<void(ref<Bitmap>, uint32_t)> callback,
+               Bitmap::FileFormat format,
+               uint32_t block_height,
+               uint32_t downsample,
+               std::optional<std::array<uint32_t, 4>> region)
+            {
+                Bitmap::ReadBlocksOptions options;
+                options.format = format;
+                options.block_height = block_height;
+                options.downsample = downsample;
+                if (region)
+                    options.region = Bitmap::Region{
+                        .x = (*region)[0],
+                        .y = (*region)[1],
+                        .width = (*region)[2],
+                        .height = (*region)[3],
+                    };
+                // Blocks are only valid during the callback, pass copies to Python.
+                Bitmap::read_blocks(
+                    path,
+                    [&](const Bitmap* block, uint32_t y) { callback(make_ref<Bitmap>(*block), y); },
+                    options
+                );
+            },
+            "path"_a,
+            "callback"_a,
+            "format"_a = Bitmap::FileFormat::auto_,
+            "block_height"_a = 64,
+            "downsample"_a = 1,
+            "region"_a.none() = nb::none(),
+            D(Bitmap, read_blocks)
+        )
         .def(nb::self == nb::self)
         .def(nb::self != nb::self)
         .def_prop_ro(
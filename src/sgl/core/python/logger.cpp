@@ -7,7 +7,7 @@
 namespace sgl {
 class PyLoggerOutput : public LoggerOutput {
 public:
-    NB_TRAMPOLINE(LoggerOutput, 1);
+    NB_TRAMPOLINE(LoggerOutput, 2);
 
     PyLoggerOutput() = default;
 
@@ -15,6 +15,11 @@ public:
     {
         NB_OVERRIDE_PURE(write, level, module, msg);
     }
+
+    void flush() override { NB_OVERRIDE(flush); }
+
+    /// Python outputs acquire the GIL, which logging threads may hold while waiting for the async writer.
+    bool supports_async() const override { return false; }
 };
 } // namespace sgl
 
@@ -34,9 +39,15 @@ SGL_PY_EXPORT(core_logger)
         .value("always", LogFrequency::always, D(LogFrequency, always))
         .value("once", LogFrequency::once, D(LogFrequency, once));
 
+    nb::enum_<LogOverflowPolicy>(m, "LogOverflowPolicy", D(LogOverflowPolicy))
+        .value("block", LogOverflowPolicy::block, D(LogOverflowPolicy, block))
+        .value("drop", LogOverflowPolicy::drop, D(LogOverflowPolicy, drop));
+
     nb::class_<LoggerOutput, Object, PyLoggerOutput>(m, "LoggerOutput", D(LoggerOutput))
         .def(nb::init<>())
-        .def("write", &LoggerOutput::write, "level"_a, "name"_a, "msg"_a, D(LoggerOutput, write));
+        .def("write", &LoggerOutput::write, "level"_a, "name"_a, "msg"_a, D(LoggerOutput, write))
+        .def("flush", &LoggerOutput::flush, D(LoggerOutput, flush))
+        .def_prop_ro("supports_async", &LoggerOutput::supports_async, D(LoggerOutput, supports_async));
 
     nb::class_<ConsoleLoggerOutput, LoggerOutput>(m, "ConsoleLoggerOutput", D(ConsoleLoggerOutput))
         .def(nb::init<bool>(), "colored"_a = true);
@@ -48,7 +59,9 @@ SGL_PY_EXPORT(core_logger)
         .def(nb::init<>());
 
     // clang-format off
-#define DEF_LOG_METHOD(name) def(#name, [](Logger& self, const std::string_view msg) { self.name(msg); }, "msg"_a)
+#define DEF_LOG_METHOD(name) \
+    def(#name, [](Logger& self, const std::string_view msg) { self.name(msg); }, "msg"_a, \
+        nb::call_guard<nb::gil_scoped_release>())
     // clang-format on
 
     nb::class_<Logger>(m, "Logger", D(Logger))
@@ -68,7 +81,32 @@ SGL_PY_EXPORT(core_logger)
         .def("use_same_outputs", &Logger::use_same_outputs, "other"_a, D(Logger, use_same_outputs))
         .def("remove_output", &Logger::remove_output, "output"_a, D(Logger, remove_output))
         .def("remove_all_outputs", &Logger::remove_all_outputs, D(Logger, remove_all_outputs))
-        .def("log", &Logger::log, "level"_a, "msg"_a, "frequency"_a = LogFrequency::always, D(Logger, log))
+        .def(
+            "log",
+            &Logger::log,
+            "level"_a,
+            "msg"_a,
+            "frequency"_a = LogFrequency::always,
+            nb::call_guard<nb::gil_scoped_release>(),
+            D(Logger, log)
+        )
+        .def(
+            "enable_async",
+            &Logger::enable_async,
+            "queue_capacity"_a = 4096,
+            "overflow_policy"_a = LogOverflowPolicy::block,
+            nb::call_guard<nb::gil_scoped_release>(),
+            D(Logger, enable_async)
+        )
+        .def(
+            "disable_async",
+            &Logger::disable_async,
+            nb::call_guard<nb::gil_scoped_release>(),
+            D(Logger, disable_async)
+        )
+        .def_prop_ro("is_async", &Logger::is_async, D(Logger, is_async))
+        .def_prop_ro("dropped_count", &Logger::dropped_count, D(Logger, dropped_count))
+        .def("flush", &Logger::flush, nb::call_guard<nb::gil_scoped_release>(), D(Logger, flush))
         .DEF_LOG_METHOD(debug)
         .DEF_LOG_METHOD(info)
         .DEF_LOG_METHOD(warn)
@@ -84,7 +122,8 @@ SGL_PY_EXPORT(core_logger)
 #undef DEF_LOG_METHOD
 
     // clang-format off
-#define DEF_LOG_FUNC(name) def(#name, [](const std::string_view msg) { name(msg); }, "msg"_a)
+#define DEF_LOG_FUNC(name) \
+    def(#name, [](const std::string_view msg) { name(msg); }, "msg"_a, nb::call_guard<nb::gil_scoped_release>())
     // clang-format on
 
     m.def(
@@ -94,6 +133,7 @@ SGL_PY_EXPORT(core_logger)
          "level"_a,
          "msg"_a,
          "frequency"_a = LogFrequency::always,
+         nb::call_guard<nb::gil_scoped_release>(),
          D(Logger, log)
     )
         .DEF_LOG_FUNC(log_debug)
@@ -4,6 +4,84 @@
 
 #include "sgl/core/struct.h"
 
+namespace sgl {
+
+/// Get the number of structs in a contiguous array.
+inline size_t get_struct_count(const Struct* layout, const nb::ndarray<nb::ro, nb::device::cpu>& array)
+{
+    SGL_CHECK(is_ndarray_contiguous(array) || array.size() == 0, "data is not contiguous");
+    SGL_CHECK(
+        array.nbytes() % layout->size() == 0,
+        "data size ({} bytes) is not a multiple of the struct size ({} bytes)",
+        array.nbytes(),
+        layout->size()
+    );
+    return array.nbytes() / layout->size();
+}
+
+static const char* __doc_sgl_struct_converter_convert_bytes
+    = R"doc(Convert data from source struct to destination struct (without holding the GIL).)doc";
+
+inline nb::bytes struct_converter_convert_bytes(const StructConverter* self, nb::bytes input)
+{
+    size_t count = input.size() / self->src()->size();
+    // Convert directly into an uninitialized bytes object.
+    PyObject* bytes = PyBytes_FromStringAndSize(nullptr, self->dst()->size() * count);
+    if (!bytes)
+        throw nb::python_error();
+    nb::bytes output = nb::steal<nb::bytes>(bytes);
+    {
+        nb::gil_scoped_release guard;
+        self->convert_parallel(input.c_str(), PyBytes_AS_STRING(output.ptr()), count);
+    }
+    return output;
+}
+
+static const char* __doc_sgl_struct_converter_convert_to_numpy
+    = R"doc(Convert data from a contiguous array to a numpy array of bytes (without holding the GIL).)doc";
+
+inline nb::ndarray<nb::numpy> struct_converter_convert_to_numpy(
+    const StructConverter* self,
+    nb::ndarray<nb::ro, nb::device::cpu> input
+)
+{
+    size_t count = get_struct_count(self->src(), input);
+    size_t size = self->dst()->size() * count;
+    // Hand the data to its owner before converting, so it is released if the conversion throws.
+    uint8_t* data = new uint8_t[size];
+    nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
+    {
+        nb::gil_scoped_release guard;
+        self->convert_parallel(input.data(), data, count);
+    }
+
+    size_t shape[1] = {size};
+    return nb::ndarray<nb::numpy>(data, 1, shape, owner, nullptr, nb::dtype<uint8_t>(), nb::device::cpu::value);
+}
+
+static const char* __doc_sgl_struct_converter_convert_into
+    = R"doc(Convert data between contiguous arrays in place (no intermediate copies, GIL released).)doc";
+
+inline void struct_converter_convert_into(
+    const StructConverter* self,
+    nb::ndarray<nb::ro, nb::device::cpu> input,
+    nb::ndarray<nb::device::cpu> output
+)
+{
+    size_t count = get_struct_count(self->src(), input);
+    size_t size = self->dst()->size() * count;
+    SGL_CHECK(is_ndarray_contiguous(output) || size == 0, "output is not contiguous");
+    SGL_CHECK(output.nbytes() >= size, "output is too small ({} bytes, expected {} bytes)", output.nbytes(), size);
+    const uint8_t* src = static_cast<const uint8_t*>(input.data());
+    const uint8_t* dst = static_cast<const uint8_t*>(output.data());
+    SGL_CHECK(src + input.nbytes() <= dst || dst + size <= src, "input and output must not overlap");
+
+    nb::gil_scoped_release guard;
+    self->convert_parallel(input.data(), output.data(), count);
+}
+
+} // namespace sgl
+
 SGL_PY_EXPORT(core_struct)
 {
     using namespace sgl;
@@ -87,6 +165,13 @@ SGL_PY_EXPORT(core_struct)
         .def_static("is_signed", &Struct::is_signed, D(Struct, is_signed))
         .def_static("is_float", &Struct::is_float, D(Struct, is_float));
 
+    nb::class_<StructConverterStats>(m, "StructConverterStats", D(StructConverterStats))
+        .def_ro("program_count", &StructConverterStats::program_count, D(StructConverterStats, program_count))
+        .def_ro("hit_count", &StructConverterStats::hit_count, D(StructConverterStats, hit_count))
+        .def_ro("miss_count", &StructConverterStats::miss_count, D(StructConverterStats, miss_count))
+        .def_ro("compile_time", &StructConverterStats::compile_time, D(StructConverterStats, compile_time))
+        .def_ro("code_size", &StructConverterStats::code_size, D(StructConverterStats, code_size));
+
     nb::class_<StructConverter, Object>(m, "StructConverter", D(StructConverter))
         .def(
             "__init__",
@@ -98,15 +183,9 @@ SGL_PY_EXPORT(core_struct)
         )
         .def_prop_ro("src", &StructConverter::src, D(StructConverter, src))
         .def_prop_ro("dst", &StructConverter::dst, D(StructConverter, dst))
-        .def(
-            "convert",
-            [](StructConverter* self, nb::bytes input) -> nb::bytes
-            {
-                size_t count = input.size() / self->src()->size();
-                std::string output(self->dst()->size() * count, '\0');
-                self->convert(input.c_str(), output.data(), count);
-                return nb::bytes(output.data(), output.size());
-            },
-            "input"_a
-        );
+        .def_prop_ro("program_kind", &StructConverter::program_kind, D(StructConverter, program_kind))
+        .def("convert", &struct_converter_convert_bytes, "input"_a, D(struct_converter_convert_bytes))
+        .def("convert", &struct_converter_convert_to_numpy, "input"_a, D(struct_converter_convert_to_numpy))
+        .def("convert", &struct_converter_convert_into, "input"_a, "output"_a, D(struct_converter_convert_into))
+        .def_static("stats", &StructConverter::stats, D(StructConverter, stats));
 }
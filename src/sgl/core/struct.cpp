@@ -51,6 +51,8 @@ derivative works thereof, in binary and source code form.
 #include "sgl/core/maths.h"
 #include "sgl/core/string.h"
 #include "sgl/core/hash.h"
+#include "sgl/core/thread.h"
+#include "sgl/core/timer.h"
 
 #include "sgl/math/float16.h"
 #include "sgl/math/colorspace.h"
@@ -64,11 +66,13 @@ derivative works thereof, in binary and source code form.
 #include <asmjit/arm/a64compiler.h>
 #endif
 
+#include <atomic>
 #include <limits>
 #include <unordered_map>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <utility>
 
 #define SGL_LOG_JIT_ASSEMBLY 0
@@ -260,6 +264,9 @@ struct Op {
         multiply_add,
         round,
         clamp,
+        // table driven conversions
+        lookup,
+        linear_to_srgb8,
     };
     Type type;
     uint8_t reg;
@@ -292,9 +299,99 @@ struct Op {
             double min;
             double max;
         } clamp;
+        struct {
+            const double* table;
+        } lookup;
     };
 };
 
+/**
+ * Lookup tables for fast sRGB conversions of narrow integer types.
+ *
+ * Decoding uses one table per 8/16-bit integer type, mapping each integer value to the
+ * (optionally normalized) linear value. Encoding to normalized 8-bit sRGB uses a table of
+ * the 255 decision boundaries between consecutive output values, which is searched
+ * with a branch-free binary search.
+ */
+struct SRGBTables {
+    /// Get the decode table for a source field or nullptr if the field cannot use a table.
+    /// The returned pointer can be indexed directly with the (signed) integer value.
+    static const double* decode_table(const Struct::Field& field)
+    {
+        if (!is_set(field.flags, Struct::Flags::srgb_gamma))
+            return nullptr;
+        if (field.type != Struct::Type::int8 && field.type != Struct::Type::uint8 && field.type != Struct::Type::int16
+            && field.type != Struct::Type::uint16)
+            return nullptr;
+        return get().get_decode_table(field.type, is_set(field.flags, Struct::Flags::normalized));
+    }
+
+    /// Check if a destination field can be encoded using \c linear_to_srgb8.
+    static bool can_encode(const Struct::Field& field)
+    {
+        return field.type == Struct::Type::uint8 && is_set(field.flags, Struct::Flags::normalized)
+            && is_set(field.flags, Struct::Flags::srgb_gamma);
+    }
+
+    /// Get the table of 255 encode thresholds used by \c linear_to_srgb8.
+    static const double* encode_thresholds() { return get().m_encode_thresholds; }
+
+    /// Encode a linear value to a normalized 8-bit sRGB value (returned as an integer valued double).
+    static double linear_to_srgb8(const double* thresholds, double x)
+    {
+        size_t k = 0;
+        for (size_t step = 128; step > 0; step >>= 1)
+            k += (x >= thresholds[k + step - 1]) ? step : 0;
+        return static_cast<double>(k);
+    }
+
+private:
+    SRGBTables()
+    {
+        // Reference encoding, matching linear_to_srgb + multiply + round + clamp.
+        auto encode = [](double x) { return std::clamp(std::nearbyint(math::linear_to_srgb(x) * 255.0), 0.0, 255.0); };
+
+        // Find the smallest value that encodes to k + 1, starting from the analytic boundary.
+        for (size_t k = 0; k < 255; ++k) {
+            double threshold = math::srgb_to_linear((k + 0.5) / 255.0);
+            while (encode(threshold) > k)
+                threshold = std::nextafter(threshold, -1.0);
+            while (encode(threshold) <= k)
+                threshold = std::nextafter(threshold, 2.0);
+            m_encode_thresholds[k] = threshold;
+        }
+    }
+
+    static SRGBTables& get()
+    {
+        static SRGBTables instance;
+        return instance;
+    }
+
+    const double* get_decode_table(Struct::Type type, bool normalized)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& table = m_decode_tables[std::make_pair(type, normalized)];
+        const auto range = Struct::type_range(type);
+        if (!table) {
+            // Use the same operations as the conversion program to get identical results.
+            size_t size = static_cast<size_t>(range.second - range.first) + 1;
+            table = std::make_unique<double[]>(size);
+            for (size_t i = 0; i < size; ++i) {
+                double value = range.first + static_cast<double>(i);
+                if (normalized)
+                    value *= 1.0 / range.second;
+                table[i] = math::srgb_to_linear(value);
+            }
+        }
+        return table.get() + static_cast<size_t>(-range.first);
+    }
+
+    std::mutex m_mutex;
+    std::map<std::pair<Struct::Type, bool>, std::unique_ptr<double[]>> m_decode_tables;
+    double m_encode_thresholds[255];
+};
+
 /// Virtual machine for running conversion programs.
 struct VM {
     struct Value {
@@ -384,6 +481,15 @@ struct VM {
                 SGL_ASSERT(value.type == Struct::Type::float64);
                 value.d = std::clamp(value.d, op.clamp.min, op.clamp.max);
                 break;
+            case Op::Type::lookup:
+                SGL_ASSERT(Struct::is_integer(value.type));
+                value.d = op.lookup.table[Struct::is_unsigned(value.type) ? static_cast<int64_t>(value.u) : value.i];
+                value.type = Struct::Type::float64;
+                break;
+            case Op::Type::linear_to_srgb8:
+                SGL_ASSERT(value.type == Struct::Type::float64);
+                value.d = SRGBTables::linear_to_srgb8(op.lookup.table, value.d);
+                break;
             }
         }
     }
@@ -545,20 +651,25 @@ std::vector<Op> generate_code(const Struct& src_struct, const Struct& dst_struct
                          .load_mem = {src_field.offset, src_field.type, src_swap}}
                     );
 
-                    // Convert to double.
-                    code.push_back(
-                        {.type = Op::Type::cast, .reg = src_reg, .cast = {src_field.type, Struct::Type::float64}}
-                    );
-
-                    // Normalize source value.
-                    if (Struct::is_integer(src_field.type) && is_set(src_field.flags, Struct::Flags::normalized))
+                    if (const double* table = SRGBTables::decode_table(src_field)) {
+                        // Convert, normalize and linearize source value using a lookup table.
+                        code.push_back({.type = Op::Type::lookup, .reg = src_reg, .lookup = {table}});
+                    } else {
+                        // Convert to double.
                         code.push_back(
-                            {.type = Op::Type::multiply, .reg = src_reg, .multiply = {1.0 / src_range.second}}
+                            {.type = Op::Type::cast, .reg = src_reg, .cast = {src_field.type, Struct::Type::float64}}
                         );
 
-                    // Linearize source value.
-                    if (is_set(src_field.flags, Struct::Flags::srgb_gamma))
-                        code.push_back({.type = Op::Type::srgb_to_linear, .reg = src_reg});
+                        // Normalize source value.
+                        if (Struct::is_integer(src_field.type) && is_set(src_field.flags, Struct::Flags::normalized))
+                            code.push_back(
+                                {.type = Op::Type::multiply, .reg = src_reg, .multiply = {1.0 / src_range.second}}
+                            );
+
+                        // Linearize source value.
+                        if (is_set(src_field.flags, Struct::Flags::srgb_gamma))
+                            code.push_back({.type = Op::Type::srgb_to_linear, .reg = src_reg});
+                    }
                 }
 
                 // Add weighted value to accumulator.
@@ -566,18 +677,25 @@ std::vector<Op> generate_code(const Struct& src_struct, const Struct& dst_struct
             }
             const auto dst_range = Struct::type_range(dst_field.type);
 
-            // De-linearize destination value.
-            if (is_set(dst_field.flags, Struct::Flags::srgb_gamma))
-                code.push_back({.type = Op::Type::linear_to_srgb, .reg = 0});
+            if (SRGBTables::can_encode(dst_field)) {
+                // De-linearize, de-normalize, round and clamp destination value using a lookup table.
+                code.push_back(
+                    {.type = Op::Type::linear_to_srgb8, .reg = 0, .lookup = {SRGBTables::encode_thresholds()}}
+                );
+            } else {
+                // De-linearize destination value.
+                if (is_set(dst_field.flags, Struct::Flags::srgb_gamma))
+                    code.push_back({.type = Op::Type::linear_to_srgb, .reg = 0});
 
-            // De-normalize destination value.
-            if (Struct::is_integer(dst_field.type) && is_set(dst_field.flags, Struct::Flags::normalized))
-                code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {dst_range.second}});
+                // De-normalize destination value.
+                if (Struct::is_integer(dst_field.type) && is_set(dst_field.flags, Struct::Flags::normalized))
+                    code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {dst_range.second}});
 
-            // Round and clamp integers.
-            if (Struct::is_integer(dst_field.type)) {
-                code.push_back({.type = Op::Type::round, .reg = 0});
-                code.push_back({.type = Op::Type::clamp, .reg = 0, .clamp = {dst_range.first, dst_range.second}});
+                // Round and clamp integers.
+                if (Struct::is_integer(dst_field.type)) {
+                    code.push_back({.type = Op::Type::round, .reg = 0});
+                    code.push_back({.type = Op::Type::clamp, .reg = 0, .clamp = {dst_range.first, dst_range.second}});
+                }
             }
 
             code.push_back({.type = Op::Type::cast, .reg = 0, .cast = {Struct::Type::float64, dst_field.type}});
@@ -601,29 +719,43 @@ std::vector<Op> generate_code(const Struct& src_struct, const Struct& dst_struct
                 const auto src_range = Struct::type_range(src_field.type);
                 const auto dst_range = Struct::type_range(dst_field.type);
 
-                // Convert to double.
-                code.push_back({.type = Op::Type::cast, .reg = 0, .cast = {src_field.type, Struct::Type::float64}});
+                if (const double* table = SRGBTables::decode_table(src_field)) {
+                    // Convert, normalize and linearize source value using a lookup table.
+                    code.push_back({.type = Op::Type::lookup, .reg = 0, .lookup = {table}});
+                } else {
+                    // Convert to double.
+                    code.push_back({.type = Op::Type::cast, .reg = 0, .cast = {src_field.type, Struct::Type::float64}});
 
-                // Normalize source value.
-                if (Struct::is_integer(src_field.type) && is_set(src_field.flags, Struct::Flags::normalized))
-                    code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {1.0 / src_range.second}});
+                    // Normalize source value.
+                    if (Struct::is_integer(src_field.type) && is_set(src_field.flags, Struct::Flags::normalized))
+                        code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {1.0 / src_range.second}});
 
-                // Linearize source value.
-                if (is_set(src_field.flags, Struct::Flags::srgb_gamma))
-                    code.push_back({.type = Op::Type::srgb_to_linear, .reg = 0});
+                    // Linearize source value.
+                    if (is_set(src_field.flags, Struct::Flags::srgb_gamma))
+                        code.push_back({.type = Op::Type::srgb_to_linear, .reg = 0});
+                }
 
-                // De-linearize destination value.
-                if (is_set(dst_field.flags, Struct::Flags::srgb_gamma))
-                    code.push_back({.type = Op::Type::linear_to_srgb, .reg = 0});
+                if (SRGBTables::can_encode(dst_field)) {
+                    // De-linearize, de-normalize, round and clamp destination value using a lookup table.
+                    code.push_back(
+                    {.type = Op::Type::linear_to_srgb8, .reg = 0, .lookup = {SRGBTables::encode_thresholds()}}
+                );
+                } else {
+                    // De-linearize destination value.
+                    if (is_set(dst_field.flags, Struct::Flags::srgb_gamma))
+                        code.push_back({.type = Op::Type::linear_to_srgb, .reg = 0});
 
-                // De-normalize destination value.
-                if (Struct::is_integer(dst_field.type) && is_set(dst_field.flags, Struct::Flags::normalized))
-                    code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {dst_range.second}});
+                    // De-normalize destination value.
+                    if (Struct::is_integer(dst_field.type) && is_set(dst_field.flags, Struct::Flags::normalized))
+                        code.push_back({.type = Op::Type::multiply, .reg = 0, .multiply = {dst_range.second}});
 
-                // Round and clamp integers.
-                if (Struct::is_integer(dst_field.type)) {
-                    code.push_back({.type = Op::Type::round, .reg = 0});
-                    code.push_back({.type = Op::Type::clamp, .reg = 0, .clamp = {dst_range.first, dst_range.second}});
+                    // Round and clamp integers.
+                    if (Struct::is_integer(dst_field.type)) {
+                        code.push_back({.type = Op::Type::round, .reg = 0});
+                        code.push_back(
+                            {.type = Op::Type::clamp, .reg = 0, .clamp = {dst_range.first, dst_range.second}}
+                        );
+                    }
                 }
 
                 code.push_back({.type = Op::Type::cast, .reg = 0, .cast = {Struct::Type::float64, dst_field.type}});
@@ -651,8 +783,13 @@ std::vector<Op> generate_code(const Struct& src_struct, const Struct& dst_struct
 
 /// Interface for conversion programs.
 struct Program {
+    /// Size of the program code in bytes.
+    size_t code_size{0};
+
     virtual ~Program() = default;
     virtual void execute(const void* src, void* dst, size_t count) const = 0;
+    /// Kind of the program (see \c StructConverter::program_kind).
+    virtual const char* kind() const = 0;
 };
 
 /// Conversion program for the virtual machine.
@@ -674,16 +811,399 @@ struct VMProgram : public Program {
         }
     }
 
+    const char* kind() const override { return "vm"; }
+
     static std::unique_ptr<Program> compile(const Struct& src_struct, const Struct& dst_struct)
     {
         auto program = std::make_unique<VMProgram>();
         program->code = generate_code(src_struct, dst_struct);
         program->src_size = src_struct.size();
         program->dst_size = dst_struct.size();
+        program->code_size = program->code.size() * sizeof(Op);
+        return program;
+    }
+};
+
+// Compile the batch kernels of the SIMD program for multiple x86 instruction sets.
+// The best variant is selected at load time based on the available CPU features.
+#if SGL_X86_64 && SGL_LINUX && SGL_GCC
+#define SGL_SIMD_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define SGL_SIMD_TARGET_CLONES
+#endif
+
+/**
+ * Conversion program processing multiple structs at once.
+ *
+ * Instead of running the whole program for a single struct, each op is applied to
+ * a batch of \c WIDTH structs before moving to the next op. Registers are stored as
+ * arrays of lanes, which allows the compiler to use SIMD instructions for all the
+ * arithmetic. Results are bit-exact with the scalar programs. Lanes are float32 for plain
+ * type conversions of values that can be represented exactly (no normalization, gamma
+ * correction or blending), otherwise float64. 64-bit integer fields are not supported
+ * and fall back to the scalar programs.
+ */
+template<typename T>
+struct SIMDProgram : public Program {
+    static constexpr size_t WIDTH = 16;
+    static constexpr size_t REGISTER_COUNT = 8;
+
+    std::vector<Op> code;
+    size_t src_size;
+    size_t dst_size;
+
+    void execute(const void* src, void* dst, size_t count) const override
+    {
+        const uint8_t* src_ptr = static_cast<const uint8_t*>(src);
+        uint8_t* dst_ptr = static_cast<uint8_t*>(dst);
+        while (count > 0) {
+            size_t n = std::min(count, WIDTH);
+            run_batch(code.data(), code.size(), src_ptr, dst_ptr, n, src_size, dst_size);
+            src_ptr += n * src_size;
+            dst_ptr += n * dst_size;
+            count -= n;
+        }
+    }
+
+    const char* kind() const override { return std::is_same_v<T, float> ? "simd_float" : "simd_double"; }
+
+    /// Check if the conversion can be done with \c T lanes without loss of precision.
+    static bool is_supported(std::span<const Op> code)
+    {
+        for (const Op& op : code) {
+            if (op.reg >= REGISTER_COUNT)
+                return false;
+            if (op.type == Op::Type::multiply_add && op.multiply_add.reg >= REGISTER_COUNT)
+                return false;
+            if (op.type == Op::Type::load_mem && !is_type_supported(op.load_mem.type))
+                return false;
+            if (op.type == Op::Type::save_mem && !is_type_supported(op.save_mem.type))
+                return false;
+            // Single precision lanes are only bit-exact with the scalar programs (which compute in double precision)
+            // if no op rounds an intermediate result, i.e. for plain type conversions of exactly representable values.
+            if constexpr (std::is_same_v<T, float>) {
+                switch (op.type) {
+                case Op::Type::load_mem:
+                case Op::Type::save_mem:
+                case Op::Type::cast:
+                case Op::Type::round:
+                    break;
+                case Op::Type::load_imm:
+                    if (!is_exact(op.load_imm.value))
+                        return false;
+                    break;
+                case Op::Type::clamp:
+                    if (!is_exact(op.clamp.min) || !is_exact(op.clamp.max))
+                        return false;
+                    break;
+                default:
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static std::unique_ptr<Program> compile(const Struct& src_struct, const Struct& dst_struct)
+    {
+        std::vector<Op> code = generate_code(src_struct, dst_struct);
+        if (!is_supported(code))
+            return nullptr;
+        auto program = std::make_unique<SIMDProgram>();
+        program->code = std::move(code);
+        program->src_size = src_struct.size();
+        program->dst_size = dst_struct.size();
+        program->code_size = program->code.size() * sizeof(Op);
         return program;
     }
+
+private:
+    static bool is_exact(double value) { return static_cast<double>(static_cast<T>(value)) == value; }
+
+    static bool is_type_supported(Struct::Type type)
+    {
+        switch (type) {
+        case Struct::Type::int8:
+        case Struct::Type::uint8:
+        case Struct::Type::int16:
+        case Struct::Type::uint16:
+        case Struct::Type::float16:
+        case Struct::Type::float32:
+            return true;
+        case Struct::Type::int32:
+        case Struct::Type::uint32:
+        case Struct::Type::float64:
+            return std::is_same_v<T, double>;
+        case Struct::Type::int64:
+        case Struct::Type::uint64:
+            return false;
+        }
+        return false;
+    }
+
+    SGL_SIMD_TARGET_CLONES static void run_batch(
+        const Op* code,
+        size_t op_count,
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t n,
+        size_t src_stride,
+        size_t dst_stride
+    )
+    {
+        alignas(64) T registers[REGISTER_COUNT][WIDTH];
+
+        for (size_t op_index = 0; op_index < op_count; ++op_index) {
+            const Op& op = code[op_index];
+            T* value = registers[op.reg];
+            switch (op.type) {
+            case Op::Type::load_mem:
+                load(value, src + op.load_mem.offset, src_stride, n, op.load_mem.type, op.load_mem.swap);
+                break;
+            case Op::Type::load_imm:
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = static_cast<T>(op.load_imm.value);
+                break;
+            case Op::Type::save_mem:
+                save(dst + op.save_mem.offset, dst_stride, value, n, op.save_mem.type, op.save_mem.swap);
+                break;
+            case Op::Type::cast:
+                // Lanes always hold the numeric value, only the conversion to the target type needs handling.
+                if (Struct::is_integer(op.cast.to)) {
+                    for (size_t i = 0; i < n; ++i)
+                        value[i] = std::trunc(value[i]);
+                } else if (op.cast.to != Struct::Type::float64) {
+                    for (size_t i = 0; i < n; ++i)
+                        value[i] = static_cast<T>(static_cast<float>(value[i]));
+                }
+                break;
+            case Op::Type::linear_to_srgb:
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = linear_to_srgb(value[i]);
+                break;
+            case Op::Type::srgb_to_linear:
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = srgb_to_linear(value[i]);
+                break;
+            case Op::Type::multiply: {
+                const T factor = static_cast<T>(op.multiply.value);
+                for (size_t i = 0; i < n; ++i)
+                    value[i] *= factor;
+                break;
+            }
+            case Op::Type::multiply_add: {
+                const T* other = registers[op.multiply_add.reg];
+                const T factor = static_cast<T>(op.multiply_add.factor);
+                for (size_t i = 0; i < n; ++i)
+                    value[i] += other[i] * factor;
+                break;
+            }
+            case Op::Type::round:
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = std::nearbyint(value[i]);
+                break;
+            case Op::Type::clamp: {
+                const T min = static_cast<T>(op.clamp.min);
+                const T max = static_cast<T>(op.clamp.max);
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = std::min(std::max(value[i], min), max);
+                break;
+            }
+            case Op::Type::lookup:
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = static_cast<T>(op.lookup.table[static_cast<int64_t>(value[i])]);
+                break;
+            case Op::Type::linear_to_srgb8: {
+                const double* thresholds = op.lookup.table;
+                for (size_t i = 0; i < n; ++i)
+                    value[i] = static_cast<T>(SRGBTables::linear_to_srgb8(thresholds, value[i]));
+                break;
+            }
+            }
+        }
+    }
+
+    /// Load a field of \c n structs into lanes, converting the stored value with \c convert.
+    template<typename S, typename F>
+    static void load_lanes(T* value, const uint8_t* src, size_t stride, size_t n, bool swap, F convert)
+    {
+        if constexpr (sizeof(S) > 1) {
+            if (swap) [[unlikely]] {
+                for (size_t i = 0; i < n; ++i) {
+                    S v;
+                    std::memcpy(&v, src + i * stride, sizeof(S));
+                    value[i] = static_cast<T>(convert(stdx::byteswap(v)));
+                }
+                return;
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            S v;
+            std::memcpy(&v, src + i * stride, sizeof(S));
+            value[i] = static_cast<T>(convert(v));
+        }
+    }
+
+    /// Convert lanes with \c convert and save them to a field of \c n structs.
+    template<typename S, typename F>
+    static void save_lanes(uint8_t* dst, size_t stride, const T* value, size_t n, bool swap, F convert)
+    {
+        if constexpr (sizeof(S) > 1) {
+            if (swap) [[unlikely]] {
+                for (size_t i = 0; i < n; ++i) {
+                    S v = stdx::byteswap(static_cast<S>(convert(value[i])));
+                    std::memcpy(dst + i * stride, &v, sizeof(S));
+                }
+                return;
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            S v = static_cast<S>(convert(value[i]));
+            std::memcpy(dst + i * stride, &v, sizeof(S));
+        }
+    }
+
+    /// Load a field of \c n structs into lanes.
+    static void load(T* value, const uint8_t* src, size_t stride, size_t n, Struct::Type type, bool swap)
+    {
+        auto identity = [](auto v) { return v; };
+        auto from_float16 = [](uint16_t v) { return math::float16_to_float32(v); };
+        auto from_float32 = [](uint32_t v) { return stdx::bit_cast<float>(v); };
+        auto from_float64 = [](uint64_t v) { return stdx::bit_cast<double>(v); };
+        switch (type) {
+        case Struct::Type::int8:
+            return load_lanes<int8_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::uint8:
+            return load_lanes<uint8_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::int16:
+            return load_lanes<int16_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::uint16:
+            return load_lanes<uint16_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::int32:
+            return load_lanes<int32_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::uint32:
+            return load_lanes<uint32_t>(value, src, stride, n, swap, identity);
+        case Struct::Type::float16:
+            return load_lanes<uint16_t>(value, src, stride, n, swap, from_float16);
+        case Struct::Type::float32:
+            return load_lanes<uint32_t>(value, src, stride, n, swap, from_float32);
+        case Struct::Type::float64:
+            return load_lanes<uint64_t>(value, src, stride, n, swap, from_float64);
+        default:
+            std::fill_n(value, n, T(0));
+            break;
+        }
+    }
+
+    /// Convert lanes to the destination type and save them to a field of \c n structs.
+    static void save(uint8_t* dst, size_t stride, const T* value, size_t n, Struct::Type type, bool swap)
+    {
+        auto to_integer = [](T v) { return static_cast<int64_t>(v); };
+        auto to_float16 = [](T v) { return math::float32_to_float16(static_cast<float>(v)); };
+        auto to_float32 = [](T v) { return stdx::bit_cast<uint32_t>(static_cast<float>(v)); };
+        auto to_float64 = [](T v) { return stdx::bit_cast<uint64_t>(static_cast<double>(v)); };
+        switch (type) {
+        case Struct::Type::int8:
+            return save_lanes<int8_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::uint8:
+            return save_lanes<uint8_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::int16:
+            return save_lanes<int16_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::uint16:
+            return save_lanes<uint16_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::int32:
+            return save_lanes<int32_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::uint32:
+            return save_lanes<uint32_t>(dst, stride, value, n, swap, to_integer);
+        case Struct::Type::float16:
+            return save_lanes<uint16_t>(dst, stride, value, n, swap, to_float16);
+        case Struct::Type::float32:
+            return save_lanes<uint32_t>(dst, stride, value, n, swap, to_float32);
+        case Struct::Type::float64:
+            return save_lanes<uint64_t>(dst, stride, value, n, swap, to_float64);
+        default:
+            break;
+        }
+    }
+
+    /// Branch-free sRGB encoding using the same rational polynomial fit as the JIT programs.
+    static T linear_to_srgb(T x)
+    {
+        static constexpr double P[] = {
+            -0.0031151377052754843,
+            0.5838023820686707,
+            8.450947414259522,
+            27.901125077137042,
+            32.44669922192121,
+            15.374469584296442,
+            3.0477578489880823,
+            0.2263810267005674,
+            0.002531335520959116,
+            -0.00021805827098915798,
+            -3.7113872202050023e-6,
+        };
+        static constexpr double Q[] = {
+            1.,
+            10.723011300050162,
+            29.70548706952188,
+            30.50364355650628,
+            13.297981743005433,
+            2.575446652731678,
+            0.21749170309546628,
+            0.007244514696840552,
+            0.00007045228641004039,
+            -8.387527630781522e-9,
+            2.2380622409188757e-11,
+        };
+        T y = std::sqrt(std::max(x, T(0)));
+        T p = T(P[0]);
+        T q = T(Q[0]);
+        for (size_t i = 1; i < std::size(P); ++i) {
+            p = p * y + T(P[i]);
+            q = q * y + T(Q[i]);
+        }
+        return x < T(0.0031308) ? x * T(12.92) : x * p / q;
+    }
+
+    /// Branch-free sRGB decoding using the same rational polynomial fit as the JIT programs.
+    static T srgb_to_linear(T x)
+    {
+        static constexpr double P[] = {
+            -342.62884098034357,
+            -3483.4445569178347,
+            -9735.250875334352,
+            -10782.158977031822,
+            -5548.704065887224,
+            -1446.951694673217,
+            -200.19589605282445,
+            -14.786385491859248,
+            -0.5489744177844188,
+            -0.008042950896814532,
+        };
+        static constexpr double Q[] = {
+            1.,
+            -84.8098437770271,
+            -1884.7738197074218,
+            -8059.219012060384,
+            -11916.470977597566,
+            -7349.477378676199,
+            -2013.8039726540235,
+            -237.47722999429413,
+            -9.646075249097724,
+            -2.2132610916769585e-8,
+        };
+        T p = T(P[0]);
+        T q = T(Q[0]);
+        for (size_t i = 1; i < std::size(P); ++i) {
+            p = p * x + T(P[i]);
+            q = q * x + T(Q[i]);
+        }
+        return x < T(0.04045) ? x * T(1.0 / 12.92) : x * p / q;
+    }
 };
 
+#undef SGL_SIMD_TARGET_CLONES
+
 #if SGL_HAS_ASMJIT
 
 /// Conversion program running just-in-time compiled X86 code.
@@ -694,6 +1214,8 @@ struct X86Program : public Program {
 
     void execute(const void* src, void* dst, size_t count) const override { func(src, dst, count); }
 
+    const char* kind() const override { return "x86"; }
+
     static std::unique_ptr<Program> compile(const Struct& src_struct, const Struct& dst_struct)
     {
         asmjit::CodeHolder code;
@@ -724,6 +1246,7 @@ struct X86Program : public Program {
 
         auto program = std::make_unique<X86Program>();
         program->func = func;
+        program->code_size = code.codeSize();
         return program;
     }
 
@@ -1021,6 +1544,34 @@ private:
                     minsd(reg.xmm, const_(op.clamp.max));
                     break;
                 }
+                case Op::Type::lookup: {
+                    Register& reg = get_register(op.reg);
+                    comment(fmt::format("lookup (reg={}, table={})", reg.index, (void*)op.lookup.table));
+                    x86::Gp table = c.newIntPtr();
+                    c.mov(table, imm(op.lookup.table));
+                    reg.xmm = c.newXmm();
+                    movsd(reg.xmm, x86::qword_ptr(table, reg.gp.r64(), 3));
+                    break;
+                }
+                case Op::Type::linear_to_srgb8: {
+                    Register& reg = get_register(op.reg);
+                    comment(fmt::format("linear_to_srgb8 (reg={}, table={})", reg.index, (void*)op.lookup.table));
+                    // Inlined branch-free binary search, see SRGBTables::linear_to_srgb8.
+                    // NaN compares unordered (CF=1), so it never advances and encodes to 0.
+                    x86::Gp table = c.newIntPtr();
+                    c.mov(table, imm(op.lookup.table));
+                    x86::Gp k = c.newInt64();
+                    x86::Gp next = c.newInt64();
+                    c.xor_(k, k);
+                    for (int32_t step = 128; step > 0; step >>= 1) {
+                        c.lea(next, x86::ptr(k, step));
+                        ucomisd(reg.xmm, x86::qword_ptr(table, k, 3, (step - 1) * int32_t(sizeof(double))));
+                        c.cmovae(k, next);
+                    }
+                    reg.xmm = c.newXmm();
+                    cvtsi2sd(reg.xmm, k);
+                    break;
+                }
                 }
             }
 
@@ -1414,6 +1965,8 @@ struct ARMProgram : public Program {
 
     void execute(const void* src, void* dst, size_t count) const override { func(src, dst, count); }
 
+    const char* kind() const override { return "arm64"; }
+
     static std::unique_ptr<Program> compile(const Struct& src_struct, const Struct& dst_struct)
     {
         // TODO: check cpu features, but for some reason these are all false
@@ -1428,6 +1981,11 @@ struct ARMProgram : public Program {
             return nullptr;
         }
 
+        // Table driven conversions are not supported by the AArch64 JIT, use the VM instead.
+        for (const Op& op : generate_code(src_struct, dst_struct))
+            if (op.type == Op::Type::lookup || op.type == Op::Type::linear_to_srgb8)
+                return nullptr;
+
         asmjit::CodeHolder code;
         code.init(runtime().environment(), runtime().cpuFeatures());
 
@@ -1458,8 +2016,9 @@ struct ARMProgram : public Program {
         ConvertFunc func;
         runtime().add(&func, &code);
 
-        auto program = std::make_unique<X86Program>();
+        auto program = std::make_unique<ARMProgram>();
         program->func = func;
+        program->code_size = code.codeSize();
         return program;
     }
 
@@ -1615,6 +2174,9 @@ private:
                     c.fmin(reg.vec, reg.vec, tmax);
                     break;
                 }
+                case Op::Type::lookup:
+                case Op::Type::linear_to_srgb8:
+                    SGL_UNREACHABLE();
                 }
             }
 
@@ -1968,14 +2530,41 @@ class ProgramCache {
 public:
     const Program* get_program(const Struct& src_struct, const Struct& dst_struct)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // Fast path: look up an existing program under a shared lock without copying the structs.
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_programs.find(KeyView{&src_struct, &dst_struct});
+            if (it != m_programs.end()) {
+                m_hit_count.fetch_add(1, std::memory_order_relaxed);
+                return it->second.get();
+            }
+        }
 
-        auto key = std::make_pair(src_struct, dst_struct);
-        auto it = m_programs.find(key);
-        if (it != m_programs.end())
-            return it->second.get();
-        auto [it2, inserted] = m_programs.emplace(key, compile_program(src_struct, dst_struct));
-        return it2->second.get();
+        // Compile outside of the lock to not block other threads.
+        // If multiple threads compile the same program, the first one to finish wins.
+        Timer timer;
+        std::unique_ptr<Program> program = compile_program(src_struct, dst_struct);
+        double compile_time = timer.elapsed_s();
+
+        std::unique_lock lock(m_mutex);
+        m_miss_count++;
+        m_compile_time += compile_time;
+        auto [it, inserted] = m_programs.emplace(std::make_pair(src_struct, dst_struct), std::move(program));
+        if (inserted && it->second)
+            m_code_size += it->second->code_size;
+        return it->second.get();
+    }
+
+    StructConverterStats stats() const
+    {
+        std::shared_lock lock(m_mutex);
+        return {
+            .program_count = m_programs.size(),
+            .hit_count = m_hit_count.load(std::memory_order_relaxed),
+            .miss_count = m_miss_count,
+            .compile_time = m_compile_time,
+            .code_size = m_code_size,
+        };
     }
 
     static ProgramCache& get()
@@ -1985,30 +2574,56 @@ public:
     }
 
 private:
+    using Key = std::pair<Struct, Struct>;
+    using KeyView = std::pair<const Struct*, const Struct*>;
+
+    /// Hasher/comparator allowing lookups by \c KeyView without constructing a \c Key.
+    struct KeyHasher {
+        using is_transparent = void;
+        size_t operator()(const Key& key) const { return hash(key); }
+        size_t operator()(const KeyView& key) const { return hash_combine(hash(*key.first), hash(*key.second)); }
+    };
+
+    struct KeyComparator {
+        using is_transparent = void;
+        bool operator()(const Key& lhs, const Key& rhs) const { return lhs == rhs; }
+        bool operator()(const KeyView& lhs, const Key& rhs) const
+        {
+            return *lhs.first == rhs.first && *lhs.second == rhs.second;
+        }
+        bool operator()(const Key& lhs, const KeyView& rhs) const { return operator()(rhs, lhs); }
+    };
+
     std::unique_ptr<Program> compile_program(const Struct& src_struct, const Struct& dst_struct)
     {
-        std::unique_ptr<Program> program;
+        // Prefer vectorized programs (using single precision lanes if possible) over the JIT programs,
+        // which convert one struct at a time. The JIT handles structs the vectorized programs don't support.
+        std::unique_ptr<Program> program = SIMDProgram<float>::compile(src_struct, dst_struct);
+        if (!program)
+            program = SIMDProgram<double>::compile(src_struct, dst_struct);
 
 #if SGL_HAS_ASMJIT
 #if SGL_X86_64
-        program = X86Program::compile(src_struct, dst_struct);
+        if (!program)
+            program = X86Program::compile(src_struct, dst_struct);
 #elif SGL_ARM64
-        program = ARMProgram::compile(src_struct, dst_struct);
+        if (!program)
+            program = ARMProgram::compile(src_struct, dst_struct);
 #endif
 #endif // SGL_HAS_ASMJIT
+
         if (!program)
             program = VMProgram::compile(src_struct, dst_struct);
 
         return program;
     }
 
-    std::mutex m_mutex;
-    std::unordered_map<
-        std::pair<Struct, Struct>,
-        std::unique_ptr<Program>,
-        hasher<std::pair<Struct, Struct>>,
-        comparator<std::pair<Struct, Struct>>>
-        m_programs;
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<Key, std::unique_ptr<Program>, KeyHasher, KeyComparator> m_programs;
+    std::atomic<size_t> m_hit_count{0};
+    size_t m_miss_count{0};
+    double m_compile_time{0.0};
+    size_t m_code_size{0};
 };
 
 
@@ -2031,6 +2646,100 @@ void StructConverter::convert(const void* src, void* dst, size_t count) const
     program->execute(src, dst, count);
 }
 
+void StructConverter::convert_parallel(const void* src, void* dst, size_t count, BS::thread_pool* pool) const
+{
+    const size_t src_size = m_src->size();
+    const size_t dst_size = m_dst->size();
+    const size_t bytes_per_struct = std::max(src_size + dst_size, size_t(1));
+
+    if (count * bytes_per_struct < PARALLEL_THRESHOLD) {
+        convert(src, dst, count);
+        return;
+    }
+
+    const Program* program = nullptr;
+    if (*m_src != *m_dst) {
+        program = ProgramCache::get().get_program(*m_src, *m_dst);
+        SGL_CHECK(program, "Failed to compile conversion program.");
+    }
+
+    const uint8_t* src_ptr = static_cast<const uint8_t*>(src);
+    uint8_t* dst_ptr = static_cast<uint8_t*>(dst);
+    size_t chunk_size = std::max(PARALLEL_CHUNK_SIZE / bytes_per_struct, size_t(1));
+
+    thread::parallel_for(
+        count,
+        chunk_size,
+        [&](size_t begin, size_t end)
+        {
+            const uint8_t* chunk_src = src_ptr + begin * src_size;
+            uint8_t* chunk_dst = dst_ptr + begin * dst_size;
+            if (program)
+                program->execute(chunk_src, chunk_dst, end - begin);
+            else
+                std::memcpy(chunk_dst, chunk_src, (end - begin) * src_size);
+        },
+        pool
+    );
+}
+
+void StructConverter::convert_rows(
+    const void* src,
+    ptrdiff_t src_row_pitch,
+    void* dst,
+    ptrdiff_t dst_row_pitch,
+    size_t count,
+    size_t row_count,
+    BS::thread_pool* pool
+) const
+{
+    const Program* program = nullptr;
+    if (*m_src != *m_dst) {
+        program = ProgramCache::get().get_program(*m_src, *m_dst);
+        SGL_CHECK(program, "Failed to compile conversion program.");
+    }
+
+    const size_t src_size = m_src->size();
+    const size_t dst_size = m_dst->size();
+    const uint8_t* src_ptr = static_cast<const uint8_t*>(src);
+    uint8_t* dst_ptr = static_cast<uint8_t*>(dst);
+
+    auto convert_range = [&](size_t begin, size_t end)
+    {
+        for (size_t row = begin; row < end; ++row) {
+            const uint8_t* row_src = src_ptr + static_cast<ptrdiff_t>(row) * src_row_pitch;
+            uint8_t* row_dst = dst_ptr + static_cast<ptrdiff_t>(row) * dst_row_pitch;
+            if (program)
+                program->execute(row_src, row_dst, count);
+            else
+                std::memcpy(row_dst, row_src, count * src_size);
+        }
+    };
+
+    // Convert rows in parallel, processing multiple rows per chunk.
+    const size_t bytes_per_row = std::max(count * (src_size + dst_size), size_t(1));
+    if (row_count * bytes_per_row < PARALLEL_THRESHOLD) {
+        convert_range(0, row_count);
+        return;
+    }
+    const size_t rows_per_chunk = std::max(PARALLEL_CHUNK_SIZE / bytes_per_row, size_t(1));
+    thread::parallel_for(row_count, rows_per_chunk, convert_range, pool);
+}
+
+std::string StructConverter::program_kind() const
+{
+    if (*m_src == *m_dst)
+        return "copy";
+    const Program* program = ProgramCache::get().get_program(*m_src, *m_dst);
+    SGL_CHECK(program, "Failed to compile conversion program.");
+    return program->kind();
+}
+
+StructConverterStats StructConverter::stats()
+{
+    return ProgramCache::get().stats();
+}
+
 std::string StructConverter::to_string() const
 {
     return fmt::format(
@@ -52,6 +52,10 @@
 
 #include <utility>
 
+namespace BS {
+class thread_pool;
+}
+
 namespace sgl {
 
 /**
@@ -325,6 +329,20 @@ SGL_ENUM_REGISTER(Struct::Flags);
 SGL_ENUM_CLASS_OPERATORS(Struct::Flags);
 SGL_ENUM_REGISTER(Struct::ByteOrder);
 
+/// Statistics of the conversion program cache shared by all struct converters.
+struct StructConverterStats {
+    /// Number of conversion programs in the cache.
+    size_t program_count{0};
+    /// Number of lookups that found an already compiled program.
+    size_t hit_count{0};
+    /// Number of lookups that had to compile a program.
+    size_t miss_count{0};
+    /// Total time spent compiling programs in seconds.
+    double compile_time{0.0};
+    /// Total size of the cached programs in bytes.
+    size_t code_size{0};
+};
+
 /**
  * \brief Struct converter.
  *
@@ -350,6 +368,49 @@ public:
     /// \param count Number of structs to convert.
     void convert(const void* src, void* dst, size_t count) const;
 
+    /// Minimum amount of data (source and destination bytes) for \c convert_parallel to use multiple threads.
+    static constexpr size_t PARALLEL_THRESHOLD = 1024 * 1024;
+
+    /// Amount of data (source and destination bytes) converted per chunk by \c convert_parallel.
+    static constexpr size_t PARALLEL_CHUNK_SIZE = 256 * 1024;
+
+    /// Convert data from source struct to destination struct using multiple threads.
+    /// The data is split into cache-sized chunks that are converted in parallel.
+    /// Conversions of less than \c PARALLEL_THRESHOLD bytes are done on the calling thread.
+    /// \param src Source data.
+    /// \param dst Destination data.
+    /// \param count Number of structs to convert.
+    /// \param pool Thread pool to use (defaults to the global thread pool).
+    void convert_parallel(const void* src, void* dst, size_t count, BS::thread_pool* pool = nullptr) const;
+
+    /// Convert rows of structs between strided source and destination data.
+    /// The conversion program is looked up once for all rows. Rows are converted in parallel
+    /// if the amount of data exceeds \c PARALLEL_THRESHOLD bytes.
+    /// \param src Source data (first row).
+    /// \param src_row_pitch Offset between source rows in bytes (negative to convert rows bottom-up).
+    /// \param dst Destination data (first row).
+    /// \param dst_row_pitch Offset between destination rows in bytes.
+    /// \param count Number of structs per row.
+    /// \param row_count Number of rows to convert.
+    /// \param pool Thread pool to use (defaults to the global thread pool).
+    void convert_rows(
+        const void* src,
+        ptrdiff_t src_row_pitch,
+        void* dst,
+        ptrdiff_t dst_row_pitch,
+        size_t count,
+        size_t row_count,
+        BS::thread_pool* pool = nullptr
+    ) const;
+
+    /// Kind of the conversion program used by this converter.
+    /// One of "copy" (identical structs), "simd_float" or "simd_double" (vectorized programs using single or double
+    /// precision lanes), "x86" or "arm64" (just-in-time compiled programs) and "vm" (virtual machine).
+    std::string program_kind() const;
+
+    /// Statistics of the conversion program cache.
+    static StructConverterStats stats();
+
     std::string to_string() const override;
 
 private:
@@ -137,6 +137,92 @@ def test_bitmap_vflip():
     assert np.all(a == np.flip(img, 0))
 
 
+def test_bitmap_convert_large():
+    # Large enough to be converted in parallel chunks.
+    img = np.random.default_rng(0).random((1024, 1031, 3), dtype=np.float32)
+    b = Bitmap(img)
+    c = b.convert(Bitmap.PixelFormat.rgba, Bitmap.ComponentType.float32, False)
+    a = np.array(c, copy=False)
+    assert np.all(a[:, :, 0:3] == img)
+    assert np.all(a[:, :, 3] == 1.0)
+
+
+@pytest.mark.parametrize("flip_y", [False, True])
+@pytest.mark.parametrize("region", [None, (3, 5, 20, 11)])
+def test_bitmap_transform(flip_y: bool, region: Optional[tuple[int, int, int, int]]):
+    img = create_test_image(37, 23, Bitmap.PixelFormat.rgb, Bitmap.ComponentType.float32)
+    b = Bitmap(img)
+
+    dst_struct = Struct()
+    for name in ["R", "G", "B", "A"]:
+        dst_struct.append(name, Struct.Type.float32)
+
+    # Pad rows to 256 bytes.
+    row_pitch = b.transform_row_pitch(dst_struct, row_alignment=256, region=region)
+    assert row_pitch % 256 == 0
+    size = b.transform_size(dst_struct, row_alignment=256, region=region)
+    dst = np.zeros(size // 4, dtype=np.float32)
+    b.transform(dst, dst_struct, flip_y=flip_y, row_alignment=256, region=region)
+
+    ref = img
+    if region:
+        x, y, w, h = region
+        ref = ref[y : y + h, x : x + w]
+    if flip_y:
+        ref = np.flip(ref, 0)
+
+    height, width = ref.shape[0:2]
+    for i in range(height):
+        row = dst[i * row_pitch // 4 : i * row_pitch // 4 + width * 4].reshape(width, 4)
+        assert np.all(row[:, 0:3] == ref[i])
+        assert np.all(row[:, 3] == 1.0)
+
+
+@pytest.mark.parametrize("region", [None, (3, 5, 60, 31)])
+@pytest.mark.parametrize("block_height", [1, 16, 1000])
+def test_bitmap_read_blocks(
+    tmp_path: Path, region: Optional[tuple[int, int, int, int]], block_height: int
+):
+    img = create_test_image(100, 50, Bitmap.PixelFormat.rgba, Bitmap.ComponentType.uint8)
+    path = tmp_path / "test_read_blocks.png"
+    Bitmap(img).write(path)
+
+    rows = []
+
+    def callback(block: Bitmap, y: int):
+        assert y == sum(len(r) for r in rows)
+        assert block.pixel_format == Bitmap.PixelFormat.rgba
+        assert block.component_type == Bitmap.ComponentType.uint8
+        rows.append(np.array(block, copy=True))
+
+    Bitmap.read_blocks(path, callback, block_height=block_height, region=region)
+
+    ref = img
+    if region:
+        x, y, w, h = region
+        ref = ref[y : y + h, x : x + w]
+    assert np.all(np.concatenate(rows) == ref)
+
+
+def test_bitmap_read_blocks_downsample(tmp_path: Path):
+    img = create_test_image(
+        64, 32, Bitmap.PixelFormat.rgb, Bitmap.ComponentType.float32
+    )
+    path = tmp_path / "test_read_blocks.exr"
+    Bitmap(img).write(path)
+
+    rows = []
+    Bitmap.read_blocks(
+        path,
+        lambda block, y: rows.append(np.array(block, copy=True)),
+        block_height=8,
+        downsample=2,
+    )
+
+    ref = img.reshape(16, 2, 32, 2, 3).mean(axis=(1, 3))
+    assert np.allclose(np.concatenate(rows), ref, atol=1e-6)
+
+
 EXR_LAYOUTS = [
     (5, 10, Bitmap.PixelFormat.y, Bitmap.ComponentType.float16),
     (10, 20, Bitmap.PixelFormat.ya, Bitmap.ComponentType.float16),
@@ -164,6 +250,24 @@ def test_exr_io(tmp_path: Path, layout: Sequence[Any]):
     )
 
 
+def test_exr_thread_count(tmp_path: Path):
+    img = np.random.rand(256, 128, 4).astype(np.float32)
+    paths = [tmp_path / f"test_{i}.exr" for i in range(4)]
+    for path in paths:
+        Bitmap(img).write(path)
+
+    default_count = Bitmap.exr_thread_count()
+    try:
+        for count in [0, 1, default_count]:
+            Bitmap.set_exr_thread_count(count)
+            assert Bitmap.exr_thread_count() == count
+            assert np.all(np.array(Bitmap(paths[0]), copy=False) == img)
+            for bitmap in Bitmap.read_multiple(paths):
+                assert np.all(np.array(bitmap, copy=False) == img)
+    finally:
+        Bitmap.set_exr_thread_count(default_count)
+
+
 BMP_LAYOUTS = [
     (50, 100, Bitmap.PixelFormat.rgb, Bitmap.ComponentType.uint8),
     (100, 200, Bitmap.PixelFormat.rgba, Bitmap.ComponentType.uint8),
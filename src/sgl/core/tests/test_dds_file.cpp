@@ -6,6 +6,8 @@
 #include "sgl/core/memory_stream.h"
 #include "sgl/device/native_formats.h"
 
+#include <cstring>
+
 using namespace sgl;
 
 TEST_SUITE_BEGIN("dds_file");
@@ -409,6 +411,36 @@ TEST_CASE("formats")
     }
 }
 
+TEST_CASE("memory_mapped")
+{
+    std::filesystem::path images_dir = platform::project_directory() / "data" / "test_images" / "dds";
+
+    for (const TestItem& item : TEST_ITEMS) {
+        DDSFile mapped_file(images_dir / item.path, true);
+        DDSFile read_file(images_dir / item.path, false);
+
+        CHECK(mapped_file.memory_mapped());
+        CHECK_FALSE(read_file.memory_mapped());
+
+        CHECK_EQ(mapped_file.dxgi_format(), read_file.dxgi_format());
+        CHECK_EQ(mapped_file.size(), read_file.size());
+        CHECK_EQ(mapped_file.resource_size(), read_file.resource_size());
+        CHECK_EQ(mapped_file.resource_data() - mapped_file.data(), read_file.resource_data() - read_file.data());
+        CHECK(std::memcmp(mapped_file.data(), read_file.data(), mapped_file.size()) == 0);
+
+        uint32_t slice_count
+            = mapped_file.type() == DDSFile::TextureType::texture_3d ? mapped_file.depth() : mapped_file.array_size();
+        for (uint32_t mip = 0; mip < mapped_file.mip_count(); ++mip) {
+            for (uint32_t slice = 0; slice < slice_count; ++slice) {
+                CHECK_EQ(
+                    mapped_file.get_subresource_data(mip, slice) - mapped_file.data(),
+                    read_file.get_subresource_data(mip, slice) - read_file.data()
+                );
+            }
+        }
+    }
+}
+
 TEST_CASE("detect_dds_file")
 {
     const uint32_t VALID_MAGIC = 0x20534444;
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <mutex>
 
 using namespace sgl;
 
@@ -147,6 +148,104 @@ TEST_CASE("FileSystemWatcher")
         // Clean up
         watcher->remove_watch(path);
     }
+
+    SUBCASE("recursive_file_watches")
+    {
+        using namespace std::chrono_literals;
+        using namespace std::filesystem;
+
+        std::vector<FileSystemWatchEvent> events;
+        auto handler = [&events](std::span<FileSystemWatchEvent> event_received)
+        { events.insert(events.end(), event_received.begin(), event_received.end()); };
+
+        auto path = absolute(testing::get_case_temp_directory() / "recursive_file_watches");
+        create_directories(path / "subdir0" / "subdir1");
+
+        ref<FileSystemWatcher> watcher = make_ref<FileSystemWatcher>();
+        watcher->set_on_change(handler);
+        watcher->add_watch({.directory = path, .recursive = true});
+        watcher->set_delay(10);
+
+        auto check = [&](const std::filesystem::path& filename, FileSystemWatcherChange event_type)
+        {
+            bool done = false;
+            for (int it = 0; it < 100 && !done; it++) {
+                std::this_thread::sleep_for(10ms);
+                watcher->update();
+                for (const auto& ev : events) {
+                    if (ev.change == event_type && ev.path == filename) {
+                        CHECK_EQ(ev.absolute_path, path / filename);
+                        done = true;
+                        break;
+                    }
+                }
+            }
+            CHECK(done);
+            events.clear();
+        };
+
+        // Files in existing subdirectories are detected.
+        std::ofstream(path / "subdir0" / "subdir1" / "subfile.txt") << "hello";
+        check(std::filesystem::path("subdir0") / "subdir1" / "subfile.txt", FileSystemWatcherChange::added);
+
+        // Files in new subdirectories are detected.
+        create_directories(path / "subdir2" / "subdir3");
+        std::ofstream(path / "subdir2" / "subdir3" / "newfile.txt") << "hello";
+        check(std::filesystem::path("subdir2") / "subdir3" / "newfile.txt", FileSystemWatcherChange::added);
+
+        // Repeated modifications are coalesced.
+        for (int i = 0; i < 100; i++)
+            std::ofstream(path / "subdir0" / "modified.txt", std::ios::app) << i;
+        check(std::filesystem::path("subdir0") / "modified.txt", FileSystemWatcherChange::added);
+        for (int it = 0; it < 10; it++) {
+            std::this_thread::sleep_for(10ms);
+            watcher->update();
+        }
+        for (const auto& ev : events)
+            CHECK_NE(ev.path, std::filesystem::path("subdir0") / "modified.txt");
+
+        watcher->remove_watch(path);
+    }
+
+    SUBCASE("background_thread")
+    {
+        using namespace std::chrono_literals;
+        using namespace std::filesystem;
+
+        std::mutex mutex;
+        std::vector<FileSystemWatchEvent> events;
+        auto handler = [&](std::span<FileSystemWatchEvent> event_received)
+        {
+            std::lock_guard lock(mutex);
+            events.insert(events.end(), event_received.begin(), event_received.end());
+        };
+
+        auto path = absolute(testing::get_case_temp_directory() / "background_thread");
+        create_directories(path);
+
+        ref<FileSystemWatcher> watcher = make_ref<FileSystemWatcher>();
+        watcher->set_on_change(handler);
+        watcher->set_delay(10);
+        watcher->add_watch({.directory = path});
+        watcher->start_background_thread();
+        CHECK(watcher->is_background_thread_running());
+
+        std::ofstream(path / "testfile.txt") << "hello";
+
+        // Events are reported without calling update().
+        bool done = false;
+        for (int it = 0; it < 100 && !done; it++) {
+            std::this_thread::sleep_for(10ms);
+            std::lock_guard lock(mutex);
+            for (const auto& ev : events)
+                done |= ev.path == "testfile.txt" && ev.change == FileSystemWatcherChange::added;
+        }
+        CHECK(done);
+
+        watcher->stop_background_thread();
+        CHECK_FALSE(watcher->is_background_thread_running());
+        watcher->remove_watch(path);
+    }
 }
 
 TEST_SUITE_END();
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "testing.h"
+#include "sgl/core/hash.h"
+
+#include <string_view>
+#include <vector>
+
+using namespace sgl;
+
+TEST_SUITE_BEGIN("hash");
+
+TEST_CASE("hash_data")
+{
+    auto hash_string = [](std::string_view str) { return hash_data(str.data(), str.size()); };
+
+    // XXH64 reference values.
+    CHECK_EQ(hash_string(""), 0xef46db3751d8e999ull);
+    CHECK_EQ(hash_string("abc"), 0x44bc2cf5ad770999ull);
+    CHECK_EQ(hash_string("Nobody inspects the spammish repetition"), 0xfbcea83c8a378bf1ull);
+}
+
+TEST_CASE("hash_data_unaligned")
+{
+    // The hash must not depend on the alignment of the data.
+    std::string_view str = "Nobody inspects the spammish repetition";
+    std::vector<char> buffer(str.size() + 8);
+    for (size_t offset = 0; offset < 8; ++offset) {
+        std::copy(str.begin(), str.end(), buffer.begin() + offset);
+        CHECK_EQ(hash_data(buffer.data() + offset, str.size()), 0xfbcea83c8a378bf1ull);
+    }
+}
+
+TEST_SUITE_END();
@@ -11,6 +11,7 @@ from sgl import (
     FileLoggerOutput,
     LogLevel,
     LogFrequency,
+    LogOverflowPolicy,
 )
 
 
@@ -21,10 +22,14 @@ class CustomLoggerOutput(LoggerOutput):
 
     def clear(self):
         self.messages = []
+        self.flush_count = 0
 
     def write(self, level: LogLevel, name: str, msg: str):
         self.messages.append((level, name, msg))
 
+    def flush(self):
+        self.flush_count += 1
+
 
 def test_logger():
     logger = Logger(level=LogLevel.debug, name="test", use_default_outputs=False)
@@ -80,6 +85,82 @@ def test_logger_frequency():
     assert len(output.messages) == 2
 
 
+def test_logger_async(tmpdir: Path):
+    path = os.path.join(tmpdir, "test.log")
+    output = FileLoggerOutput(path)
+    assert output.supports_async
+    logger = Logger(level=LogLevel.info, name="test", use_default_outputs=False)
+    logger.add_output(output)
+
+    logger.enable_async()
+    assert logger.is_async
+
+    for i in range(1000):
+        logger.info(f"message {i}")
+    logger.debug("filtered")
+    logger.log(LogLevel.info, "repeated", LogFrequency.once)
+    logger.log(LogLevel.info, "repeated", LogFrequency.once)
+    logger.flush()
+
+    # Flushing writes and flushes all queued messages.
+    lines = open(path, "r").readlines()
+    assert len(lines) == 1001
+    for i in range(1000):
+        assert lines[i].startswith(f"[INFO] (test) message {i}")
+    assert lines[1000].startswith("[INFO] (test) repeated")
+
+    # Queued messages are written when disabling async mode.
+    logger.info("last")
+    logger.disable_async()
+    assert not logger.is_async
+    lines = open(path, "r").readlines()
+    assert lines[-1].startswith("[INFO] (test) last")
+
+
+def test_logger_async_drop(tmpdir: Path):
+    path = os.path.join(tmpdir, "test.log")
+    logger = Logger(level=LogLevel.info, name="test", use_default_outputs=False)
+    logger.add_file_output(path)
+
+    logger.enable_async(queue_capacity=2, overflow_policy=LogOverflowPolicy.drop)
+    for i in range(1000):
+        logger.info(f"message {i}")
+    logger.error("error")
+    logger.flush()
+    logger.disable_async()
+
+    lines = open(path, "r").readlines()
+    assert logger.dropped_count + len(lines) == 1001
+    # Errors are never dropped.
+    assert lines[-1].startswith("[ERROR] (test) error")
+
+
+def test_logger_async_python_output():
+    # Python outputs acquire the GIL and cannot be written from the async writer thread.
+    output = CustomLoggerOutput()
+    assert not output.supports_async
+    logger = Logger(level=LogLevel.info, name="test", use_default_outputs=False)
+    logger.add_output(output)
+    with pytest.raises(RuntimeError, match="does not support asynchronous logging"):
+        logger.enable_async()
+    assert not logger.is_async
+
+    logger.remove_output(output)
+    logger.enable_async()
+    with pytest.raises(RuntimeError, match="does not support asynchronous logging"):
+        logger.add_output(output)
+    logger.disable_async()
+
+    # Synchronous logging only flushes errors and fatal messages.
+    logger.add_output(output)
+    logger.info("sync")
+    assert len(output.messages) == 1
+    assert output.flush_count == 0
+    logger.error("sync error")
+    assert len(output.messages) == 2
+    assert output.flush_count == 1
+
+
 def _test_console_output():
     output = ConsoleLoggerOutput(colored=False)
     logger = Logger(level=LogLevel.debug, name="test", use_default_outputs=False)
@@ -283,6 +283,42 @@ def test_gamma_2():
     check_conversion(s, "@" + ("f" * 256), "@" + ("B" * 256), src_data, dest_data)
 
 
+def test_gamma_3():
+    s = StructConverter(
+        Struct().append(
+            "v", Struct.Type.uint16, Struct.Flags.normalized | Struct.Flags.srgb_gamma
+        ),
+        Struct().append("v", Struct.Type.float64),
+    )
+
+    src_data = list(range(0, 65536, 7)) + [65535]
+    dest_data = [from_srgb(x / 65535.0) for x in src_data]
+
+    check_conversion(
+        s,
+        "@" + ("H" * len(src_data)),
+        "@" + ("d" * len(src_data)),
+        src_data,
+        dest_data,
+        err_thresh=1e-5,
+    )
+
+
+def test_gamma_roundtrip():
+    flags = Struct.Flags.normalized | Struct.Flags.srgb_gamma
+    s1 = StructConverter(
+        Struct().append("v", Struct.Type.uint8, flags),
+        Struct().append("v", Struct.Type.float32),
+    )
+    s2 = StructConverter(
+        Struct().append("v", Struct.Type.float32),
+        Struct().append("v", Struct.Type.uint8, flags),
+    )
+
+    src_data = bytes(range(256))
+    assert s2.convert(s1.convert(src_data)) == src_data
+
+
 def test_blend():
     src = Struct()
     src.append("a", Struct.Type.float32)
@@ -329,5 +365,178 @@ def test_blend_gamma():
     check_conversion(s, "@BB", "@B", (100, 200), (ref,))
 
 
+@pytest.mark.parametrize("count", [1, 15, 16, 17, 1000])
+def test_convert_batches(count: int):
+    flags = Struct.Flags.normalized | Struct.Flags.srgb_gamma
+    src = Struct()
+    src.append("r", Struct.Type.uint8, flags)
+    src.append("g", Struct.Type.uint8, flags)
+    src.append("b", Struct.Type.uint8, flags)
+
+    dst = Struct()
+    dst.append("r", Struct.Type.float32)
+    dst.append("g", Struct.Type.float32)
+    dst.append("b", Struct.Type.float32)
+    dst.append("a", Struct.Type.float32, Struct.Flags.default, 1.0)
+
+    s = StructConverter(src, dst)
+
+    src_data = [(i * 7) % 256 for i in range(count * 3)]
+    dest_data = []
+    for i in range(count):
+        dest_data += [from_srgb(x / 255.0) for x in src_data[i * 3 : i * 3 + 3]]
+        dest_data += [1.0]
+
+    check_conversion(
+        s,
+        "@" + ("B" * len(src_data)),
+        "@" + ("f" * len(dest_data)),
+        src_data,
+        dest_data,
+        err_thresh=1e-5,
+    )
+
+
+def test_convert_numpy():
+    src = Struct()
+    src.append("x", Struct.Type.uint16)
+    src.append("y", Struct.Type.uint16)
+    dst = Struct()
+    dst.append("x", Struct.Type.float32)
+    dst.append("y", Struct.Type.float32)
+    s = StructConverter(src, dst)
+
+    count = 100000
+    src_data = (np.arange(count * 2) % 65536).astype(np.uint16)
+    ref = src_data.astype(np.float32)
+
+    # Convert into a new numpy array.
+    dst_data = s.convert(src_data)
+    assert isinstance(dst_data, np.ndarray)
+    assert np.array_equal(dst_data.view(np.float32), ref)
+
+    # Convert into an existing numpy array.
+    dst_data = np.zeros(count * 2, dtype=np.float32)
+    s.convert(src_data, dst_data)
+    assert np.array_equal(dst_data, ref)
+
+    # Convert from buffer protocol objects.
+    dst_data = np.zeros(count * 2, dtype=np.float32)
+    s.convert(memoryview(bytearray(src_data.tobytes())), dst_data)
+    assert np.array_equal(dst_data, ref)
+
+    # Bytes input still returns bytes.
+    assert s.convert(src_data.tobytes()) == ref.tobytes()
+
+    # Convert from read-only arrays and buffers.
+    readonly_data = src_data.copy()
+    readonly_data.setflags(write=False)
+    assert np.array_equal(s.convert(readonly_data).view(np.float32), ref)
+    dst_data = np.zeros(count * 2, dtype=np.float32)
+    s.convert(readonly_data, dst_data)
+    assert np.array_equal(dst_data, ref)
+    dst_data = np.zeros(count * 2, dtype=np.float32)
+    s.convert(memoryview(src_data.tobytes()), dst_data)
+    assert np.array_equal(dst_data, ref)
+
+    # Output is not writeable.
+    readonly_dst = np.zeros(count * 2, dtype=np.float32)
+    readonly_dst.setflags(write=False)
+    with pytest.raises(Exception):
+        s.convert(src_data, readonly_dst)
+
+    # Output too small.
+    with pytest.raises(Exception):
+        s.convert(src_data, np.zeros(count, dtype=np.float32))
+
+    # Input size is not a multiple of the struct size.
+    with pytest.raises(Exception):
+        s.convert(src_data[:3])
+
+    # Input is not contiguous.
+    with pytest.raises(Exception):
+        s.convert(src_data.reshape(-1, 2)[:, 0])
+
+
+def test_converter_stats():
+    # Use a unique field name to make sure the conversion program is not cached yet.
+    src = Struct().append("test_converter_stats", Struct.Type.uint16)
+    dst = Struct().append("test_converter_stats", Struct.Type.float32)
+
+    stats0 = StructConverter.stats()
+    s = StructConverter(src, dst)
+    check_conversion(s, "@HH", "@ff", (1, 2))
+    stats1 = StructConverter.stats()
+    assert stats1.miss_count == stats0.miss_count + 1
+    assert stats1.program_count == stats0.program_count + 1
+    assert stats1.code_size > stats0.code_size
+    assert stats1.compile_time >= stats0.compile_time
+
+    check_conversion(s, "@HH", "@ff", (3, 4))
+    stats2 = StructConverter.stats()
+    assert stats2.miss_count == stats1.miss_count
+    assert stats2.hit_count == stats1.hit_count + 1
+    assert stats2.program_count == stats1.program_count
+
+
+
+@pytest.mark.parametrize(
+    "type,dtype",
+    [
+        (Struct.Type.uint8, np.uint8),
+        (Struct.Type.uint16, np.uint16),
+        (Struct.Type.int16, np.int16),
+    ],
+)
+def test_convert_batches_exact(type: Struct.Type, dtype: npt.DTypeLike):
+    # Batched conversions must match the scalar double precision computation bit-exactly.
+    info = np.iinfo(dtype)  # type: ignore
+    values = np.arange(info.min, info.max + 1, dtype=dtype)
+
+    src = Struct()
+    src.append("x", type, Struct.Flags.normalized)
+    dst = Struct()
+    dst.append("x", Struct.Type.float32)
+    s = StructConverter(src, dst)
+    result = np.frombuffer(s.convert(values.tobytes()), dtype=np.float32)
+    ref = (values.astype(np.float64) * (1.0 / info.max)).astype(np.float32)
+    assert np.array_equal(result, ref)
+
+    # Convert back, including values between the representable ones.
+    floats = np.linspace(-1.0, 1.0, 100003, dtype=np.float32)
+    floats = np.concatenate([floats, ref])
+    s = StructConverter(dst, src)
+    result = np.frombuffer(s.convert(floats.tobytes()), dtype=dtype)
+    ref = np.clip(np.rint(floats.astype(np.float64) * info.max), info.min, info.max).astype(dtype)
+    assert np.array_equal(result, ref)
+
+
+def test_program_kind():
+    def make_struct(type: Struct.Type, flags: Struct.Flags = Struct.Flags.none):
+        s = Struct()
+        s.append("x", type, flags)
+        s.append("y", type, flags)
+        return s
+
+    float32 = make_struct(Struct.Type.float32)
+
+    # Identical structs are copied.
+    assert StructConverter(float32, make_struct(Struct.Type.float32)).program_kind == "copy"
+
+    # Plain conversions of exactly representable values use single precision lanes.
+    assert StructConverter(make_struct(Struct.Type.uint16), float32).program_kind == "simd_float"
+    assert StructConverter(float32, make_struct(Struct.Type.int8)).program_kind == "simd_float"
+
+    # Normalization and gamma correction use double precision lanes (also preferred over the JIT).
+    unorm8 = make_struct(Struct.Type.uint8, Struct.Flags.normalized)
+    srgb8 = make_struct(Struct.Type.uint8, Struct.Flags.normalized | Struct.Flags.srgb_gamma)
+    assert StructConverter(unorm8, float32).program_kind == "simd_double"
+    assert StructConverter(float32, unorm8).program_kind == "simd_double"
+    assert StructConverter(float32, srgb8).program_kind == "simd_double"
+
+    # 64-bit integers are not supported by the vectorized programs.
+    assert StructConverter(make_struct(Struct.Type.uint64), float32).program_kind in ["x86", "arm64", "vm"]
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
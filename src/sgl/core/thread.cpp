@@ -3,6 +3,13 @@
 #include "thread.h"
 
 #include "sgl/core/error.h"
+#include "sgl/core/maths.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 
 namespace sgl::thread {
 
@@ -30,4 +37,80 @@ BS::thread_pool& global_thread_pool()
     return *s_global_thread_pool;
 }
 
+bool is_worker_thread()
+{
+    auto pool = BS::this_thread::get_pool();
+    return pool && *pool == s_global_thread_pool.get();
+}
+
+void parallel_for(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)>& func, BS::thread_pool* pool)
+{
+    if (count == 0)
+        return;
+
+    chunk_size = std::max(chunk_size, size_t(1));
+    size_t chunk_count = div_round_up(count, chunk_size);
+
+    if (!pool)
+        pool = &global_thread_pool();
+
+    // The calling thread processes chunks as well, so one helper less is needed.
+    size_t helper_count = std::min(chunk_count, size_t(pool->get_thread_count())) - 1;
+    if (helper_count == 0) {
+        func(0, count);
+        return;
+    }
+
+    // Shared state, kept alive by helper tasks that only get to run after all chunks are done.
+    struct State {
+        std::function<void(size_t, size_t)> func;
+        size_t count;
+        size_t chunk_size;
+        size_t chunk_count;
+        std::atomic<size_t> next_chunk{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t finished_chunks{0};
+        std::exception_ptr exception;
+
+        void run()
+        {
+            while (true) {
+                size_t chunk = next_chunk.fetch_add(1);
+                if (chunk >= chunk_count)
+                    return;
+                size_t begin = chunk * chunk_size;
+                size_t end = std::min(begin + chunk_size, count);
+                std::exception_ptr chunk_exception;
+                try {
+                    func(begin, end);
+                } catch (...) {
+                    chunk_exception = std::current_exception();
+                }
+                std::lock_guard lock(mutex);
+                if (chunk_exception && !exception)
+                    exception = chunk_exception;
+                if (++finished_chunks == chunk_count)
+                    cv.notify_all();
+            }
+        }
+    };
+
+    auto state = std::make_shared<State>();
+    state->func = func;
+    state->count = count;
+    state->chunk_size = chunk_size;
+    state->chunk_count = chunk_count;
+
+    for (size_t i = 0; i < helper_count; ++i)
+        pool->push_task([state]() { state->run(); });
+
+    state->run();
+
+    std::unique_lock lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->finished_chunks == state->chunk_count; });
+    if (state->exception)
+        std::rethrow_exception(state->exception);
+}
+
 } // namespace sgl::thread
@@ -6,6 +6,7 @@
 
 #include <BS_thread_pool.hpp>
 
+#include <functional>
 #include <type_traits>
 #include <future>
 
@@ -19,10 +20,33 @@ SGL_API void wait_for_tasks();
 
 SGL_API BS::thread_pool& global_thread_pool();
 
+/// Returns true if the calling thread is a worker of the global thread pool.
+SGL_API bool is_worker_thread();
+
 template<typename F, typename... A, typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
 std::future<R> do_async(F&& task, A&&... args)
 {
     return global_thread_pool().submit(std::forward<F>(task), std::forward<A>(args)...);
 }
 
+/**
+ * \brief Run a function over the range [0, count) split into chunks.
+ *
+ * Chunks are processed by the calling thread as well as by workers of the thread pool.
+ * The calling thread never waits on queued tasks, only on chunks that are actively being
+ * processed, so this is safe to call from within a task running on the same thread pool.
+ * Exceptions thrown by \c func are rethrown on the calling thread.
+ *
+ * \param count Number of items.
+ * \param chunk_size Number of items per chunk.
+ * \param func Function called with the [begin, end) range of each chunk.
+ * \param pool Thread pool to use (defaults to the global thread pool).
+ */
+SGL_API void parallel_for(
+    size_t count,
+    size_t chunk_size,
+    const std::function<void(size_t, size_t)>& func,
+    BS::thread_pool* pool = nullptr
+);
+
 } // namespace sgl::thread
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "buffer_pool.h"
+
+#include "sgl/device/device.h"
+
+#include "sgl/core/error.h"
+#include "sgl/core/maths.h"
+#include "sgl/core/string.h"
+
+#include <numeric>
+
+namespace sgl {
+
+void BufferPool::AllocationData::set_data(const void* data, size_t size, DeviceOffset offset) const
+{
+    SGL_CHECK(offset + size <= this->size, "Data exceeds allocation size");
+    buffer->set_data(data, size, this->offset + offset);
+}
+
+BufferPool::BufferPool(ref<Device> device, BufferPoolDesc desc)
+    : DeviceResource(std::move(device))
+    , m_desc(std::move(desc))
+{
+    SGL_CHECK(m_desc.min_block_size > 0, "Invalid min block size, must be larger than 0");
+    SGL_CHECK(is_power_of_two(m_desc.min_block_size), "Invalid min block size, must be a power of two");
+
+    // Blocks are aligned to the struct size so that structured buffer views can start at any block.
+    m_block_size = m_desc.min_block_size;
+    if (m_desc.struct_size > 0)
+        m_block_size = std::lcm(m_block_size, DeviceSize(m_desc.struct_size));
+
+    SGL_CHECK(m_desc.page_size >= m_block_size, "Invalid page size, must be at least {} bytes", m_block_size);
+    // Round the page size down to a whole number of blocks so that no page ends in an unusable remainder.
+    m_desc.page_size -= m_desc.page_size % m_block_size;
+
+    uint32_t size_class_count = 1;
+    while ((m_block_size << size_class_count) <= m_desc.page_size)
+        size_class_count++;
+    m_free_lists.resize(size_class_count);
+}
+
+BufferPool::Allocation BufferPool::allocate(DeviceSize size)
+{
+    SGL_CHECK(size > 0, "Invalid allocation size, must be larger than 0");
+
+    if (size > block_size(size_class_count() - 1)) {
+        // Allocation exceeds largest size class -> allocate a new large page.
+        ref<Buffer> buffer = create_page_buffer(align_to(m_block_size, size), "large");
+        m_stats.total_size += buffer->size();
+        m_stats.large_page_count++;
+        m_stats.used_size += size;
+        m_stats.allocation_count++;
+        return Allocation(new AllocationData{
+            .pool = ref<BufferPool>(this),
+            .buffer = std::move(buffer),
+            .size = size,
+            .offset = 0,
+            .page_index = LARGE_PAGE,
+            .size_class = 0,
+        });
+    }
+
+    uint32_t size_class = get_size_class(size);
+    DeviceSize block_size = this->block_size(size_class);
+    Block block;
+
+    std::vector<Block>& free_list = m_free_lists[size_class];
+    if (!free_list.empty()) {
+        // Reuse a free block.
+        block = free_list.back();
+        free_list.pop_back();
+        m_stats.free_size -= block_size;
+    } else {
+        // Carve a new block from the current page.
+        if (m_pages.empty() || m_current_offset + block_size > m_pages.back()->size()) {
+            if (!m_pages.empty()) {
+                uint32_t page_index = narrow_cast<uint32_t>(m_pages.size() - 1);
+                add_free_range(page_index, m_current_offset, m_pages.back()->size() - m_current_offset);
+            }
+            m_pages.push_back(create_page_buffer(m_desc.page_size, fmt::format("page_index={}", m_pages.size())));
+            m_current_offset = 0;
+            m_stats.total_size += m_desc.page_size;
+            m_stats.page_count++;
+        }
+        block = {
+            .page_index = narrow_cast<uint32_t>(m_pages.size() - 1),
+            .offset = m_current_offset,
+        };
+        m_current_offset += block_size;
+    }
+
+    m_stats.used_size += size;
+    m_stats.allocated_size += block_size;
+    m_stats.allocation_count++;
+
+    return Allocation(new AllocationData{
+        .pool = ref<BufferPool>(this),
+        .buffer = m_pages[block.page_index],
+        .size = size,
+        .offset = block.offset,
+        .page_index = block.page_index,
+        .size_class = size_class,
+    });
+}
+
+std::string BufferPool::to_string() const
+{
+    return fmt::format(
+        "BufferPool(\n"
+        "  device = {},\n"
+        "  usage = {},\n"
+        "  struct_size = {},\n"
+        "  format = {},\n"
+        "  page_size = {},\n"
+        "  min_block_size = {},\n"
+        "  debug_name = {}\n"
+        ")",
+        m_device,
+        m_desc.usage,
+        m_desc.struct_size,
+        m_desc.format,
+        string::format_byte_size(m_desc.page_size),
+        string::format_byte_size(m_desc.min_block_size),
+        m_desc.debug_name
+    );
+}
+
+void BufferPool::release(AllocationData* allocation)
+{
+    m_stats.used_size -= allocation->size;
+    m_stats.allocation_count--;
+
+    if (allocation->page_index == LARGE_PAGE) {
+        // The large page is released together with the allocation.
+        m_stats.total_size -= allocation->buffer->size();
+        m_stats.large_page_count--;
+    } else {
+        DeviceSize block_size = this->block_size(allocation->size_class);
+        m_free_lists[allocation->size_class].push_back({
+            .page_index = allocation->page_index,
+            .offset = allocation->offset,
+        });
+        m_stats.allocated_size -= block_size;
+        m_stats.free_size += block_size;
+    }
+}
+
+uint32_t BufferPool::get_size_class(DeviceSize size) const
+{
+    uint32_t size_class = 0;
+    while (block_size(size_class) < size)
+        size_class++;
+    return size_class;
+}
+
+ref<Buffer> BufferPool::create_page_buffer(DeviceSize size, std::string_view name)
+{
+    return m_device->create_buffer({
+        .size = size,
+        .struct_size = m_desc.struct_size,
+        .format = m_desc.format,
+        .usage = m_desc.usage,
+        .memory_type = MemoryType::device_local,
+        .debug_name = fmt::format("{}[{}]", m_desc.debug_name, name),
+    });
+}
+
+void BufferPool::add_free_range(uint32_t page_index, DeviceOffset offset, DeviceSize size)
+{
+    // Split the range into blocks of the largest fitting size classes.
+    // The range is always a multiple of the smallest block size, because the page size and all block
+    // offsets are multiples of it (see constructor).
+    uint32_t size_class = size_class_count() - 1;
+    while (size >= m_block_size) {
+        while (block_size(size_class) > size)
+            size_class--;
+        m_free_lists[size_class].push_back({.page_index = page_index, .offset = offset});
+        m_stats.free_size += block_size(size_class);
+        offset += block_size(size_class);
+        size -= block_size(size_class);
+    }
+}
+
+} // namespace sgl
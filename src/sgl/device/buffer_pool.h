@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/device_resource.h"
+#include "sgl/device/resource.h"
+
+#include "sgl/core/type_utils.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sgl {
+
+struct BufferPoolDesc {
+    /// The resource usage of the backing buffers.
+    ResourceUsage usage{ResourceUsage::shader_resource | ResourceUsage::unordered_access};
+    /// The struct size of the backing buffers (for structured buffer views).
+    /// Allocations are aligned to a multiple of the struct size.
+    size_t struct_size{0};
+    /// The format of the backing buffers (for typed buffer views).
+    Format format{Format::unknown};
+    /// The size of a page in bytes.
+    /// Rounded down to a multiple of the smallest block size (see \c min_block_size and \c struct_size).
+    DeviceSize page_size{16 * 1024 * 1024};
+    /// The size of the smallest size class in bytes. This is also the alignment of all allocations.
+    DeviceSize min_block_size{256};
+    /// The debug name of the pool.
+    std::string debug_name;
+};
+
+/**
+ * \brief A buffer pool is used to suballocate persistent device-local memory.
+ *
+ * Creating a separate buffer for every small constant or structured buffer is costly.
+ * A buffer pool instead carves allocations out of large backing buffers (pages) of size \c page_size.
+ *
+ * Allocations are rounded up to a power-of-two multiple of \c min_block_size (the size class).
+ * Released blocks are put on a free list per size class and reused by later allocations of the same class.
+ * New blocks are carved from the current page. When the current page is exhausted, its remaining space
+ * is split into blocks of smaller size classes and a new page is allocated.
+ * For allocations larger than the largest size class, a new large page is allocated, which is
+ * released together with the allocation.
+ *
+ * Released blocks are reused immediately. This is safe because device-local memory is only accessed
+ * by commands on the device queue, which execute in submission order (data written with \c set_data
+ * is copied on the device queue as well).
+ *
+ * Allocations are returned as unique pointers. When the pointer is destroyed, the allocation
+ * is released. An allocation refers to a range of its backing buffer and can be bound to shaders
+ * through the resource views returned by \c get_srv and \c get_uav.
+ */
+class SGL_API BufferPool : public DeviceResource {
+    SGL_OBJECT(BufferPool)
+public:
+    SGL_NON_COPYABLE_AND_MOVABLE(BufferPool);
+
+    struct AllocationData {
+        /// The pool this allocation belongs to.
+        const ref<BufferPool> pool;
+        /// The buffer this allocation belongs to.
+        const ref<Buffer> buffer;
+        /// The size of the allocation.
+        const DeviceSize size;
+        /// The offset of the allocation within the buffer.
+        const DeviceOffset offset;
+
+        /// The page where the allocation is stored (\c LARGE_PAGE for allocations in a large page).
+        const uint32_t page_index;
+        /// The size class of the allocation (unused for allocations in a large page).
+        const uint32_t size_class;
+
+        ~AllocationData() { pool->release(this); }
+
+        /// The device address of the allocation.
+        DeviceAddress device_address() const { return buffer->device_address() + offset; }
+
+        /// The range of the allocation within the buffer.
+        BufferRange range() const { return {.offset = offset, .size = size}; }
+
+        /// Get a shader resource view for the allocation.
+        ref<ResourceView> get_srv() const { return buffer->get_srv(range()); }
+
+        /// Get an unordered access view for the allocation.
+        ref<ResourceView> get_uav() const { return buffer->get_uav(range()); }
+
+        /**
+         * Set allocation data from host memory.
+         *
+         * \param data Data to write.
+         * \param size Size of the data in bytes.
+         * \param offset Offset relative to the start of the allocation.
+         */
+        void set_data(const void* data, size_t size, DeviceOffset offset = 0) const;
+    };
+
+    using Allocation = std::unique_ptr<AllocationData>;
+
+    struct Stats {
+        /// The total size of all pages.
+        DeviceSize total_size{0};
+        /// The requested size of all live allocations.
+        DeviceSize used_size{0};
+        /// The size of all live allocations rounded up to their size class.
+        DeviceSize allocated_size{0};
+        /// The size of all blocks in the free lists.
+        DeviceSize free_size{0};
+        /// The number of live allocations.
+        uint32_t allocation_count{0};
+        /// The number of pages in the pool.
+        uint32_t page_count{0};
+        /// The number of large pages in the pool.
+        uint32_t large_page_count{0};
+
+        /// Fraction of the allocated and free-listed memory that is not used by allocations.
+        double fragmentation() const
+        {
+            DeviceSize reserved_size = allocated_size + free_size;
+            return reserved_size > 0 ? 1.0 - double(used_size) / double(reserved_size) : 0.0;
+        }
+    };
+
+    static constexpr uint32_t LARGE_PAGE = uint32_t(-1);
+
+    BufferPool(ref<Device> device, BufferPoolDesc desc);
+    ~BufferPool() = default;
+
+    /// Description of the pool.
+    const BufferPoolDesc& desc() const { return m_desc; }
+    /// Statistics of the pool.
+    const Stats& stats() const { return m_stats; }
+
+    /// Number of size classes.
+    uint32_t size_class_count() const { return narrow_cast<uint32_t>(m_free_lists.size()); }
+    /// Block size of a size class in bytes.
+    DeviceSize block_size(uint32_t size_class) const { return m_block_size << size_class; }
+    /// Number of free blocks of a size class.
+    size_t free_block_count(uint32_t size_class) const { return m_free_lists[size_class].size(); }
+
+    /**
+     * \brief Allocate memory from this pool.
+     *
+     * \param size The number of bytes to allocate.
+     * \return Returns a unique pointer to the allocation.
+     */
+    Allocation allocate(DeviceSize size);
+
+    std::string to_string() const override;
+
+private:
+    void release(AllocationData* allocation);
+
+    uint32_t get_size_class(DeviceSize size) const;
+    ref<Buffer> create_page_buffer(DeviceSize size, std::string_view name);
+    void add_free_range(uint32_t page_index, DeviceOffset offset, DeviceSize size);
+
+    struct Block {
+        uint32_t page_index;
+        DeviceOffset offset;
+    };
+
+    BufferPoolDesc m_desc;
+    Stats m_stats;
+
+    /// Size of the smallest size class.
+    DeviceSize m_block_size;
+
+    std::vector<ref<Buffer>> m_pages;
+    DeviceOffset m_current_offset{0};
+
+    std::vector<std::vector<Block>> m_free_lists;
+};
+
+} // namespace sgl
@@ -9,6 +9,7 @@
 #include "sgl/device/query.h"
 #include "sgl/device/pipeline.h"
 #include "sgl/device/raytracing.h"
+#include "sgl/device/shader.h"
 #include "sgl/device/shader_object.h"
 #include "sgl/device/framebuffer.h"
 #include "sgl/device/native_handle_traits.h"
@@ -24,6 +25,8 @@
 
 #include "sgl/math/vector.h"
 
+#include <algorithm>
+
 namespace sgl {
 
 namespace detail {
@@ -63,8 +66,12 @@ ref<TransientShaderObject> ComputeCommandEncoder::bind_pipeline(const ComputePip
     m_bound_pipeline = pipeline;
     gfx::IShaderObject* gfx_shader_object;
     SLANG_CALL(m_gfx_compute_command_encoder->bindPipeline(pipeline->gfx_pipeline_state(), &gfx_shader_object));
-    ref<TransientShaderObject> transient_shader_object
-        = make_ref<TransientShaderObject>(ref<Device>(m_command_buffer->device()), gfx_shader_object, m_command_buffer);
+    ref<TransientShaderObject> transient_shader_object = make_ref<TransientShaderObject>(
+        ref<Device>(m_command_buffer->device()),
+        gfx_shader_object,
+        m_command_buffer,
+        pipeline->program()->generation()
+    );
     if (m_command_buffer->device()->debug_printer())
         m_command_buffer->device()->debug_printer()->bind(ShaderCursor(transient_shader_object));
     m_bound_shader_object = transient_shader_object;
@@ -140,8 +147,12 @@ ref<TransientShaderObject> RenderCommandEncoder::bind_pipeline(const GraphicsPip
     m_bound_pipeline = pipeline;
     gfx::IShaderObject* gfx_shader_object;
     SLANG_CALL(m_gfx_render_command_encoder->bindPipeline(pipeline->gfx_pipeline_state(), &gfx_shader_object));
-    ref<TransientShaderObject> transient_shader_object
-        = make_ref<TransientShaderObject>(ref<Device>(m_command_buffer->device()), gfx_shader_object, m_command_buffer);
+    ref<TransientShaderObject> transient_shader_object = make_ref<TransientShaderObject>(
+        ref<Device>(m_command_buffer->device()),
+        gfx_shader_object,
+        m_command_buffer,
+        pipeline->program()->generation()
+    );
     if (m_command_buffer->device()->debug_printer())
         m_command_buffer->device()->debug_printer()->bind(ShaderCursor(transient_shader_object));
     m_bound_shader_object = transient_shader_object;
@@ -333,8 +344,12 @@ ref<TransientShaderObject> RayTracingCommandEncoder::bind_pipeline(const RayTrac
     m_bound_pipeline = pipeline;
     gfx::IShaderObject* gfx_shader_object;
     SLANG_CALL(m_gfx_ray_tracing_command_encoder->bindPipeline(pipeline->gfx_pipeline_state(), &gfx_shader_object));
-    ref<TransientShaderObject> transient_shader_object
-        = make_ref<TransientShaderObject>(ref<Device>(m_command_buffer->device()), gfx_shader_object, m_command_buffer);
+    ref<TransientShaderObject> transient_shader_object = make_ref<TransientShaderObject>(
+        ref<Device>(m_command_buffer->device()),
+        gfx_shader_object,
+        m_command_buffer,
+        pipeline->program()->generation()
+    );
     if (m_command_buffer->device()->debug_printer())
         m_command_buffer->device()->debug_printer()->bind(ShaderCursor(transient_shader_object));
     m_bound_shader_object = transient_shader_object;
@@ -710,6 +725,114 @@ void CommandBuffer::uav_barrier(const Resource* resource)
     }
 }
 
+void CommandBuffer::set_resource_view_states(std::span<const ResourceView* const> resource_views)
+{
+    SGL_CHECK(m_open, "Command buffer is closed");
+
+    // Views on texture sub-resources are handled individually after the batched barriers.
+    std::vector<std::pair<const ResourceView*, ResourceState>> subresource_views;
+    // Requested states of entire resources, in visit order.
+    std::vector<std::pair<const Resource*, ResourceState>> resource_states;
+    resource_states.reserve(resource_views.size());
+
+    for (const ResourceView* resource_view : resource_views) {
+        ResourceState new_state;
+        switch (resource_view->type()) {
+        case ResourceViewType::shader_resource:
+            new_state = ResourceState::shader_resource;
+            break;
+        case ResourceViewType::unordered_access:
+            new_state = ResourceState::unordered_access;
+            break;
+        default:
+            SGL_THROW("Invalid resource view type");
+        }
+
+        const Resource* resource = resource_view->resource();
+        if (resource->type() == ResourceType::buffer) {
+            // In D3D12, it's an error to set resource barriers on upload and readback buffers.
+            const Buffer* buffer = resource->as_buffer();
+            if (buffer->desc().memory_type != MemoryType::device_local && buffer->device()->type() == DeviceType::d3d12)
+                continue;
+        } else if (!resource_view->all_subresources() || !resource->state_tracker().has_global_state()) {
+            subresource_views.emplace_back(resource_view, new_state);
+            continue;
+        }
+        resource_states.emplace_back(resource, new_state);
+    }
+
+    // A resource can be referenced by multiple views (e.g. a shader resource and an unordered access view of the
+    // same buffer). Record a single transition per resource, from its current state to the last requested state.
+    std::stable_sort(
+        resource_states.begin(),
+        resource_states.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }
+    );
+
+    m_barrier_batches.clear();
+    auto get_batch = [this](ResourceState before, ResourceState after) -> BarrierBatch&
+    {
+        for (BarrierBatch& batch : m_barrier_batches)
+            if (batch.before == before && batch.after == after)
+                return batch;
+        return m_barrier_batches.emplace_back(BarrierBatch{.before = before, .after = after});
+    };
+
+    for (size_t i = 0; i < resource_states.size(); ++i) {
+        const Resource* resource = resource_states[i].first;
+        if (i + 1 < resource_states.size() && resource_states[i + 1].first == resource)
+            continue;
+        ResourceState new_state = resource_states[i].second;
+
+        // Transitions to the same state are only recorded as UAV barriers.
+        ResourceStateTracker& state_tracker = resource->state_tracker();
+        ResourceState current_state = state_tracker.global_state();
+        if (current_state == new_state && new_state != ResourceState::unordered_access)
+            continue;
+        state_tracker.set_global_state(new_state);
+
+        BarrierBatch& batch = get_batch(current_state, new_state);
+        if (resource->type() == ResourceType::buffer)
+            batch.buffers.push_back(resource->as_buffer()->gfx_buffer_resource());
+        else
+            batch.textures.push_back(resource->as_texture()->gfx_texture_resource());
+    }
+
+    if (!m_barrier_batches.empty()) {
+        gfx::IResourceCommandEncoder* encoder = get_gfx_resource_command_encoder();
+        // Record state transitions before UAV barriers.
+        for (bool uav_barriers : {false, true}) {
+            for (const BarrierBatch& batch : m_barrier_batches) {
+                if ((batch.before == batch.after) != uav_barriers)
+                    continue;
+                if (!batch.buffers.empty())
+                    encoder->bufferBarrier(
+                        narrow_cast<gfx::GfxCount>(batch.buffers.size()),
+                        batch.buffers.data(),
+                        static_cast<gfx::ResourceState>(batch.before),
+                        static_cast<gfx::ResourceState>(batch.after)
+                    );
+                if (!batch.textures.empty())
+                    encoder->textureBarrier(
+                        narrow_cast<gfx::GfxCount>(batch.textures.size()),
+                        batch.textures.data(),
+                        static_cast<gfx::ResourceState>(batch.before),
+                        static_cast<gfx::ResourceState>(batch.after)
+                    );
+            }
+        }
+    }
+
+    for (const auto& [resource_view, new_state] : subresource_views) {
+        const Resource* resource = resource_view->resource();
+        if (new_state == ResourceState::unordered_access
+            && resource->state_tracker().global_state() == ResourceState::unordered_access)
+            uav_barrier(resource);
+        else
+            set_resource_state(resource_view, new_state);
+    }
+}
+
 void CommandBuffer::clear_resource_view(ResourceView* resource_view, float4 clear_value)
 {
     SGL_CHECK(m_open, "Command buffer is closed");
@@ -311,6 +311,16 @@ public:
      */
     void uav_barrier(const Resource* resource);
 
+    /**
+     * Transition the resources of a list of shader resource and unordered access views for shader access.
+     * Shader resource views are transitioned to \c ResourceState::shader_resource, unordered access views to
+     * \c ResourceState::unordered_access. Unordered access views already in that state get a UAV barrier.
+     * Resources referenced by multiple views get a single transition to the state of the last view.
+     * Barriers on entire resources are batched into a single call per state transition.
+     * \param resource_views Resource views.
+     */
+    void set_resource_view_states(std::span<const ResourceView* const> resource_views);
+
     // ------------------------------------------------------------------------
     // Resources
     // ------------------------------------------------------------------------
@@ -529,6 +539,15 @@ private:
 
     std::vector<ref<cuda::InteropBuffer>> m_cuda_interop_buffers;
 
+    /// Barriers with the same state transition, collected by \c set_resource_view_states.
+    struct BarrierBatch {
+        ResourceState before;
+        ResourceState after;
+        std::vector<gfx::IBufferResource*> buffers;
+        std::vector<gfx::ITextureResource*> textures;
+    };
+    std::vector<BarrierBatch> m_barrier_batches;
+
     // TODO remove this
     friend class Device;
     friend class ComputeCommandEncoder;
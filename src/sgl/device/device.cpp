@@ -30,6 +30,8 @@
 #include "sgl/core/error.h"
 #include "sgl/core/window.h"
 #include "sgl/core/string.h"
+#include "sgl/core/thread.h"
+#include "sgl/core/timer.h"
 
 #if SGL_HAS_D3D12
 #include <dxgi.h>
@@ -41,6 +43,8 @@
 #include <nvapi.h>
 #endif
 
+#include <algorithm>
+#include <fstream>
 #include <mutex>
 
 namespace sgl {
@@ -475,6 +479,14 @@ Device::Device(const DeviceDesc& desc)
          .debug_name = "default_upload_heap"}
     );
 
+    m_transient_upload_heap = create_memory_heap(
+        {.memory_type = MemoryType::upload,
+         .usage = ResourceUsage::none,
+         .page_size = 1024 * 1024 * 4,
+         .ring_buffer = true,
+         .debug_name = "transient_upload_heap"}
+    );
+
     m_read_back_heap = create_memory_heap(
         {.memory_type = MemoryType::read_back,
          .usage = ResourceUsage::none,
@@ -523,6 +535,253 @@ ShaderCacheStats Device::shader_cache_stats() const
     };
 }
 
+PipelineCacheStats Device::pipeline_cache_stats() const
+{
+    std::lock_guard lock(m_pipeline_cache_mutex);
+    PipelineCacheStats stats = m_pipeline_cache_stats;
+    stats.entry_count = m_pipeline_cache.size();
+    return stats;
+}
+
+void Device::clear_pipeline_cache()
+{
+    std::lock_guard lock(m_pipeline_cache_mutex);
+    m_pipeline_cache.clear();
+}
+
+void Device::set_pipeline_cache_capacity(size_t capacity)
+{
+    SGL_CHECK(capacity > 0, "Invalid pipeline cache capacity, must be at least 1");
+
+    std::vector<Slang::ComPtr<gfx::IPipelineState>> evicted;
+    {
+        std::lock_guard lock(m_pipeline_cache_mutex);
+        m_pipeline_cache_capacity = capacity;
+        evict_pipeline_cache_entries(evicted);
+    }
+    for (const auto& pipeline_state : evicted)
+        deferred_release(pipeline_state);
+}
+
+void Device::evict_pipeline_cache_entries(std::vector<Slang::ComPtr<gfx::IPipelineState>>& evicted)
+{
+    while (m_pipeline_cache.size() > m_pipeline_cache_capacity) {
+        auto lru = std::min_element(
+            m_pipeline_cache.begin(),
+            m_pipeline_cache.end(),
+            [](const auto& a, const auto& b) { return a.second.last_use < b.second.last_use; }
+        );
+        evicted.push_back(std::move(lru->second.pipeline_state));
+        m_pipeline_cache.erase(lru);
+        m_pipeline_cache_stats.eviction_count++;
+    }
+}
+
+Slang::ComPtr<gfx::IPipelineState> Device::_get_or_create_pipeline_state(
+    const std::string& key,
+    const std::function<Slang::ComPtr<gfx::IPipelineState>()>& create,
+    std::span<ISlangUnknown* const> dependencies
+)
+{
+    {
+        std::lock_guard lock(m_pipeline_cache_mutex);
+        auto it = m_pipeline_cache.find(key);
+        if (it != m_pipeline_cache.end()) {
+            m_pipeline_cache_stats.hit_count++;
+            it->second.last_use = ++m_pipeline_cache_use_counter;
+            return it->second.pipeline_state;
+        }
+    }
+
+    // Create the pipeline state outside of the lock, as this can take a while.
+    Slang::ComPtr<gfx::IPipelineState> pipeline_state = create();
+
+    PipelineCacheEntry entry{.pipeline_state = pipeline_state};
+    for (ISlangUnknown* dependency : dependencies)
+        if (dependency)
+            entry.dependencies.push_back(Slang::ComPtr<ISlangUnknown>(dependency));
+
+    // Evicted pipeline states may still be in use on the GPU, so they are released deferred.
+    std::vector<Slang::ComPtr<gfx::IPipelineState>> evicted;
+    {
+        std::lock_guard lock(m_pipeline_cache_mutex);
+        m_pipeline_cache_stats.miss_count++;
+        entry.last_use = ++m_pipeline_cache_use_counter;
+        m_pipeline_cache.try_emplace(key, std::move(entry));
+        evict_pipeline_cache_entries(evicted);
+    }
+    for (const auto& evicted_pipeline_state : evicted)
+        deferred_release(evicted_pipeline_state);
+    return pipeline_state;
+}
+
+void Device::_remove_cached_pipeline_state(const std::string& key)
+{
+    std::lock_guard lock(m_pipeline_cache_mutex);
+    m_pipeline_cache.erase(key);
+}
+
+/// Escape tabs, newlines and backslashes for storing a string in a single manifest field.
+static std::string escape_manifest_field(std::string_view str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        default:
+            result += c;
+        }
+    }
+    return result;
+}
+
+static std::string unescape_manifest_field(std::string_view str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (str[i] == '\\' && i + 1 < str.size()) {
+            char c = str[++i];
+            result += c == 't' ? '\t' : c == 'n' ? '\n' : c == 'r' ? '\r' : c;
+        } else {
+            result += str[i];
+        }
+    }
+    return result;
+}
+
+void Device::_record_pipeline_manifest_entry(const ShaderProgram* program)
+{
+    if (!m_record_pipeline_manifest)
+        return;
+
+    // Only programs loaded from the default session without link options can be reloaded from the manifest.
+    const auto& load_desc = program->load_desc();
+    if (program->session() != m_slang_session.get() || !load_desc || load_desc->link_options)
+        return;
+
+    // Manifest entries are stored as tab separated fields:
+    // kind (always "compute"), module name, additional source ('+' prefixed, or '-' if none), entry point names.
+    std::vector<std::string> fields;
+    fields.push_back("compute");
+    fields.push_back(escape_manifest_field(load_desc->module_name));
+    fields.push_back(
+        load_desc->additional_source ? "+" + escape_manifest_field(*load_desc->additional_source) : std::string{"-"}
+    );
+    for (const auto& name : load_desc->entry_point_names)
+        fields.push_back(escape_manifest_field(name));
+
+    std::lock_guard lock(m_pipeline_cache_mutex);
+    m_pipeline_manifest.insert(string::join(fields, "\t"));
+}
+
+static std::filesystem::path get_pipeline_manifest_path(
+    const std::optional<std::filesystem::path>& path,
+    bool cache_enabled,
+    const std::filesystem::path& cache_path
+)
+{
+    if (path)
+        return *path;
+    SGL_CHECK(cache_enabled, "No pipeline manifest path specified and shader cache is disabled.");
+    return cache_path / "pipeline_manifest.txt";
+}
+
+void Device::save_pipeline_manifest(std::optional<std::filesystem::path> path) const
+{
+    std::filesystem::path manifest_path = get_pipeline_manifest_path(path, m_shader_cache_enabled, m_shader_cache_path);
+
+    std::ofstream stream(manifest_path, std::ios::trunc);
+    SGL_CHECK(stream.good(), "Failed to open pipeline manifest \"{}\" for writing.", manifest_path);
+
+    std::lock_guard lock(m_pipeline_cache_mutex);
+    for (const std::string& entry : m_pipeline_manifest)
+        stream << entry << "\n";
+
+    log_debug("Saved pipeline manifest with {} entries to \"{}\"", m_pipeline_manifest.size(), manifest_path);
+}
+
+size_t Device::warm_up_pipeline_cache(std::optional<std::filesystem::path> path)
+{
+    std::filesystem::path manifest_path = get_pipeline_manifest_path(path, m_shader_cache_enabled, m_shader_cache_path);
+    if (!path && !std::filesystem::exists(manifest_path))
+        return 0;
+
+    std::ifstream stream(manifest_path);
+    SGL_CHECK(stream.good(), "Failed to open pipeline manifest \"{}\".", manifest_path);
+
+    std::vector<ShaderProgramLoadDesc> entries;
+    std::string line;
+    while (std::getline(stream, line)) {
+        std::vector<std::string> fields = string::split(line, "\t");
+        if (fields.size() < 3 || fields[2].empty()) {
+            log_warn("Skipping invalid pipeline manifest entry \"{}\".", line);
+            continue;
+        }
+        // Only compute pipelines can be recreated from the program alone (see save_pipeline_manifest).
+        if (fields[0] != "compute") {
+            log_warn(
+                "Skipping pipeline manifest entry of unsupported kind \"{}\" (only compute pipelines are warmed up).",
+                fields[0]
+            );
+            continue;
+        }
+        ShaderProgramLoadDesc desc;
+        desc.module_name = unescape_manifest_field(fields[1]);
+        if (fields[2][0] == '+')
+            desc.additional_source = unescape_manifest_field(std::string_view(fields[2]).substr(1));
+        for (size_t i = 3; i < fields.size(); ++i)
+            desc.entry_point_names.push_back(unescape_manifest_field(fields[i]));
+        entries.push_back(std::move(desc));
+    }
+
+    Timer timer;
+
+    // Programs are loaded and pipelines created one after another. Both compile code through the
+    // default slang session, which is not thread-safe and serializes compilation with its lock.
+    size_t count = 0;
+    for (const ShaderProgramLoadDesc& desc : entries) {
+        try {
+            std::vector<std::string_view> entry_point_names(
+                desc.entry_point_names.begin(),
+                desc.entry_point_names.end()
+            );
+            ref<ShaderProgram> program
+                = m_slang_session->load_program(desc.module_name, std::move(entry_point_names), desc.additional_source);
+            create_compute_pipeline({.program = program});
+            count++;
+        } catch (const std::exception& e) {
+            log_warn("Failed to warm up pipeline for module \"{}\":\n{}", desc.module_name, e.what());
+        }
+    }
+
+    log_debug(
+        "Warming up {} of {} pipeline manifest entries took {}",
+        count,
+        entries.size(),
+        string::format_duration(timer.elapsed_s())
+    );
+    return count;
+}
+
+std::future<size_t> Device::warm_up_pipeline_cache_async(std::optional<std::filesystem::path> path)
+{
+    return thread::do_async([self = ref(this), path = std::move(path)]() mutable
+                            { return self->warm_up_pipeline_cache(std::move(path)); });
+}
+
 ResourceStateSet Device::get_format_supported_resource_states(Format format) const
 {
     gfx::ResourceStateSet gfx_state_set;
@@ -551,6 +810,7 @@ void Device::close()
     m_blitter.reset();
     m_debug_printer.reset();
 
+    m_transient_upload_heap.reset();
     m_read_back_heap.reset();
     m_upload_heap.reset();
 
@@ -561,6 +821,8 @@ void Device::close()
     m_transient_resource_heap_pool = {};
     m_deferred_release_queue = {};
 
+    m_pipeline_cache.clear();
+
     m_slang_session.reset();
     m_hot_reload.reset();
 
@@ -697,6 +959,11 @@ ref<ShaderProgram> Device::load_program(
     return m_slang_session->load_program(module_name, entry_point_names, additional_source, link_options);
 }
 
+std::future<ref<ShaderProgram>> Device::load_program_async(ShaderProgramLoadDesc desc)
+{
+    return m_slang_session->load_program_async(std::move(desc));
+}
+
 ref<MutableShaderObject> Device::create_mutable_shader_object(const ShaderProgram* shader_program)
 {
     ref<MutableShaderObject> shader_object = make_ref<MutableShaderObject>(ref<Device>(this), shader_program);
@@ -739,6 +1006,30 @@ ref<ComputeKernel> Device::create_compute_kernel(ComputeKernelDesc desc)
     return make_ref<ComputeKernel>(ref(this), std::move(desc));
 }
 
+ref<DispatchSequence> Device::create_dispatch_sequence()
+{
+    return make_ref<DispatchSequence>(ref(this));
+}
+
+std::future<ref<ComputePipeline>> Device::create_compute_pipeline_async(ComputePipelineDesc desc)
+{
+    return thread::do_async([self = ref(this), desc = std::move(desc)]() mutable
+                            { return self->create_compute_pipeline(std::move(desc)); });
+}
+
+std::future<ref<ComputeKernel>> Device::create_compute_kernel_async(ComputeKernelDesc desc)
+{
+    return thread::do_async(
+        [self = ref(this), desc = std::move(desc)]() mutable
+        {
+            ref<ComputeKernel> kernel = self->create_compute_kernel(std::move(desc));
+            // Create the pipeline up front so the first dispatch does not stall.
+            kernel->pipeline();
+            return kernel;
+        }
+    );
+}
+
 ref<CommandBuffer> Device::create_command_buffer()
 {
     SGL_ASSERT(m_shared_command_buffer == nullptr);
@@ -793,7 +1084,7 @@ CommandBuffer* Device::_begin_shared_command_buffer()
     return command_buffer;
 }
 
-void Device::_end_shared_command_buffer(bool wait)
+uint64_t Device::_end_shared_command_buffer(bool wait, bool submit)
 {
     SGL_ASSERT(m_open_command_buffer);
 
@@ -803,7 +1094,7 @@ void Device::_end_shared_command_buffer(bool wait)
         id = submit_command_buffer(m_shared_command_buffer);
         m_shared_command_buffer.reset();
     } else {
-        if (wait) {
+        if (wait || submit) {
             CommandBuffer* command_buffer = m_open_command_buffer;
             command_buffer->close();
             id = submit_command_buffer(command_buffer);
@@ -812,6 +1103,7 @@ void Device::_end_shared_command_buffer(bool wait)
     }
     if (wait)
         wait_command_buffer(id);
+    return id;
 }
 
 uint64_t Device::submit_command_buffer(CommandBuffer* command_buffer, CommandQueueType queue)
@@ -888,9 +1180,13 @@ void Device::run_garbage_collection()
         m_current_transient_resource_heap.setNull();
     }
 
+    // Retire pages of the transient upload heap used by the work submitted so far.
+    m_transient_upload_heap->retire_pages(signaled_value);
+
     // Execute deferred releases on the upload and read-back heaps.
     m_upload_heap->execute_deferred_releases();
     m_read_back_heap->execute_deferred_releases();
+    m_transient_upload_heap->execute_deferred_releases();
 
     uint64_t current_value = m_global_fence->current_value();
 
@@ -918,15 +1214,25 @@ ref<MemoryHeap> Device::create_memory_heap(MemoryHeapDesc desc)
     return make_ref<MemoryHeap>(ref<Device>(this), m_global_fence, std::move(desc));
 }
 
-void Device::flush_print()
+ref<BufferPool> Device::create_buffer_pool(BufferPoolDesc desc)
+{
+    return make_ref<BufferPool>(ref<Device>(this), std::move(desc));
+}
+
+ref<Profiler> Device::create_profiler(ProfilerDesc desc)
+{
+    return make_ref<Profiler>(ref<Device>(this), m_global_fence, std::move(desc));
+}
+
+void Device::flush_print(bool wait)
 {
     if (m_debug_printer)
-        m_debug_printer->flush();
+        m_debug_printer->flush(wait);
 }
 
-std::string Device::flush_print_to_string()
+std::string Device::flush_print_to_string(bool wait)
 {
-    return m_debug_printer ? m_debug_printer->flush_to_string() : "";
+    return m_debug_printer ? m_debug_printer->flush_to_string(wait) : "";
 }
 
 void Device::wait()
@@ -941,28 +1247,34 @@ void Device::upload_buffer_data(Buffer* buffer, const void* data, size_t size, s
     SGL_CHECK(offset + size <= buffer->size(), "Buffer write is out of bounds");
     SGL_CHECK_NOT_NULL(data);
 
-    auto alloc = m_upload_heap->allocate(size, TEXTURE_UPLOAD_ALIGNMENT);
+    auto alloc = m_transient_upload_heap->allocate_transient(size, TEXTURE_UPLOAD_ALIGNMENT);
 
-    std::memcpy(alloc->data, data, size);
+    std::memcpy(alloc.data, data, size);
 
     CommandBuffer* command_buffer = _begin_shared_command_buffer();
-    command_buffer->copy_buffer_region(buffer, offset, alloc->buffer, alloc->offset, size);
+    command_buffer->copy_buffer_region(buffer, offset, alloc.buffer, alloc.offset, size);
     _end_shared_command_buffer(false);
 }
 
 void Device::read_buffer_data(const Buffer* buffer, void* data, size_t size, size_t offset)
+{
+    SGL_CHECK_NOT_NULL(data);
+
+    read_buffer_data_async(buffer, size, offset)->get_data(data, size);
+}
+
+ref<ReadBackRequest> Device::read_buffer_data_async(const Buffer* buffer, size_t size, size_t offset)
 {
     SGL_CHECK_NOT_NULL(buffer);
     SGL_CHECK(offset + size <= buffer->size(), "Buffer read is out of bounds");
-    SGL_CHECK_NOT_NULL(data);
 
     auto alloc = m_read_back_heap->allocate(size, TEXTURE_UPLOAD_ALIGNMENT);
 
     CommandBuffer* command_buffer = _begin_shared_command_buffer();
     command_buffer->copy_buffer_region(alloc->buffer, alloc->offset, buffer, offset, size);
-    _end_shared_command_buffer(true);
+    uint64_t submission_id = _end_shared_command_buffer(false, true);
 
-    std::memcpy(data, alloc->data, size);
+    return make_ref<ReadBackRequest>(ref<Device>(this), submission_id, std::move(alloc), size);
 }
 
 void Device::upload_texture_data(Texture* texture, uint32_t subresource, SubresourceData subresource_data)
@@ -976,6 +1288,11 @@ void Device::upload_texture_data(Texture* texture, uint32_t subresource, Subreso
 }
 
 OwnedSubresourceData Device::read_texture_data(const Texture* texture, uint32_t subresource)
+{
+    return read_texture_data_async(texture, subresource)->get_subresource_data();
+}
+
+ref<ReadBackRequest> Device::read_texture_data_async(const Texture* texture, uint32_t subresource)
 {
     SGL_CHECK_NOT_NULL(texture);
     SGL_CHECK_LT(subresource, texture->subresource_count());
@@ -994,26 +1311,9 @@ OwnedSubresourceData Device::read_texture_data(const Texture* texture, uint32_t
         texture,
         subresource
     );
-    _end_shared_command_buffer(true);
-
-    OwnedSubresourceData subresource_data;
-    subresource_data.size = layout.total_size();
-    subresource_data.owned_data = std::make_unique<uint8_t[]>(subresource_data.size);
-    subresource_data.data = subresource_data.owned_data.get();
-    subresource_data.row_pitch = layout.row_pitch;
-    subresource_data.slice_pitch = layout.row_count * layout.row_pitch;
-
-    const uint8_t* src = alloc->data;
-    uint8_t* dst = subresource_data.owned_data.get();
-    for (uint32_t depth = 0; depth < layout.depth; ++depth) {
-        for (uint32_t row = 0; row < layout.row_count; ++row) {
-            std::memcpy(dst, src, layout.row_pitch);
-            src += layout.row_pitch_aligned;
-            dst += layout.row_pitch;
-        }
-    }
+    uint64_t submission_id = _end_shared_command_buffer(false, true);
 
-    return subresource_data;
+    return make_ref<ReadBackRequest>(ref<Device>(this), submission_id, std::move(alloc), layout.total_size(), layout);
 }
 
 void Device::deferred_release(ISlangUnknown* object)
@@ -1198,4 +1498,89 @@ Blitter* Device::_blitter()
     return m_blitter;
 }
 
+// ----------------------------------------------------------------------------
+// ReadBackRequest
+// ----------------------------------------------------------------------------
+
+ReadBackRequest::ReadBackRequest(
+    ref<Device> device,
+    uint64_t submission_id,
+    MemoryHeap::Allocation allocation,
+    size_t size,
+    std::optional<SubresourceLayout> layout
+)
+    : m_device(std::move(device))
+    , m_submission_id(submission_id)
+    , m_allocation(std::move(allocation))
+    , m_size(size)
+    , m_layout(layout)
+{
+}
+
+ReadBackRequest::~ReadBackRequest() = default;
+
+bool ReadBackRequest::is_ready() const
+{
+    return m_device->is_command_buffer_complete(m_submission_id);
+}
+
+void ReadBackRequest::wait() const
+{
+    m_device->wait_command_buffer(m_submission_id);
+}
+
+void ReadBackRequest::get_data(void* data, size_t size) const
+{
+    SGL_CHECK_NOT_NULL(data);
+    SGL_CHECK(size >= m_size, "Destination is too small ({} < {})", size, m_size);
+
+    wait();
+
+    if (!m_layout) {
+        std::memcpy(data, m_allocation->data, m_size);
+        return;
+    }
+
+    // Remove row alignment of texture data.
+    const uint8_t* src = m_allocation->data;
+    uint8_t* dst = static_cast<uint8_t*>(data);
+    for (uint32_t depth = 0; depth < m_layout->depth; ++depth) {
+        for (uint32_t row = 0; row < m_layout->row_count; ++row) {
+            std::memcpy(dst, src, m_layout->row_pitch);
+            src += m_layout->row_pitch_aligned;
+            dst += m_layout->row_pitch;
+        }
+    }
+}
+
+OwnedSubresourceData ReadBackRequest::get_subresource_data() const
+{
+    SGL_CHECK(m_layout, "Read-back request does not contain texture data");
+
+    OwnedSubresourceData subresource_data;
+    subresource_data.size = m_size;
+    subresource_data.owned_data = std::make_unique<uint8_t[]>(subresource_data.size);
+    subresource_data.data = subresource_data.owned_data.get();
+    subresource_data.row_pitch = m_layout->row_pitch;
+    subresource_data.slice_pitch = m_layout->row_count * m_layout->row_pitch;
+
+    get_data(subresource_data.owned_data.get(), subresource_data.size);
+
+    return subresource_data;
+}
+
+std::string ReadBackRequest::to_string() const
+{
+    return fmt::format(
+        "ReadBackRequest(\n"
+        "  submission_id = {},\n"
+        "  size = {},\n"
+        "  is_ready = {}\n"
+        ")",
+        m_submission_id,
+        m_size,
+        is_ready()
+    );
+}
+
 } // namespace sgl
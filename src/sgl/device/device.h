@@ -7,6 +7,9 @@
 #include "sgl/device/native_handle.h"
 #include "sgl/device/resource.h"
 #include "sgl/device/shader.h"
+#include "sgl/device/memory_heap.h"
+#include "sgl/device/buffer_pool.h"
+#include "sgl/device/profiler.h"
 
 #include "sgl/core/fwd.h"
 #include "sgl/core/config.h"
@@ -19,8 +22,15 @@
 #include <slang-gfx.h>
 
 #include <array>
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <span>
 #include <string>
 #include <vector>
 #include <queue>
@@ -174,6 +184,69 @@ struct ShaderCacheStats {
     size_t miss_count;
 };
 
+struct PipelineCacheStats {
+    /// Number of pipelines in the cache.
+    size_t entry_count;
+    /// Number of pipelines reused from the cache.
+    size_t hit_count;
+    /// Number of pipelines created and added to the cache.
+    size_t miss_count;
+    /// Number of least recently used pipelines evicted from the cache.
+    size_t eviction_count;
+};
+
+/**
+ * \brief Handle to an asynchronous read-back of buffer or texture data to host memory.
+ *
+ * The copy is submitted to the device when the request is created (see \c Device::read_buffer_data_async and
+ * \c Device::read_texture_data_async). The request is tied to the submission ID of the command buffer containing
+ * the copy and keeps the read-back heap allocation alive until it is destroyed.
+ */
+class SGL_API ReadBackRequest : public Object {
+    SGL_OBJECT(ReadBackRequest)
+public:
+    ReadBackRequest(
+        ref<Device> device,
+        uint64_t submission_id,
+        MemoryHeap::Allocation allocation,
+        size_t size,
+        std::optional<SubresourceLayout> layout = {}
+    );
+    ~ReadBackRequest();
+
+    /// Submission ID of the command buffer containing the copy.
+    uint64_t submission_id() const { return m_submission_id; }
+
+    /// Size of the read-back data in bytes (rows of texture data are tightly packed).
+    size_t size() const { return m_size; }
+
+    /// True if the copy has completed and the data is available.
+    bool is_ready() const;
+
+    /// Block until the copy has completed.
+    void wait() const;
+
+    /**
+     * \brief Copy the read-back data to host memory. Blocks until the copy has completed.
+     *
+     * \param data Destination to copy to.
+     * \param size Size of the destination in bytes (needs to be at least \c size()).
+     */
+    void get_data(void* data, size_t size) const;
+
+    /// Get the read-back texture subresource data. Blocks until the copy has completed.
+    OwnedSubresourceData get_subresource_data() const;
+
+    std::string to_string() const override;
+
+private:
+    ref<Device> m_device;
+    uint64_t m_submission_id;
+    MemoryHeap::Allocation m_allocation;
+    size_t m_size;
+    std::optional<SubresourceLayout> m_layout;
+};
+
 class SGL_API Device : public Object {
     SGL_OBJECT(Device)
 public:
@@ -193,6 +266,60 @@ public:
     /// Shader cache statistics.
     ShaderCacheStats shader_cache_stats() const;
 
+    /// Pipeline cache statistics.
+    PipelineCacheStats pipeline_cache_stats() const;
+
+    /**
+     * \brief Clear the pipeline cache.
+     *
+     * Compute and graphics pipelines share the underlying pipeline state if they are created
+     * from programs with the same hash (see \ref ShaderProgram::hash) and the same state.
+     * Pipeline states are kept in the cache until it is cleared, the device is closed or they
+     * are evicted (see \ref pipeline_cache_capacity).
+     */
+    void clear_pipeline_cache();
+
+    /// Maximum number of pipeline states kept in the pipeline cache.
+    /// The least recently used pipeline states are evicted when the cache exceeds this size.
+    size_t pipeline_cache_capacity() const { return m_pipeline_cache_capacity; }
+    void set_pipeline_cache_capacity(size_t capacity);
+
+    /// Enable/disable recording of created pipelines into the pipeline manifest.
+    bool record_pipeline_manifest() const { return m_record_pipeline_manifest; }
+    void set_record_pipeline_manifest(bool enable) { m_record_pipeline_manifest = enable; }
+
+    /**
+     * \brief Save the pipeline manifest.
+     *
+     * The manifest lists the programs of all compute pipelines created while recording was enabled.
+     * Only programs loaded with \ref load_program (using the default slang session) are recorded.
+     * Graphics and ray tracing pipelines are not recorded: they depend on state that is only known
+     * at creation time (input layout, framebuffer layout, rasterizer state, ...), so they cannot be
+     * recreated from a program description alone.
+     *
+     * \param path Path of the manifest file. Defaults to "pipeline_manifest.txt" in the shader cache directory.
+     */
+    void save_pipeline_manifest(std::optional<std::filesystem::path> path = {}) const;
+
+    /**
+     * \brief Precompile the programs and compute pipelines listed in a pipeline manifest.
+     *
+     * The entries are processed one after another on the calling thread, populating the pipeline cache
+     * before first use. They are not compiled in parallel: loading and pipeline creation go through the
+     * default slang session, which serializes compilation. Use \ref warm_up_pipeline_cache_async to
+     * run the warm-up on the global thread pool during startup.
+     * Entries that fail to load are skipped with a warning, as are entries of kinds other than compute.
+     *
+     * \param path Path of the manifest file. Defaults to "pipeline_manifest.txt" in the shader cache directory,
+     * which is silently ignored if it does not exist.
+     * \return Number of precompiled manifest entries.
+     */
+    size_t warm_up_pipeline_cache(std::optional<std::filesystem::path> path = {});
+
+    /// Run \ref warm_up_pipeline_cache on the global thread pool.
+    /// The device must be kept alive (and not closed) until the returned future is ready.
+    std::future<size_t> warm_up_pipeline_cache_async(std::optional<std::filesystem::path> path = {});
+
     /// The highest shader model supported by the device.
     ShaderModel supported_shader_model() const { return m_supported_shader_model; }
 
@@ -386,6 +513,9 @@ public:
         std::optional<SlangLinkOptions> link_options = {}
     );
 
+    /// Load a program on the global thread pool (see \ref SlangSession::load_program_async).
+    std::future<ref<ShaderProgram>> load_program_async(ShaderProgramLoadDesc desc);
+
     void reload_all_programs();
 
     ref<MutableShaderObject> create_mutable_shader_object(const ShaderProgram* shader_program);
@@ -402,13 +532,25 @@ public:
 
     ref<ComputeKernel> create_compute_kernel(ComputeKernelDesc desc);
 
+    /// Create an empty sequence for recording and re-submitting compute dispatches.
+    ref<DispatchSequence> create_dispatch_sequence();
+
+    /// Create a compute pipeline on the global thread pool.
+    std::future<ref<ComputePipeline>> create_compute_pipeline_async(ComputePipelineDesc desc);
+
+    /// Create a compute kernel (including its pipeline) on the global thread pool.
+    std::future<ref<ComputeKernel>> create_compute_kernel_async(ComputeKernelDesc desc);
+
     ref<CommandBuffer> create_command_buffer();
 
     void _set_open_command_buffer(CommandBuffer* command_buffer);
     Slang::ComPtr<gfx::ITransientResourceHeap> _get_or_create_transient_resource_heap();
 
     CommandBuffer* _begin_shared_command_buffer();
-    void _end_shared_command_buffer(bool wait);
+    /// End recording to the shared command buffer and submit it.
+    /// The currently open command buffer (if not the shared one) is only submitted if \c wait or \c submit is set.
+    /// Returns the submission ID (or 0 if nothing was submitted).
+    uint64_t _end_shared_command_buffer(bool wait, bool submit = false);
 
     /**
      * \brief Submit a command buffer to the device.
@@ -470,16 +612,30 @@ public:
 
     ref<MemoryHeap> create_memory_heap(MemoryHeapDesc desc);
 
+    /// Create a pool for suballocating persistent device-local buffer memory.
+    ref<BufferPool> create_buffer_pool(BufferPoolDesc desc);
+
+    /// Create a scoped CPU/GPU profiler.
+    ref<Profiler> create_profiler(ProfilerDesc desc);
+
     MemoryHeap* upload_heap() const { return m_upload_heap; }
     MemoryHeap* read_back_heap() const { return m_read_back_heap; }
 
     DebugPrinter* debug_printer() const { return m_debug_printer.get(); }
 
-    /// Block and flush all shader side debug print output.
-    void flush_print();
+    /**
+     * Flush all shader side debug print output.
+     * \param wait If true, block until all output is available. Otherwise don't wait for
+     *     pending GPU work and print the output of earlier flushes instead.
+     */
+    void flush_print(bool wait = true);
 
-    /// Block and flush all shader side debug print output to a string.
-    std::string flush_print_to_string();
+    /**
+     * Flush all shader side debug print output to a string.
+     * \param wait If true, block until all output is available. Otherwise don't wait for
+     *     pending GPU work and return the output of earlier flushes instead.
+     */
+    std::string flush_print_to_string(bool wait = true);
 
     /// Wait for all device work to complete.
     void wait();
@@ -505,6 +661,17 @@ public:
      */
     void read_buffer_data(const Buffer* buffer, void* data, size_t size, size_t offset = 0);
 
+    /**
+     * Read buffer data to host memory without blocking.
+     * The copy is submitted immediately, the returned request can be polled or waited on.
+     *
+     * \param buffer Buffer to read from.
+     * \param size Size of the data in bytes.
+     * \param offset Offset in the buffer to read from.
+     * \return Read-back request.
+     */
+    ref<ReadBackRequest> read_buffer_data_async(const Buffer* buffer, size_t size, size_t offset = 0);
+
     /**
      * Upload host memory to texture.
      *
@@ -524,6 +691,16 @@ public:
      */
     OwnedSubresourceData read_texture_data(const Texture* texture, uint32_t subresource);
 
+    /**
+     * Read texture data to host memory without blocking.
+     * The copy is submitted immediately, the returned request can be polled or waited on.
+     *
+     * \param texture Texture to read from.
+     * \param subresource Subresource index.
+     * \return Read-back request.
+     */
+    ref<ReadBackRequest> read_texture_data_async(const Texture* texture, uint32_t subresource);
+
     void deferred_release(ISlangUnknown* object);
 
     gfx::IDevice* gfx_device() const { return m_gfx_device; }
@@ -570,6 +747,16 @@ public:
     Blitter* _blitter();
     HotReload* _hot_reload() { return m_hot_reload; }
 
+    /// Internal: look up a pipeline state in the pipeline cache, or create and add it.
+    /// The cache keeps the given dependencies (e.g. layouts identified by the key) alive.
+    Slang::ComPtr<gfx::IPipelineState> _get_or_create_pipeline_state(
+        const std::string& key,
+        const std::function<Slang::ComPtr<gfx::IPipelineState>()>& create,
+        std::span<ISlangUnknown* const> dependencies = {}
+    );
+    void _remove_cached_pipeline_state(const std::string& key);
+    void _record_pipeline_manifest_entry(const ShaderProgram* program);
+
 private:
     DeviceDesc m_desc;
     DeviceInfo m_info;
@@ -592,6 +779,8 @@ private:
 
     ref<MemoryHeap> m_upload_heap;
     ref<MemoryHeap> m_read_back_heap;
+    /// Ring-buffer heap used for uploads recorded to the shared command buffer.
+    ref<MemoryHeap> m_transient_upload_heap;
 
     std::unique_ptr<DebugPrinter> m_debug_printer;
 
@@ -625,6 +814,26 @@ private:
     ref<Blitter> m_blitter;
     ref<HotReload> m_hot_reload;
 
+    struct PipelineCacheEntry {
+        Slang::ComPtr<gfx::IPipelineState> pipeline_state;
+        std::vector<Slang::ComPtr<ISlangUnknown>> dependencies;
+        /// Value of the use counter at the last lookup (for least recently used eviction).
+        uint64_t last_use{0};
+    };
+
+    /// Evict least recently used entries until the cache fits its capacity.
+    /// Evicted pipeline states are appended to \c evicted, so they can be released outside of the lock.
+    void evict_pipeline_cache_entries(std::vector<Slang::ComPtr<gfx::IPipelineState>>& evicted);
+
+    std::map<std::string, PipelineCacheEntry> m_pipeline_cache;
+    PipelineCacheStats m_pipeline_cache_stats{};
+    size_t m_pipeline_cache_capacity{1024};
+    uint64_t m_pipeline_cache_use_counter{0};
+    std::atomic<bool> m_record_pipeline_manifest{false};
+    /// Serialized manifest entries (one per line in the manifest file).
+    std::set<std::string> m_pipeline_manifest;
+    mutable std::mutex m_pipeline_cache_mutex;
+
     bool m_supports_cuda_interop{false};
     ref<cuda::Device> m_cuda_device;
     ref<cuda::ExternalSemaphore> m_cuda_semaphore;
@@ -10,6 +10,7 @@ namespace sgl {
 
 struct DeviceDesc;
 class Device;
+class ReadBackRequest;
 
 // swapchain.h
 
@@ -21,6 +22,7 @@ class Swapchain;
 class Resource;
 
 struct BufferDesc;
+struct BufferRange;
 class Buffer;
 
 struct TextureDesc;
@@ -83,6 +85,7 @@ class ProgramLayoutEntryPointList;
 class Kernel;
 struct ComputeKernelDesc;
 class ComputeKernel;
+class DispatchSequence;
 
 // pipeline.h
 
@@ -130,6 +133,16 @@ class InputLayout;
 struct MemoryHeapDesc;
 class MemoryHeap;
 
+// buffer_pool.h
+
+struct BufferPoolDesc;
+class BufferPool;
+
+// profiler.h
+
+struct ProfilerDesc;
+class Profiler;
+
 // blit.h
 
 class Blitter;
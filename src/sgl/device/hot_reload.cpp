@@ -3,12 +3,125 @@
 #include "hot_reload.h"
 
 #include "sgl/core/file_system_watcher.h"
+#include "sgl/core/hash.h"
+#include "sgl/core/platform.h"
 #include "sgl/device/shader.h"
+#include "sgl/device/slang_utils.h"
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <optional>
 
 namespace sgl {
 
+/// Read the contents of a file, returns an empty optional if the file cannot be read.
+static std::optional<std::string> read_file(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+        return {};
+    return std::string{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+}
+
+/// Hash file contents. Never returns 0, which is used for missing files.
+static uint64_t hash_contents(const std::string& contents)
+{
+    return hash_data(contents.data(), contents.size()) | 1;
+}
+
+/// Hash the contents of a file, returns 0 if the file cannot be read.
+static uint64_t hash_file(const std::filesystem::path& path)
+{
+    std::optional<std::string> contents = read_file(path);
+    return contents ? hash_contents(*contents) : 0;
+}
+
+/// File system used by slang sessions with hot reload enabled.
+/// Records the content hash of every slang file a session reads, i.e. of the exact
+/// contents modules are compiled from. Hashing the files after loading could
+/// miss a save landing between slang reading a file and hashing it.
+class HotReload::FileSystem : public ISlangFileSystem {
+public:
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL queryInterface(SlangUUID const& uuid, void** outObject) override
+    {
+        void* object = castAs(uuid);
+        if (!object)
+            return SLANG_E_NO_INTERFACE;
+        addRef();
+        *outObject = object;
+        return SLANG_OK;
+    }
+
+    virtual SLANG_NO_THROW uint32_t SLANG_MCALL addRef() override { return ++m_ref_count; }
+
+    virtual SLANG_NO_THROW uint32_t SLANG_MCALL release() override
+    {
+        uint32_t ref_count = --m_ref_count;
+        if (ref_count == 0)
+            delete this;
+        return ref_count;
+    }
+
+    virtual SLANG_NO_THROW void* SLANG_MCALL castAs(SlangUUID const& uuid) override
+    {
+        if (uuid == ISlangUnknown::getTypeGuid() || uuid == ISlangCastable::getTypeGuid()
+            || uuid == ISlangFileSystem::getTypeGuid())
+            return static_cast<ISlangFileSystem*>(this);
+        return nullptr;
+    }
+
+    virtual SLANG_NO_THROW SlangResult SLANG_MCALL loadFile(char const* path, ISlangBlob** outBlob) override
+    {
+        std::optional<std::string> contents = read_file(path);
+        if (!contents)
+            return SLANG_E_NOT_FOUND;
+
+        if (platform::has_extension(path, "slang")) {
+            std::filesystem::path file_path = std::filesystem::absolute(path).lexically_normal().make_preferred();
+            uint64_t hash = hash_contents(*contents);
+            std::lock_guard lock(m_mutex);
+            auto [it, inserted] = m_file_hashes.try_emplace(file_path, hash);
+            // Sessions compiled from different contents, the file needs to be reloaded on any change.
+            if (!inserted && it->second != hash)
+                it->second = 0;
+        }
+
+        *outBlob = new StringSlangBlob(std::move(*contents));
+        (*outBlob)->addRef();
+        return SLANG_OK;
+    }
+
+    /// Content hash a file was last compiled from (0 if unknown).
+    uint64_t file_hash(const std::filesystem::path& path) const
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_file_hashes.find(path);
+        return it != m_file_hashes.end() ? it->second : 0;
+    }
+
+    /// Forget the hashes of the given files (all files if \c files is null) before they are reloaded.
+    void forget_files(const std::set<std::filesystem::path>* files)
+    {
+        std::lock_guard lock(m_mutex);
+        if (!files) {
+            m_file_hashes.clear();
+            return;
+        }
+        for (const auto& path : *files)
+            m_file_hashes.erase(path);
+    }
+
+private:
+    std::atomic<uint32_t> m_ref_count{0};
+    mutable std::mutex m_mutex;
+    /// Content hashes of the slang files read by sessions (0 if sessions read different contents).
+    std::map<std::filesystem::path, uint64_t> m_file_hashes;
+};
+
 HotReload::HotReload(ref<Device> device)
     : m_device(device.get())
+    , m_file_system(new FileSystem())
 {
     // Create file system monitor + hook up change event.
     m_file_system_watcher = make_ref<FileSystemWatcher>();
@@ -16,34 +129,64 @@ HotReload::HotReload(ref<Device> device)
                                          { on_file_system_event(events); });
 }
 
+HotReload::~HotReload() = default;
+
+ISlangFileSystem* HotReload::_file_system() const
+{
+    return m_file_system.get();
+}
+
 void HotReload::update()
 {
     // Update file system watcher, which in turn may cause on_file_system_event
     // to be called.
-    m_file_system_watcher->update();
+    std::set<std::filesystem::path> changed_files;
+    {
+        std::lock_guard lock(m_mutex);
+        m_file_system_watcher->update();
+        std::swap(changed_files, m_changed_files);
+    }
+
+    // Drop files whose contents haven't changed since they were compiled, editors and
+    // tools often touch files or write them several times without changing them.
+    std::erase_if(changed_files, [this](const std::filesystem::path& path) { return !has_file_changed(path); });
+
+    // Recreate sessions outside of the lock, as modules loaded during the
+    // recreate will update the watched paths.
+    if (!changed_files.empty()) {
+        m_last_changed_files = changed_files;
+        recreate_sessions(m_last_build_failed ? nullptr : &m_last_changed_files);
+    }
+}
+
+bool HotReload::has_file_changed(const std::filesystem::path& path) const
+{
+    uint64_t compiled_hash = m_file_system->file_hash(path);
+    return compiled_hash == 0 || hash_file(path) != compiled_hash;
 }
 
 void HotReload::on_file_system_event(std::span<FileSystemWatchEvent> events)
 {
-    // Simple check to see if any events involved .slang files.
-    auto fn_check = [](const FileSystemWatchEvent& e) { return platform::has_extension(e.path, "slang"); };
-    bool has_slang_files = std::find_if(events.begin(), events.end(), fn_check) != events.end();
-    if (!has_slang_files)
+    if (!m_auto_detect_changes)
         return;
 
-    // If slang files detected, recreate all existing sessions
-    if (m_auto_detect_changes)
-        recreate_all_sessions();
+    // Collect changed .slang files, sessions depending on them are recreated in update().
+    for (const FileSystemWatchEvent& event : events) {
+        if (platform::has_extension(event.path, "slang"))
+            m_changed_files.insert(event.absolute_path.lexically_normal().make_preferred());
+    }
 }
 
 
 void HotReload::_register_slang_session(SlangSession* session)
 {
+    std::lock_guard lock(m_mutex);
     m_all_slang_sessions.insert(session);
 }
 
 void HotReload::_unregister_slang_session(SlangSession* session)
 {
+    std::lock_guard lock(m_mutex);
     m_all_slang_sessions.erase(session);
 }
 
@@ -58,19 +201,52 @@ uint32_t HotReload::auto_detect_delay() const
 }
 void HotReload::set_auto_detect_delay(uint32_t delay_ms)
 {
+    std::lock_guard lock(m_mutex);
     m_file_system_watcher->set_delay(delay_ms);
 }
 
 void HotReload::recreate_all_sessions()
+{
+    recreate_sessions(nullptr);
+}
+
+void HotReload::recreate_dependent_sessions(std::span<const std::filesystem::path> changed_files)
+{
+    std::set<std::filesystem::path> files;
+    for (const auto& path : changed_files)
+        files.insert(std::filesystem::absolute(path).lexically_normal().make_preferred());
+
+    // Dependencies are unknown for modules that failed to build, so recreate everything.
+    recreate_sessions(m_last_build_failed ? nullptr : &files);
+}
+
+void HotReload::recreate_sessions(const std::set<std::filesystem::path>* changed_files)
 {
     // Iterate over sessions and build each one. This is in a try/catch
     // statement as we don't want programs to except as a result
     // of hot-reload compile errors. Instead, the error should be
     // logged and application carry on as usual.
+    std::vector<SlangSession*> sessions;
+    {
+        std::lock_guard lock(m_mutex);
+        sessions.assign(m_all_slang_sessions.begin(), m_all_slang_sessions.end());
+    }
+
+    // Recreated sessions read the files again and record the hashes of the new contents.
+    m_file_system->forget_files(changed_files);
+
+    // If changed files are given, only sessions depending on them are recreated.
+    bool reloaded = false;
     try {
         m_last_build_failed = false;
-        for (SlangSession* session : m_all_slang_sessions)
-            session->recreate_session();
+        for (SlangSession* session : sessions) {
+            if (changed_files) {
+                reloaded |= session->recreate_session(*changed_files);
+            } else {
+                session->recreate_session();
+                reloaded = true;
+            }
+        }
     } catch (SlangCompileError& compile_error) {
         log_error("Hot reload failed due to compile error");
         log_error(compile_error.what());
@@ -79,10 +255,12 @@ void HotReload::recreate_all_sessions()
         log_error("Hot reload failed due to incompatible shader modification");
         log_error(runtime_error.what());
         m_last_build_failed = true;
+        reloaded = true;
     }
 
     // Set has reloaded flag so testing system can detect changes
-    m_has_reloaded = true;
+    if (reloaded)
+        m_has_reloaded = true;
 }
 
 void HotReload::update_watched_paths_for_session(SlangSession* session)
@@ -105,6 +283,7 @@ void HotReload::update_watched_paths_for_session(SlangSession* session)
                     abs_path = abs_path.parent_path().make_preferred();
 
                     // If not already monitoring this path, add a watch for it.
+                    std::lock_guard lock(m_mutex);
                     if (!m_watched_paths.contains(abs_path)) {
                         m_file_system_watcher->add_watch({.directory = abs_path});
                         m_watched_paths.insert(abs_path);
@@ -117,6 +296,7 @@ void HotReload::update_watched_paths_for_session(SlangSession* session)
 
 void HotReload::_clear_file_watches()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& path : m_watched_paths) {
         m_file_system_watcher->remove_watch(path);
     }
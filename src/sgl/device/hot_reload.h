@@ -12,10 +12,14 @@
 #include "sgl/core/enum.h"
 
 #include <slang.h>
+#include <slang-com-ptr.h>
 
 #include <exception>
+#include <filesystem>
 #include <map>
+#include <mutex>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -23,15 +27,26 @@ namespace sgl {
 
 /// Shader hot reload management, detects when relevant slang files
 /// have been editor and triggers session recreates as necessary.
+/// Only programs depending on the changed files are relinked.
+/// Sessions read source files through a file system that records the
+/// content hash of the exact contents modules are compiled from, so that
+/// file system events that don't change the contents of a file (i.e.
+/// touching a file or saving it several times) don't trigger a reload.
 class SGL_API HotReload : public Object {
     SGL_OBJECT(HotReload)
 public:
     HotReload(ref<Device> device);
+    ~HotReload();
 
     /// Force immediate recreation of all registered sessions and
     /// any modules/programs they've loaded/linked.
     void recreate_all_sessions();
 
+    /// Recreate sessions that have modules depending on any of the given
+    /// files, only relinking the affected programs. Falls back to recreating
+    /// all sessions if the last attempt to recreate sessions failed.
+    void recreate_dependent_sessions(std::span<const std::filesystem::path> changed_files);
+
     /// Updates internal file system monitor for change detection.
     void update();
 
@@ -46,6 +61,9 @@ public:
     /// Return true if last attempt to recreate sessions failed with exception.
     bool last_build_failed() const { return m_last_build_failed; }
 
+    /// Files with changed contents that triggered the last reload in update().
+    const std::set<std::filesystem::path>& last_changed_files() const { return m_last_changed_files; }
+
     // Internal functions called from session constructor/destructor
     // to register sessions with hot reload system.
     void _register_slang_session(SlangSession* session);
@@ -54,6 +72,9 @@ public:
     // Called from session when modules have updated, meaning dependencies may have changed
     void _on_session_modules_changed(SlangSession* session);
 
+    /// File system used by sessions to load source files.
+    ISlangFileSystem* _file_system() const;
+
     /// Exclusively for testing, erase all existing file watches
     void _clear_file_watches();
     void _reset_reloaded() { m_has_reloaded = false; }
@@ -62,6 +83,13 @@ public:
 private:
     void on_file_system_event(std::span<FileSystemWatchEvent> events);
     void update_watched_paths_for_session(SlangSession* session);
+    void recreate_sessions(const std::set<std::filesystem::path>* changed_files);
+
+    /// Returns true if the contents of a file differ from the contents modules were compiled from
+    /// (or the file was not read by any session).
+    bool has_file_changed(const std::filesystem::path& path) const;
+
+    class FileSystem;
 
     Device* m_device;
     bool m_auto_detect_changes{true};
@@ -70,6 +98,20 @@ private:
     bool m_last_build_failed{false};
     std::set<std::filesystem::path> m_watched_paths;
     bool m_has_reloaded;
+
+    /// Changed slang files detected by the file system watcher, processed in update().
+    std::set<std::filesystem::path> m_changed_files;
+
+    /// Files with changed contents that triggered the last reload in update().
+    std::set<std::filesystem::path> m_last_changed_files;
+
+    /// File system recording the content hashes of source files read by sessions.
+    Slang::ComPtr<FileSystem> m_file_system;
+
+    /// Protects the session list, watched paths and file system watcher,
+    /// as sessions can load modules on worker threads.
+    /// Never held while recreating sessions (which lock the session mutex).
+    std::mutex m_mutex;
 };
 
 } // namespace sgl
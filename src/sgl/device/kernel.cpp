@@ -7,6 +7,8 @@
 #include "sgl/device/pipeline.h"
 #include "sgl/device/command.h"
 #include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
+#include "sgl/device/print.h"
 
 #include "sgl/core/maths.h"
 
@@ -69,6 +71,111 @@ void ComputeKernel::dispatch(uint3 thread_count, BindVarsCallback bind_vars, Com
         m_device->_end_shared_command_buffer(false);
 }
 
+// ----------------------------------------------------------------------------
+// DispatchSequence
+// ----------------------------------------------------------------------------
+
+DispatchSequence::DispatchSequence(ref<Device> device)
+    : DeviceResource(std::move(device))
+{
+}
+
+uint32_t DispatchSequence::record(ComputeKernel* kernel, uint3 thread_count, BindVarsCallback bind_vars)
+{
+    SGL_CHECK_NOT_NULL(kernel);
+    SGL_CHECK(kernel->device() == m_device.get(), "Kernel was created on a different device.");
+
+    uint32_t index = dispatch_count();
+    Dispatch& dispatch = m_dispatches.emplace_back(Dispatch{
+        .kernel = ref(kernel),
+        .bind_vars = std::move(bind_vars),
+    });
+    set_thread_count(index, thread_count);
+    try {
+        bind(dispatch);
+    } catch (...) {
+        m_dispatches.pop_back();
+        throw;
+    }
+    return index;
+}
+
+ComputeKernel* DispatchSequence::kernel(uint32_t index) const
+{
+    SGL_CHECK(index < dispatch_count(), "Dispatch index {} out of range.", index);
+    return m_dispatches[index].kernel;
+}
+
+MutableShaderObject* DispatchSequence::shader_object(uint32_t index) const
+{
+    SGL_CHECK(index < dispatch_count(), "Dispatch index {} out of range.", index);
+    return m_dispatches[index].shader_object;
+}
+
+ShaderCursor DispatchSequence::cursor(uint32_t index) const
+{
+    return ShaderCursor(shader_object(index));
+}
+
+void DispatchSequence::set_thread_count(uint32_t index, uint3 thread_count)
+{
+    SGL_CHECK(index < dispatch_count(), "Dispatch index {} out of range.", index);
+    Dispatch& dispatch = m_dispatches[index];
+    uint3 thread_group_size = dispatch.kernel->pipeline()->thread_group_size();
+    dispatch.thread_count = thread_count;
+    dispatch.thread_group_count = uint3{
+        div_round_up(thread_count.x, thread_group_size.x),
+        div_round_up(thread_count.y, thread_group_size.y),
+        div_round_up(thread_count.z, thread_group_size.z)};
+}
+
+void DispatchSequence::clear()
+{
+    m_dispatches.clear();
+}
+
+void DispatchSequence::encode(ComputeCommandEncoder& encoder)
+{
+    for (Dispatch& dispatch : m_dispatches) {
+        // Rebind after the program was hot reloaded.
+        if (dispatch.kernel->program()->generation() != dispatch.program_generation) {
+            bind(dispatch);
+            set_thread_count(narrow_cast<uint32_t>(&dispatch - m_dispatches.data()), dispatch.thread_count);
+        }
+        encoder.bind_pipeline(dispatch.kernel->pipeline(), dispatch.shader_object);
+        encoder.dispatch_thread_groups(dispatch.thread_group_count);
+    }
+}
+
+void DispatchSequence::submit(CommandBuffer* command_buffer)
+{
+    CommandBuffer* temp_command_buffer{nullptr};
+    if (command_buffer == nullptr) {
+        temp_command_buffer = m_device->_begin_shared_command_buffer();
+        command_buffer = temp_command_buffer;
+    }
+
+    {
+        auto encoder = command_buffer->encode_compute_commands();
+        encode(encoder);
+    }
+
+    if (temp_command_buffer)
+        m_device->_end_shared_command_buffer(false);
+}
+
+void DispatchSequence::bind(Dispatch& dispatch)
+{
+    const ShaderProgram* program = dispatch.kernel->program();
+    ref<MutableShaderObject> shader_object = m_device->create_mutable_shader_object(program);
+    if (m_device->debug_printer())
+        m_device->debug_printer()->bind(ShaderCursor(shader_object));
+    if (dispatch.bind_vars)
+        dispatch.bind_vars(ShaderCursor(shader_object));
+    dispatch.shader_object = std::move(shader_object);
+    dispatch.program_generation = program->generation();
+}
+
 // ----------------------------------------------------------------------------
 // RayTracingKernel
 // ----------------------------------------------------------------------------
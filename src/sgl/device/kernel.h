@@ -5,11 +5,14 @@
 #include "sgl/device/fwd.h"
 #include "sgl/device/device_resource.h"
 #include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
 
 #include "sgl/core/macros.h"
 #include "sgl/core/object.h"
+#include "sgl/core/type_utils.h"
 
 #include <functional>
+#include <vector>
 
 namespace sgl {
 
@@ -23,10 +26,16 @@ public:
     ShaderProgram* program() const { return m_program; }
     ReflectionCursor reflection() const { return ReflectionCursor(program()); }
 
+    /// Opaque cache of resolved parameter bindings.
+    /// Owned by the kernel but populated by language bindings (e.g. the Python `dispatch` method).
+    Object* binding_cache() const { return m_binding_cache; }
+    void set_binding_cache(ref<Object> binding_cache) { m_binding_cache = std::move(binding_cache); }
+
 protected:
     Kernel(ref<Device> device, ref<ShaderProgram> program);
 
     ref<ShaderProgram> m_program;
+    ref<Object> m_binding_cache;
 };
 
 struct ComputeKernelDesc {
@@ -66,4 +75,74 @@ private:
     mutable ref<RayTracingPipeline> m_pipeline;
 };
 
+/**
+ * Recorded sequence of compute dispatches.
+ *
+ * Each recorded dispatch owns a persistent mutable root shader object. Parameters are bound
+ * once at record time and the pipeline, thread group count and bound resources are kept across
+ * submissions. Re-submitting the sequence only re-encodes the dispatches, individual parameters
+ * can be patched in between through \c cursor().
+ *
+ * If the program of a recorded kernel is hot reloaded, the shader object of the dispatch is
+ * recreated and the \c bind_vars callback passed to \c record() is invoked again. Parameters
+ * patched through \c cursor() after recording are lost in this case.
+ *
+ * \note Entry point parameters are not supported, all parameters need to be global.
+ */
+class SGL_API DispatchSequence : public DeviceResource {
+    SGL_OBJECT(DispatchSequence)
+public:
+    using BindVarsCallback = Kernel::BindVarsCallback;
+
+    DispatchSequence(ref<Device> device);
+    ~DispatchSequence() = default;
+
+    /// Number of recorded dispatches.
+    uint32_t dispatch_count() const { return narrow_cast<uint32_t>(m_dispatches.size()); }
+
+    /// Record a dispatch of \c kernel with \c thread_count threads.
+    /// \param kernel Compute kernel to dispatch.
+    /// \param thread_count Number of threads to dispatch.
+    /// \param bind_vars Callback to bind the parameters. Invoked once and again after a hot reload.
+    /// \return Index of the recorded dispatch.
+    uint32_t record(ComputeKernel* kernel, uint3 thread_count, BindVarsCallback bind_vars = {});
+
+    /// Kernel of a recorded dispatch.
+    ComputeKernel* kernel(uint32_t index) const;
+
+    /// Root shader object of a recorded dispatch.
+    MutableShaderObject* shader_object(uint32_t index) const;
+
+    /// Shader cursor for patching the parameters of a recorded dispatch.
+    ShaderCursor cursor(uint32_t index) const;
+
+    /// Change the number of threads of a recorded dispatch.
+    void set_thread_count(uint32_t index, uint3 thread_count);
+
+    /// Remove all recorded dispatches.
+    void clear();
+
+    /// Encode all recorded dispatches.
+    void encode(ComputeCommandEncoder& encoder);
+
+    /// Encode all recorded dispatches to \c command_buffer.
+    /// If \c command_buffer is nullptr, the shared command buffer of the device is used.
+    void submit(CommandBuffer* command_buffer = nullptr);
+
+private:
+    struct Dispatch {
+        ref<ComputeKernel> kernel;
+        ref<MutableShaderObject> shader_object;
+        uint3 thread_count;
+        uint3 thread_group_count;
+        BindVarsCallback bind_vars;
+        /// Generation of the program the shader object was created for, used to detect hot reloads.
+        uint64_t program_generation{0};
+    };
+
+    void bind(Dispatch& dispatch);
+
+    std::vector<Dispatch> m_dispatches;
+};
+
 } // namespace sgl
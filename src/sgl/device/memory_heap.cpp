@@ -9,12 +9,20 @@
 #include "sgl/core/maths.h"
 #include "sgl/core/string.h"
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace sgl {
 
+static std::atomic<uint64_t> s_next_heap_id{1};
+
 MemoryHeap::MemoryHeap(ref<Device> device, ref<Fence> fence, MemoryHeapDesc desc)
     : DeviceResource(std::move(device))
     , m_fence(std::move(fence))
     , m_desc(std::move(desc))
+    , m_id(s_next_heap_id++)
 {
     SGL_CHECK(m_desc.page_size > 0, "Invalid page size, must be larger than 0");
     SGL_CHECK(
@@ -26,7 +34,7 @@ MemoryHeap::MemoryHeap(ref<Device> device, ref<Fence> fence, MemoryHeapDesc desc
 MemoryHeap::~MemoryHeap()
 {
     execute_deferred_releases();
-    if (!m_deferred_releases.empty()) {
+    if (!m_desc.ring_buffer && !m_deferred_releases.empty()) {
         log_warn(
             "MemoryHeap \"{}\" has {} unreleased allocations ({} in total)",
             m_desc.debug_name,
@@ -36,8 +44,18 @@ MemoryHeap::~MemoryHeap()
     }
 }
 
+MemoryHeap::Stats MemoryHeap::stats() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_stats;
+}
+
 MemoryHeap::Allocation MemoryHeap::allocate(DeviceSize size, DeviceSize alignment)
 {
+    SGL_CHECK(!m_desc.ring_buffer, "Ring-buffer heaps only support transient allocations");
+
+    std::lock_guard lock(m_mutex);
+
     PageID page_id = INVALID_PAGE;
 
     if (size > m_desc.page_size) {
@@ -83,14 +101,81 @@ MemoryHeap::Allocation MemoryHeap::allocate(DeviceSize size, DeviceSize alignmen
     return allocation;
 }
 
+MemoryHeap::TransientAllocation MemoryHeap::allocate_transient(DeviceSize size, DeviceSize alignment)
+{
+    SGL_CHECK(m_desc.ring_buffer, "Transient allocations require a ring-buffer heap");
+
+    SubHeap& sub_heap = get_sub_heap();
+
+    // Fast path: bump allocate from the thread's current page without locking.
+    DeviceOffset aligned_offset = align_to(alignment, sub_heap.offset);
+    if (sub_heap.page_id != INVALID_PAGE && aligned_offset + size <= sub_heap.size) {
+        sub_heap.offset = aligned_offset + size;
+        return {sub_heap.buffer, size, aligned_offset, sub_heap.data + aligned_offset};
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    if (size > m_desc.page_size) {
+        // Allocation exceeds page size -> allocate a new large page and retire it right away.
+        PageID page_id = allocate_page(size);
+        retire_page(page_id, size);
+        const Page& page = m_pages[page_id];
+        return {page.buffer, size, 0, page.data};
+    }
+
+    // Retire the current page and continue on a reclaimed or new page.
+    if (sub_heap.page_id != INVALID_PAGE)
+        retire_page(sub_heap.page_id, sub_heap.offset);
+    PageID page_id = reclaim_or_allocate_page();
+    const Page& page = m_pages[page_id];
+    sub_heap.page_id = page_id;
+    sub_heap.buffer = page.buffer;
+    sub_heap.data = page.data;
+    sub_heap.size = page.buffer->size();
+    sub_heap.offset = size;
+    return {sub_heap.buffer, size, 0, sub_heap.data};
+}
+
+void MemoryHeap::retire_pages(uint64_t fence_value)
+{
+    SGL_CHECK(m_desc.ring_buffer, "Retiring pages requires a ring-buffer heap");
+
+    std::lock_guard lock(m_mutex);
+
+    // Retire the pages of threads that have exited.
+    std::erase_if(
+        m_sub_heaps,
+        [this](const std::shared_ptr<SubHeap>& sub_heap)
+        {
+            if (!sub_heap->exited.load(std::memory_order_acquire))
+                return false;
+            if (sub_heap->page_id != INVALID_PAGE)
+                retire_page(sub_heap->page_id, sub_heap->offset);
+            return true;
+        }
+    );
+
+    for (const RetiredPage& retired_page : m_retired_pages) {
+        m_deferred_releases.push_back(DeferredRelease{
+            .fence_value = fence_value,
+            .page_id = retired_page.page_id,
+            .size = retired_page.size,
+        });
+    }
+    m_retired_pages.clear();
+}
+
 void MemoryHeap::execute_deferred_releases()
 {
+    std::lock_guard lock(m_mutex);
+
     if (m_deferred_releases.empty())
         return;
 
     uint64_t current_value = m_fence->current_value();
 
-    while (!m_deferred_releases.empty() && m_deferred_releases.front().fence_value < current_value) {
+    while (!m_deferred_releases.empty() && m_deferred_releases.front().fence_value <= current_value) {
         const DeferredRelease& deferred_release = m_deferred_releases.front();
         Page& page = m_pages[deferred_release.page_id];
         page.allocation_count -= 1;
@@ -115,6 +200,7 @@ std::string MemoryHeap::to_string() const
         "  usage = {},\n"
         "  page_size = {},\n"
         "  retain_large_pages = {},\n"
+        "  ring_buffer = {},\n"
         "  debug_name = {}\n"
         ")",
         m_device,
@@ -123,14 +209,18 @@ std::string MemoryHeap::to_string() const
         m_desc.usage,
         string::format_byte_size(m_desc.page_size),
         m_desc.retain_large_pages,
+        m_desc.ring_buffer,
         m_desc.debug_name
     );
 }
 
 void MemoryHeap::release(AllocationData* allocation)
 {
+    std::lock_guard lock(m_mutex);
+
+    // The allocation is used by work submitted after it was created.
     m_deferred_releases.push_back(DeferredRelease{
-        .fence_value = allocation->fence_value,
+        .fence_value = allocation->fence_value + 1,
         .page_id = allocation->page_id,
         .size = allocation->size,
     });
@@ -205,4 +295,66 @@ MemoryHeap::PageID MemoryHeap::reclaim_or_allocate_page()
     }
 }
 
+void MemoryHeap::retire_page(PageID page_id, DeviceSize used_size)
+{
+    // The page is released as a whole, like a page with a single allocation.
+    m_pages[page_id].allocation_count = 1;
+    m_stats.used_size += used_size;
+    m_retired_pages.push_back(RetiredPage{
+        .page_id = page_id,
+        .size = used_size,
+    });
+}
+
+MemoryHeap::SubHeap& MemoryHeap::get_sub_heap()
+{
+    // Sub-heaps of the calling thread. They are flagged as exited when the thread terminates,
+    // which lets the heap retire their pages.
+    struct ThreadSubHeaps {
+        std::vector<std::shared_ptr<SubHeap>> sub_heaps;
+        ~ThreadSubHeaps()
+        {
+            for (const auto& sub_heap : sub_heaps)
+                sub_heap->exited.store(true, std::memory_order_release);
+        }
+    };
+    // Small per-thread cache of sub-heaps, keyed by the unique heap ID.
+    struct CacheEntry {
+        uint64_t heap_id{0};
+        SubHeap* sub_heap{nullptr};
+    };
+    static thread_local ThreadSubHeaps t_sub_heaps;
+    static thread_local std::array<CacheEntry, 4> t_cache;
+    static thread_local size_t t_cache_next{0};
+
+    for (const CacheEntry& entry : t_cache)
+        if (entry.heap_id == m_id)
+            return *entry.sub_heap;
+
+    SubHeap* sub_heap = nullptr;
+    for (const auto& entry : t_sub_heaps.sub_heaps) {
+        if (entry->heap_id == m_id) {
+            sub_heap = entry.get();
+            break;
+        }
+    }
+    if (!sub_heap) {
+        // Drop sub-heaps of heaps that have been destroyed.
+        std::erase_if(
+            t_sub_heaps.sub_heaps,
+            [](const std::shared_ptr<SubHeap>& entry) { return entry.use_count() == 1; }
+        );
+        auto entry = std::make_shared<SubHeap>();
+        entry->heap_id = m_id;
+        {
+            std::lock_guard lock(m_mutex);
+            m_sub_heaps.push_back(entry);
+        }
+        sub_heap = entry.get();
+        t_sub_heaps.sub_heaps.push_back(std::move(entry));
+    }
+    t_cache[t_cache_next++ % t_cache.size()] = {m_id, sub_heap};
+    return *sub_heap;
+}
+
 } // namespace sgl
@@ -6,7 +6,10 @@
 #include "sgl/device/device_resource.h"
 #include "sgl/device/resource.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <deque>
 
@@ -21,6 +24,8 @@ struct MemoryHeapDesc {
     DeviceSize page_size{4 * 1024 * 1024};
     /// True to retain large pages, false to release them after use.
     bool retain_large_pages{false};
+    /// True to use the heap as a ring buffer of pages (see \c MemoryHeap::allocate_transient).
+    bool ring_buffer{false};
     /// The debug name of the heap.
     std::string debug_name;
 };
@@ -41,6 +46,16 @@ struct MemoryHeapDesc {
  *
  * Allocations are returned as unique pointers. When the pointer is destroyed, the allocation
  * is released. This ensures that the memory is freed when it is no longer used.
+ *
+ * In ring-buffer mode, memory is allocated with \c allocate_transient instead. Transient allocations
+ * are plain values that are never released individually. Each thread allocates from its own sub-heap,
+ * which owns a single page at a time. When the page is exhausted (or its thread exits), it is retired.
+ * Retired pages are handed to the fence with \c retire_pages, passing the fence value of the submit
+ * that last used them, and reclaimed once the fence has reached it. Space is therefore retired in
+ * fence order at page granularity. Threads only synchronize when switching pages, which allows
+ * multiple threads to fill upload memory in parallel.
+ *
+ * Allocating and releasing memory is thread-safe.
  */
 class SGL_API MemoryHeap : public DeviceResource {
     SGL_OBJECT(MemoryHeap)
@@ -74,10 +89,28 @@ public:
 
     using Allocation = std::unique_ptr<AllocationData>;
 
+    /// Allocation from a ring-buffer heap.
+    /// The memory is valid until its page is retired and the fence has reached the value passed to
+    /// \c retire_pages.
+    struct TransientAllocation {
+        /// The buffer this allocation belongs to.
+        Buffer* buffer;
+        /// The size of the allocation.
+        DeviceSize size;
+        /// The offset of the allocation within the buffer.
+        DeviceOffset offset;
+        /// Pointer to the host-visible memory.
+        uint8_t* data;
+
+        /// The device address of the allocation.
+        DeviceAddress device_address() const { return buffer->device_address() + offset; }
+    };
+
     struct Stats {
         /// The total size of the heap.
         DeviceSize total_size{0};
         /// The used size of the heap.
+        /// In ring-buffer mode, only pages that have been retired are accounted for.
         DeviceSize used_size{0};
         /// The number of pages in the heap.
         uint32_t page_count{0};
@@ -91,7 +124,7 @@ public:
     /// Description of the heap.
     const MemoryHeapDesc& desc() const { return m_desc; }
     /// Statistics of the heap.
-    const Stats& stats() const { return m_stats; }
+    Stats stats() const;
 
     /**
      * \brief Allocate memory from this heap.
@@ -102,6 +135,29 @@ public:
      */
     Allocation allocate(DeviceSize size, DeviceSize alignment = 16);
 
+    /**
+     * \brief Allocate memory from the sub-heap of the calling thread.
+     *
+     * Only available in ring-buffer mode. The allocation does not need to be released.
+     * Allocations larger than the page size get a large page that is retired immediately.
+     *
+     * \param size The number of bytes to allocate.
+     * \param alignment The alignment of the allocation.
+     * \return Returns the allocation.
+     */
+    TransientAllocation allocate_transient(DeviceSize size, DeviceSize alignment = 16);
+
+    /**
+     * \brief Hand the pages retired since the last call over to the fence.
+     *
+     * Only available in ring-buffer mode. Pages are retired when they are exhausted or when the thread
+     * owning them has exited. They are reclaimed by \c execute_deferred_releases once the fence has reached
+     * \c fence_value.
+     *
+     * \param fence_value The fence value of the last submit using memory from the retired pages.
+     */
+    void retire_pages(uint64_t fence_value);
+
     /**
      * \brief Execute deferred releases.
      *
@@ -119,6 +175,24 @@ private:
 
     PageID reclaim_or_allocate_page();
 
+    /// Put a page on the list of retired pages (ring-buffer mode).
+    void retire_page(PageID page_id, DeviceSize used_size);
+
+    /// Current page of a thread in ring-buffer mode.
+    /// Only accessed by its thread, so it stores copies of the page data.
+    /// Shared with the thread, which flags it as exited when it terminates.
+    struct SubHeap {
+        uint64_t heap_id{0};
+        PageID page_id{INVALID_PAGE};
+        Buffer* buffer{nullptr};
+        uint8_t* data{nullptr};
+        DeviceSize size{0};
+        DeviceOffset offset{0};
+        std::atomic<bool> exited{false};
+    };
+
+    SubHeap& get_sub_heap();
+
     struct Page {
         ref<Buffer> buffer;
         uint8_t* data{nullptr};
@@ -133,23 +207,35 @@ private:
     };
 
     struct DeferredRelease {
+        /// Fence value that needs to be reached before releasing.
         uint64_t fence_value;
         PageID page_id;
         DeviceSize size;
     };
 
+    struct RetiredPage {
+        PageID page_id;
+        DeviceSize size;
+    };
+
     static constexpr PageID INVALID_PAGE = PageID(-1);
 
     ref<Fence> m_fence;
     MemoryHeapDesc m_desc;
     Stats m_stats;
 
+    /// Unique ID used to look up sub-heaps in the per-thread cache.
+    uint64_t m_id;
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<SubHeap>> m_sub_heaps;
+
     std::vector<Page> m_pages;
     std::vector<PageID> m_free_pages;
     std::vector<PageID> m_available_pages;
     PageID m_current_page{INVALID_PAGE};
 
     std::deque<DeferredRelease> m_deferred_releases;
+    std::vector<RetiredPage> m_retired_pages;
 };
 
 } // namespace sgl
@@ -10,6 +10,7 @@
 #include "sgl/device/native_handle_traits.h"
 
 #include "sgl/core/config.h"
+#include "sgl/core/crypto.h"
 #include "sgl/core/short_vector.h"
 #include "sgl/core/type_utils.h"
 
@@ -38,6 +39,9 @@ Pipeline::~Pipeline()
 
 void Pipeline::notify_program_reloaded()
 {
+    // The cached pipeline state refers to the old program code.
+    if (!m_cache_key.empty())
+        m_device->_remove_cached_pipeline_state(m_cache_key);
     m_device->deferred_release(m_gfx_pipeline_state);
     m_gfx_pipeline_state = nullptr;
     recreate();
@@ -71,8 +75,21 @@ ComputePipeline::ComputePipeline(ref<Device> device, ComputePipelineDesc desc)
 
 void ComputePipeline::recreate()
 {
-    gfx::ComputePipelineStateDesc gfx_desc{.program = m_desc.program->gfx_shader_program()};
-    SLANG_CALL(m_device->gfx_device()->createComputePipelineState(gfx_desc, m_gfx_pipeline_state.writeRef()));
+    // Pipeline creation may compile code through the slang session.
+    std::lock_guard lock(m_program->session()->_mutex());
+
+    m_cache_key = fmt::format("compute-{}", m_desc.program->hash());
+    m_gfx_pipeline_state = m_device->_get_or_create_pipeline_state(
+        m_cache_key,
+        [&]()
+        {
+            gfx::ComputePipelineStateDesc gfx_desc{.program = m_desc.program->gfx_shader_program()};
+            Slang::ComPtr<gfx::IPipelineState> gfx_pipeline_state;
+            SLANG_CALL(m_device->gfx_device()->createComputePipelineState(gfx_desc, gfx_pipeline_state.writeRef()));
+            return gfx_pipeline_state;
+        }
+    );
+    m_device->_record_pipeline_manifest_entry(m_desc.program);
     m_thread_group_size = m_desc.program->layout()->get_entry_point_by_index(0)->compute_thread_group_size();
 }
 
@@ -94,6 +111,39 @@ std::string ComputePipeline::to_string() const
 // GraphicsPipeline
 // ----------------------------------------------------------------------------
 
+/// Compute the pipeline cache key for a graphics pipeline.
+/// Input and framebuffer layouts are identified by their gfx objects, which the cache keeps alive.
+static std::string get_graphics_pipeline_cache_key(const GraphicsPipelineDesc& desc)
+{
+    SHA1 hash;
+    hash.update(desc.program->hash());
+    hash.update(reinterpret_cast<uintptr_t>(desc.input_layout ? desc.input_layout->gfx_input_layout() : nullptr));
+    hash.update(reinterpret_cast<uintptr_t>(desc.framebuffer_layout->gfx_framebuffer_layout()));
+    hash.update(desc.primitive_type);
+
+    const DepthStencilDesc& ds = desc.depth_stencil;
+    hash.update(ds.depth_test_enable).update(ds.depth_write_enable).update(ds.depth_func);
+    hash.update(ds.stencil_enable).update(ds.stencil_read_mask).update(ds.stencil_write_mask).update(ds.stencil_ref);
+    for (const DepthStencilOpDesc& op : {ds.front_face, ds.back_face})
+        hash.update(op.stencil_fail_op).update(op.stencil_depth_fail_op).update(op.stencil_pass_op).update(op.stencil_func);
+
+    const RasterizerDesc& rs = desc.rasterizer;
+    hash.update(rs.fill_mode).update(rs.cull_mode).update(rs.front_face);
+    hash.update(rs.depth_bias).update(rs.depth_bias_clamp).update(rs.slope_scaled_depth_bias);
+    hash.update(rs.depth_clip_enable).update(rs.scissor_enable).update(rs.multisample_enable);
+    hash.update(rs.antialiased_line_enable).update(rs.enable_conservative_rasterization);
+    hash.update(rs.forced_sample_count);
+
+    hash.update(desc.blend.alpha_to_coverage_enable);
+    for (const TargetBlendDesc& target : desc.blend.targets) {
+        hash.update(target.enable_blend).update(target.logic_op).update(target.write_mask);
+        for (const AspectBlendDesc& aspect : {target.color, target.alpha})
+            hash.update(aspect.src_factor).update(aspect.dst_factor).update(aspect.op);
+    }
+
+    return fmt::format("graphics-{}", hash.hex_digest());
+}
+
 GraphicsPipeline::GraphicsPipeline(ref<Device> device, GraphicsPipelineDesc desc)
     : Pipeline(std::move(device), desc.program)
     , m_desc(std::move(desc))
@@ -105,6 +155,9 @@ GraphicsPipeline::GraphicsPipeline(ref<Device> device, GraphicsPipelineDesc desc
 
 void GraphicsPipeline::recreate()
 {
+    // Pipeline creation may compile code through the slang session.
+    std::lock_guard lock(m_program->session()->_mutex());
+
     const GraphicsPipelineDesc& desc = m_desc;
 
     SGL_CHECK_NOT_NULL(desc.framebuffer_layout);
@@ -176,7 +229,21 @@ void GraphicsPipeline::recreate()
         };
     }
 
-    SLANG_CALL(m_device->gfx_device()->createGraphicsPipelineState(gfx_desc, m_gfx_pipeline_state.writeRef()));
+    ISlangUnknown* dependencies[] = {
+        gfx_desc.inputLayout,
+        gfx_desc.framebufferLayout,
+    };
+    m_cache_key = get_graphics_pipeline_cache_key(desc);
+    m_gfx_pipeline_state = m_device->_get_or_create_pipeline_state(
+        m_cache_key,
+        [&]()
+        {
+            Slang::ComPtr<gfx::IPipelineState> gfx_pipeline_state;
+            SLANG_CALL(m_device->gfx_device()->createGraphicsPipelineState(gfx_desc, gfx_pipeline_state.writeRef()));
+            return gfx_pipeline_state;
+        },
+        dependencies
+    );
 }
 
 std::string GraphicsPipeline::to_string() const
@@ -204,6 +271,9 @@ RayTracingPipeline::RayTracingPipeline(ref<Device> device, RayTracingPipelineDes
 
 void RayTracingPipeline::recreate()
 {
+    // Pipeline creation may compile code through the slang session.
+    std::lock_guard lock(m_program->session()->_mutex());
+
     const RayTracingPipelineDesc& desc = m_desc;
 
     short_vector<gfx::HitGroupDesc, 16> gfx_hit_groups;
@@ -17,6 +17,7 @@
 
 #include <map>
 #include <set>
+#include <string>
 
 namespace sgl {
 
@@ -35,6 +36,9 @@ public:
     /// - Vulkan: VkPipeline
     NativeHandle get_native_handle() const;
 
+    /// The program used by this pipeline.
+    const ShaderProgram* program() const { return m_program; }
+
     void notify_program_reloaded();
 
 protected:
@@ -42,6 +46,9 @@ protected:
 
     Slang::ComPtr<gfx::IPipelineState> m_gfx_pipeline_state;
 
+    /// Key of the pipeline state in the device's pipeline cache (empty if not cached).
+    std::string m_cache_key;
+
 private:
     /// Pipelines store program (and thus maintain the ref count)
     /// in their descriptor - this is just so we can register/unregister
@@ -3,6 +3,7 @@
 #include "print.h"
 
 #include "sgl/core/format.h"
+#include "sgl/core/type_utils.h"
 
 #include "sgl/device/device.h"
 #include "sgl/device/command.h"
@@ -12,6 +13,8 @@
 
 #include <fmt/args.h>
 
+#include <limits>
+
 namespace sgl {
 namespace print_buffer {
 
@@ -187,9 +190,10 @@ namespace print_buffer {
         }
     }
 
+    using HashedStrings = std::unordered_map<uint32_t, std::string>;
+
     template<typename Output>
-    inline void
-    decode_msg(std::span<const uint8_t> data, const std::map<uint32_t, std::string>& hashed_strings, Output output)
+    inline void decode_msg(std::span<const uint8_t> data, const HashedStrings& hashed_strings, Output output)
     {
         const uint8_t* ptr = data.data();
 
@@ -225,8 +229,7 @@ namespace print_buffer {
     }
 
     template<typename Output>
-    inline void
-    decode_buffer(const void* data, size_t size, const std::map<uint32_t, std::string>& hashed_strings, Output output)
+    inline void decode_buffer(const void* data, size_t size, const HashedStrings& hashed_strings, Output output)
     {
         const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data);
         uint32_t buffer_size = *reinterpret_cast<const uint32_t*>(ptr);
@@ -252,21 +255,37 @@ namespace print_buffer {
 } // namespace print_buffer
 
 
+/// Size of the print buffer header (begin and end offset of the active half, padded for alignment).
+static constexpr DeviceSize PRINT_BUFFER_HEADER_SIZE = 16;
+
 DebugPrinter::DebugPrinter(Device* device, size_t buffer_size)
     : m_device(device)
 {
+    // The buffer is split into two halves, each of which must stay 16 byte aligned.
+    SGL_CHECK(buffer_size > 0 && buffer_size % 32 == 0, "Print buffer size must be a multiple of 32 bytes.");
+    SGL_CHECK(
+        PRINT_BUFFER_HEADER_SIZE + buffer_size <= std::numeric_limits<uint32_t>::max(),
+        "Print buffer size is too large."
+    );
+
     m_buffer = m_device->create_buffer({
-        .size = buffer_size,
+        .size = PRINT_BUFFER_HEADER_SIZE + buffer_size,
         .usage = ResourceUsage::unordered_access,
         .debug_name = "debug_printer_buffer",
     });
 
-    m_readback_buffer = m_device->create_buffer({
-        .size = buffer_size,
-        .usage = ResourceUsage::none,
-        .memory_type = MemoryType::read_back,
-        .debug_name = "debug_printer_readback_buffer",
-    });
+    size_t half_size = buffer_size / 2;
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_print_buffers[i].offset = PRINT_BUFFER_HEADER_SIZE + i * half_size;
+        m_print_buffers[i].size = half_size;
+    }
+
+    CommandBuffer* command_buffer = m_device->_begin_shared_command_buffer();
+    uint32_t zero = 0;
+    for (const PrintBuffer& print_buffer : m_print_buffers)
+        command_buffer->upload_buffer_data(m_buffer, print_buffer.offset, sizeof(zero), &zero);
+    set_active(command_buffer, 0);
+    m_device->_end_shared_command_buffer(false);
 }
 
 void DebugPrinter::add_hashed_strings(const std::map<uint32_t, std::string>& hashed_strings)
@@ -274,35 +293,22 @@ void DebugPrinter::add_hashed_strings(const std::map<uint32_t, std::string>& has
     m_hashed_strings.insert(hashed_strings.begin(), hashed_strings.end());
 }
 
-void DebugPrinter::flush()
+void DebugPrinter::flush(bool wait)
 {
-    flush_device(true);
-    const void* data = m_readback_buffer->map();
-    print_buffer::decode_buffer(
-        data,
-        m_readback_buffer->size(),
-        m_hashed_strings,
-        [](std::string_view str) { Logger::get().log(LogLevel::none, str); }
-    );
-    m_readback_buffer->unmap();
+    flush_buffers(wait, [](std::string_view str) { Logger::get().log(LogLevel::none, str); });
 }
 
-std::string DebugPrinter::flush_to_string()
+std::string DebugPrinter::flush_to_string(bool wait)
 {
-    flush_device(true);
     std::string result;
-    const void* data = m_readback_buffer->map();
-    print_buffer::decode_buffer(
-        data,
-        m_readback_buffer->size(),
-        m_hashed_strings,
+    flush_buffers(
+        wait,
         [&result](std::string_view str)
         {
             result += str;
             result += "\n";
         }
     );
-    m_readback_buffer->unmap();
     return result;
 }
 
@@ -314,12 +320,81 @@ void DebugPrinter::bind(ShaderCursor cursor)
         cursor["buffer"] = m_buffer;
 }
 
-void DebugPrinter::flush_device(bool wait)
+void DebugPrinter::flush_buffers(bool wait, const Output& output)
+{
+    PrintBuffer& current = m_print_buffers[m_current];
+    PrintBuffer& other = m_print_buffers[1 - m_current];
+
+    // Output messages in the order they were written. The data of the current buffer
+    // has been requested by the previous non-blocking flush and is the oldest.
+    if (current.data_request)
+        read_data(current, output);
+
+    // The other half is used next, this clears its written data.
+    if (other.size_request)
+        request_data(other);
+    if (wait && other.data_request)
+        read_data(other, output);
+
+    request_size(current);
+    if (wait) {
+        request_data(current);
+        if (current.data_request)
+            read_data(current, output);
+    } else {
+        CommandBuffer* command_buffer = m_device->_begin_shared_command_buffer();
+        set_active(command_buffer, 1 - m_current);
+        m_device->_end_shared_command_buffer(false);
+    }
+}
+
+void DebugPrinter::request_size(PrintBuffer& print_buffer)
 {
+    print_buffer.size_request = m_device->read_buffer_data_async(m_buffer, sizeof(uint32_t), print_buffer.offset);
+}
+
+void DebugPrinter::request_data(PrintBuffer& print_buffer)
+{
+    // Blocks only if the GPU has not finished the work of the last flush yet.
+    uint32_t size = 0;
+    print_buffer.size_request->get_data(&size, sizeof(size));
+    print_buffer.size_request.reset();
+    if (size == 0)
+        return;
+
+    // Only copy the used part of the half (the size is larger than the half on overflow).
+    DeviceSize copy_size = std::min(DeviceSize(sizeof(uint32_t) + size), print_buffer.size);
+    print_buffer.data_request = m_device->read_buffer_data_async(m_buffer, copy_size, print_buffer.offset);
+
     CommandBuffer* command_buffer = m_device->_begin_shared_command_buffer();
-    command_buffer->copy_resource(m_readback_buffer, m_buffer);
-    command_buffer->clear_resource_view(m_buffer->get_uav({.offset = 0, .size = 4}), uint4(0));
-    m_device->_end_shared_command_buffer(wait);
+    uint32_t zero = 0;
+    command_buffer->upload_buffer_data(m_buffer, print_buffer.offset, sizeof(zero), &zero);
+    m_device->_end_shared_command_buffer(false);
+}
+
+void DebugPrinter::read_data(PrintBuffer& print_buffer, const Output& output)
+{
+    m_data.resize(print_buffer.data_request->size());
+    print_buffer.data_request->get_data(m_data.data(), m_data.size());
+    print_buffer.data_request.reset();
+
+    // Messages written after the size was read back are not part of the copied data.
+    uint32_t size = uint32_t(m_data.size() - sizeof(uint32_t));
+    std::memcpy(m_data.data(), &size, sizeof(size));
+
+    print_buffer::decode_buffer(m_data.data(), m_data.size(), m_hashed_strings, output);
+}
+
+void DebugPrinter::set_active(CommandBuffer* command_buffer, uint32_t index)
+{
+    // Shaders read the begin and end offset of the active half from the header.
+    const PrintBuffer& print_buffer = m_print_buffers[index];
+    uint32_t header[2] = {
+        narrow_cast<uint32_t>(print_buffer.offset),
+        narrow_cast<uint32_t>(print_buffer.offset + print_buffer.size),
+    };
+    command_buffer->upload_buffer_data(m_buffer, 0, sizeof(header), header);
+    m_current = index;
 }
 
 } // namespace sgl
@@ -5,8 +5,13 @@
 #include "sgl/device/fwd.h"
 #include "sgl/device/shader_cursor.h"
 
+#include <array>
+#include <functional>
 #include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace sgl {
 
@@ -14,32 +19,72 @@ namespace sgl {
  * \brief Debug printer.
  *
  * This class implements host-side support for shader debug printing.
+ *
+ * The print buffer is split into two halves that are used alternately. The active half is stored
+ * in the buffer header and read by the shader, so print buffer bindings in persistent shader objects
+ * stay valid. Flushing only reads back the used part of a half, by first reading back the size of the
+ * written data and then copying the data itself. Non-blocking flushes switch to the other half and
+ * output the messages of earlier flushes once they are available, which avoids stalling on the GPU
+ * (messages are output with a latency of two flushes).
  */
 class DebugPrinter {
 public:
+    /// Constructor.
+    /// \param device Device.
+    /// \param buffer_size Total size of both halves of the print buffer in bytes (multiple of 32).
     DebugPrinter(Device* device, size_t buffer_size = 4 * 1024 * 1024);
 
     /// Add a map of hashed strings to the printer.
     /// This needs to be called for any shader that uses debug printing.
     void add_hashed_strings(const std::map<uint32_t, std::string>& hashed_strings);
 
-    /// Flush the print buffer and output any messages to stdout.
-    void flush();
+    /**
+     * Flush the print buffer and output any messages to stdout.
+     * \param wait If true, block until all messages are available. Otherwise don't wait for
+     *     pending GPU work and output the messages of earlier flushes instead.
+     */
+    void flush(bool wait = true);
 
-    /// Flush the print buffer and output any messages as a string.
-    std::string flush_to_string();
+    /**
+     * Flush the print buffer and output any messages as a string.
+     * \param wait If true, block until all messages are available. Otherwise don't wait for
+     *     pending GPU work and output the messages of earlier flushes instead.
+     */
+    std::string flush_to_string(bool wait = true);
 
     void bind(ShaderCursor cursor);
 
 private:
-    void flush_device(bool wait);
+    struct PrintBuffer {
+        /// Offset of the half in the print buffer.
+        DeviceOffset offset;
+        /// Size of the half in bytes.
+        DeviceSize size;
+        /// Pending read-back of the size of the written data.
+        ref<ReadBackRequest> size_request;
+        /// Pending read-back of the written data.
+        ref<ReadBackRequest> data_request;
+    };
+
+    using Output = std::function<void(std::string_view)>;
+
+    void flush_buffers(bool wait, const Output& output);
+    void request_size(PrintBuffer& print_buffer);
+    void request_data(PrintBuffer& print_buffer);
+    void read_data(PrintBuffer& print_buffer, const Output& output);
+    void set_active(CommandBuffer* command_buffer, uint32_t index);
 
     Device* m_device;
 
     ref<Buffer> m_buffer;
-    ref<Buffer> m_readback_buffer;
+    std::array<PrintBuffer, 2> m_print_buffers;
+    /// Index of the active half of the print buffer.
+    uint32_t m_current{0};
+
+    /// Host copy of read-back data.
+    std::vector<uint8_t> m_data;
 
-    std::map<uint32_t, std::string> m_hashed_strings;
+    std::unordered_map<uint32_t, std::string> m_hashed_strings;
 };
 
 } // namespace sgl
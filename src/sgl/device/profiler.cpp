@@ -0,0 +1,400 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "profiler.h"
+
+#include "sgl/device/device.h"
+#include "sgl/device/command.h"
+#include "sgl/device/fence.h"
+#include "sgl/device/query.h"
+
+#include "sgl/core/error.h"
+#include "sgl/core/logger.h"
+#include "sgl/core/type_utils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <span>
+
+namespace sgl {
+
+namespace {
+
+    /// Escape a string for use in a JSON string literal.
+    std::string json_escape(std::string_view str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (char c : str) {
+            switch (c) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    result += fmt::format("\\u{:04x}", int(c));
+                else
+                    result += c;
+            }
+        }
+        return result;
+    }
+
+    std::string join_path(std::string_view parent, std::string_view name)
+    {
+        return parent.empty() ? std::string(name) : fmt::format("{}/{}", parent, name);
+    }
+
+} // namespace
+
+Profiler::Scope::~Scope()
+{
+    // Destructors must not throw, report failures to end the scope (e.g. after the frame has ended) instead.
+    try {
+        if (m_command_buffer)
+            m_profiler->end_scope(m_command_buffer);
+        else
+            m_profiler->end_cpu_scope();
+    } catch (const std::exception& e) {
+        log_error("Failed to end profiler scope: {}", e.what());
+    }
+}
+
+Profiler::Profiler(ref<Device> device, ref<Fence> fence, ProfilerDesc desc)
+    : DeviceResource(std::move(device))
+    , m_desc(std::move(desc))
+    , m_fence(std::move(fence))
+{
+    SGL_CHECK(m_desc.latency > 0, "Invalid latency, must be at least 1");
+    SGL_CHECK(m_desc.history_size > 0, "Invalid history size, must be at least 1");
+    SGL_CHECK(m_desc.queries_per_pool >= 2, "Invalid queries per pool, must be at least 2");
+
+    // One frame slot per frame in flight plus the frame currently being recorded.
+    m_frames.resize(m_desc.latency + 1);
+    m_start_time = Timer::now();
+}
+
+Profiler::~Profiler()
+{
+    // Make sure no timestamp queries are written to the pools after they are released.
+    for (const Frame& frame : m_frames)
+        if (frame.pending && !frame.query_pools.empty())
+            m_fence->wait(frame.fence_value);
+}
+
+void Profiler::begin_frame()
+{
+    SGL_CHECK(!m_in_frame, "Frame already started");
+
+    // Resolve finished frames in order.
+    uint64_t current_value = m_fence->current_value();
+    for (uint64_t index = oldest_frame_index(); index <= m_frame_index; ++index) {
+        Frame& frame = m_frames[index % m_frames.size()];
+        // Frames may already have been resolved when their slot was reused.
+        if (!frame.pending)
+            continue;
+        if (frame.fence_value > current_value)
+            break;
+        resolve_frame(frame);
+    }
+
+    m_frame_index++;
+    m_in_frame = true;
+
+    // Resolve the frame that previously used this slot, blocking if the GPU is too far behind.
+    Frame& frame = current_frame();
+    if (frame.pending) {
+        m_fence->wait(frame.fence_value);
+        resolve_frame(frame);
+    }
+
+    for (const ref<QueryPool>& query_pool : frame.query_pools)
+        query_pool->reset();
+    frame.index = m_frame_index;
+    frame.begin_time = Timer::now();
+    frame.query_count = 0;
+    frame.gpu_scopes.clear();
+    frame.cpu_scopes.clear();
+    frame.gpu_stacks.clear();
+    frame.cpu_stack.clear();
+}
+
+void Profiler::end_frame()
+{
+    SGL_CHECK(m_in_frame, "Frame not started");
+    Frame& frame = current_frame();
+    SGL_CHECK(frame.cpu_stack.empty(), "CPU scope \"{}\" not ended", frame.cpu_scopes[frame.cpu_stack.back()].name);
+    for (const auto& [command_buffer, stack] : frame.gpu_stacks)
+        SGL_CHECK(stack.empty(), "GPU scope \"{}\" not ended", frame.gpu_scopes[stack.back()].name);
+
+    frame.end_time = Timer::now();
+    frame.fence_value = m_fence->signaled_value();
+    frame.pending = true;
+    m_in_frame = false;
+}
+
+void Profiler::flush()
+{
+    SGL_CHECK(!m_in_frame, "Cannot flush during a frame");
+    for (uint64_t index = oldest_frame_index(); index <= m_frame_index; ++index) {
+        Frame& frame = m_frames[index % m_frames.size()];
+        if (frame.pending) {
+            m_fence->wait(frame.fence_value);
+            resolve_frame(frame);
+        }
+    }
+}
+
+void Profiler::begin_scope(CommandBuffer* command_buffer, std::string_view name)
+{
+    SGL_CHECK_NOT_NULL(command_buffer);
+    SGL_CHECK(m_in_frame, "Scopes can only be recorded within a frame");
+
+    Frame& frame = current_frame();
+    std::vector<uint32_t>& stack = frame.gpu_stacks[command_buffer];
+    GpuScope scope{
+        .name = join_path(stack.empty() ? std::string_view{} : frame.gpu_scopes[stack.back()].name, name),
+        .depth = narrow_cast<uint32_t>(stack.size()),
+        .begin_query = write_timestamp(frame, command_buffer),
+        .end_query = 0,
+        .cpu_time = Timer::now(),
+    };
+    stack.push_back(narrow_cast<uint32_t>(frame.gpu_scopes.size()));
+    frame.gpu_scopes.push_back(std::move(scope));
+}
+
+void Profiler::end_scope(CommandBuffer* command_buffer)
+{
+    SGL_CHECK_NOT_NULL(command_buffer);
+    SGL_CHECK(m_in_frame, "Scopes can only be recorded within a frame");
+
+    Frame& frame = current_frame();
+    auto it = frame.gpu_stacks.find(command_buffer);
+    SGL_CHECK(it != frame.gpu_stacks.end() && !it->second.empty(), "No GPU scope to end");
+    frame.gpu_scopes[it->second.back()].end_query = write_timestamp(frame, command_buffer);
+    it->second.pop_back();
+}
+
+void Profiler::begin_cpu_scope(std::string_view name)
+{
+    SGL_CHECK(m_in_frame, "Scopes can only be recorded within a frame");
+
+    Frame& frame = current_frame();
+    std::vector<uint32_t>& stack = frame.cpu_stack;
+    CpuScope scope{
+        .name = join_path(stack.empty() ? std::string_view{} : frame.cpu_scopes[stack.back()].name, name),
+        .depth = narrow_cast<uint32_t>(stack.size()),
+        .begin_time = Timer::now(),
+        .end_time = 0,
+    };
+    stack.push_back(narrow_cast<uint32_t>(frame.cpu_scopes.size()));
+    frame.cpu_scopes.push_back(std::move(scope));
+}
+
+void Profiler::end_cpu_scope()
+{
+    SGL_CHECK(m_in_frame, "Scopes can only be recorded within a frame");
+
+    Frame& frame = current_frame();
+    SGL_CHECK(!frame.cpu_stack.empty(), "No CPU scope to end");
+    frame.cpu_scopes[frame.cpu_stack.back()].end_time = Timer::now();
+    frame.cpu_stack.pop_back();
+}
+
+std::vector<Profiler::ScopeStats> Profiler::stats() const
+{
+    std::vector<ScopeStats> result;
+    result.reserve(m_history.size());
+    for (const auto& [key, history] : m_history)
+        result.push_back(history.stats);
+    return result;
+}
+
+Profiler::ScopeStats Profiler::scope_stats(std::string_view name, bool gpu) const
+{
+    auto it = m_history.find(StatsKey{std::string(name), gpu});
+    if (it == m_history.end())
+        return ScopeStats{.name = std::string(name), .gpu = gpu};
+    return it->second.stats;
+}
+
+void Profiler::reset_stats()
+{
+    m_history.clear();
+    m_trace.clear();
+}
+
+std::string Profiler::trace_json() const
+{
+    static constexpr uint32_t PID = 1;
+    static constexpr uint32_t CPU_TID = 1;
+    static constexpr uint32_t GPU_TID = 2;
+
+    std::string json = "{\"traceEvents\":[\n";
+    json += fmt::format(
+        "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"args\":{{\"name\":\"sgl\"}}}},\n"
+        "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"CPU\"}}}},\n"
+        "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"GPU\"}}}}",
+        PID,
+        PID,
+        CPU_TID,
+        PID,
+        GPU_TID
+    );
+    for (const std::vector<TraceEvent>& events : m_trace) {
+        for (const TraceEvent& event : events) {
+            json += fmt::format(
+                ",\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{}}}",
+                json_escape(event.name),
+                event.gpu ? "gpu" : "cpu",
+                event.start_us,
+                event.duration_us,
+                PID,
+                event.gpu ? GPU_TID : CPU_TID
+            );
+        }
+    }
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return json;
+}
+
+void Profiler::write_trace(const std::filesystem::path& path) const
+{
+    std::ofstream stream(path, std::ios::trunc);
+    SGL_CHECK(stream.good(), "Failed to open trace file \"{}\" for writing.", path);
+    stream << trace_json();
+}
+
+std::string Profiler::to_string() const
+{
+    return fmt::format(
+        "Profiler(\n"
+        "  device = {},\n"
+        "  latency = {},\n"
+        "  history_size = {},\n"
+        "  trace_frame_count = {},\n"
+        "  queries_per_pool = {},\n"
+        "  frame_index = {},\n"
+        "  scope_count = {}\n"
+        ")",
+        m_device,
+        m_desc.latency,
+        m_desc.history_size,
+        m_desc.trace_frame_count,
+        m_desc.queries_per_pool,
+        m_frame_index,
+        m_history.size()
+    );
+}
+
+uint32_t Profiler::write_timestamp(Frame& frame, CommandBuffer* command_buffer)
+{
+    uint32_t query = frame.query_count++;
+    uint32_t pool_index = query / m_desc.queries_per_pool;
+    if (pool_index >= frame.query_pools.size())
+        frame.query_pools.push_back(
+            m_device->create_query_pool({.type = QueryType::timestamp, .count = m_desc.queries_per_pool})
+        );
+    command_buffer->write_timestamp(frame.query_pools[pool_index], query % m_desc.queries_per_pool);
+    return query;
+}
+
+void Profiler::resolve_frame(Frame& frame)
+{
+    SGL_ASSERT(frame.pending);
+    frame.pending = false;
+
+    auto to_us = [this](Timer::TimePoint time) { return Timer::delta_us(m_start_time, time); };
+
+    std::vector<TraceEvent> events;
+    events.reserve(1 + frame.cpu_scopes.size() + frame.gpu_scopes.size());
+    events.push_back({
+        .name = fmt::format("frame {}", frame.index),
+        .gpu = false,
+        .start_us = to_us(frame.begin_time),
+        .duration_us = Timer::delta_us(frame.begin_time, frame.end_time),
+    });
+
+    for (const CpuScope& scope : frame.cpu_scopes) {
+        double duration_ms = Timer::delta_ms(scope.begin_time, scope.end_time);
+        add_sample(scope.name, false, duration_ms);
+        events.push_back({
+            .name = scope.name,
+            .gpu = false,
+            .start_us = to_us(scope.begin_time),
+            .duration_us = duration_ms * 1000.0,
+        });
+    }
+
+    if (frame.query_count > 0) {
+        // Read back timestamps (in seconds).
+        std::vector<double> timestamps(frame.query_count);
+        for (uint32_t i = 0; i < frame.query_pools.size(); ++i) {
+            uint32_t offset = i * m_desc.queries_per_pool;
+            if (offset >= frame.query_count)
+                break;
+            uint32_t count = std::min(frame.query_count - offset, m_desc.queries_per_pool);
+            frame.query_pools[i]->get_timestamp_results(0, count, std::span(timestamps).subspan(offset, count));
+        }
+
+        // The GPU clock is not calibrated against the CPU clock. To place GPU scopes on the CPU timeline,
+        // we use the smallest offset that puts no GPU scope before the point in time it was recorded at.
+        double gpu_to_cpu_us = std::numeric_limits<double>::lowest();
+        for (const GpuScope& scope : frame.gpu_scopes)
+            gpu_to_cpu_us = std::max(gpu_to_cpu_us, to_us(scope.cpu_time) - timestamps[scope.begin_query] * 1e6);
+
+        for (const GpuScope& scope : frame.gpu_scopes) {
+            double duration_ms = (timestamps[scope.end_query] - timestamps[scope.begin_query]) * 1e3;
+            add_sample(scope.name, true, duration_ms);
+            events.push_back({
+                .name = scope.name,
+                .gpu = true,
+                .start_us = timestamps[scope.begin_query] * 1e6 + gpu_to_cpu_us,
+                .duration_us = duration_ms * 1000.0,
+            });
+        }
+    }
+
+    if (m_desc.trace_frame_count > 0) {
+        m_trace.push_back(std::move(events));
+        while (m_trace.size() > m_desc.trace_frame_count)
+            m_trace.pop_front();
+    }
+}
+
+void Profiler::add_sample(const std::string& name, bool gpu, double duration_ms)
+{
+    History& history = m_history[StatsKey{name, gpu}];
+    if (history.samples.size() < m_desc.history_size) {
+        history.samples.push_back(duration_ms);
+    } else {
+        history.samples[history.next] = duration_ms;
+        history.next = (history.next + 1) % m_desc.history_size;
+    }
+
+    ScopeStats& stats = history.stats;
+    stats.name = name;
+    stats.gpu = gpu;
+    stats.count++;
+    stats.last_ms = duration_ms;
+    stats.min_ms = std::numeric_limits<double>::max();
+    stats.max_ms = std::numeric_limits<double>::lowest();
+    double sum = 0.0;
+    for (double sample : history.samples) {
+        sum += sample;
+        stats.min_ms = std::min(stats.min_ms, sample);
+        stats.max_ms = std::max(stats.max_ms, sample);
+    }
+    stats.average_ms = sum / double(history.samples.size());
+}
+
+} // namespace sgl
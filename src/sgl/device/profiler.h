@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/device_resource.h"
+
+#include "sgl/core/macros.h"
+#include "sgl/core/object.h"
+#include "sgl/core/timer.h"
+
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sgl {
+
+struct ProfilerDesc {
+    /// Number of frames that can be in flight before the timestamps of a frame are resolved.
+    /// Timestamps are resolved as soon as the GPU has finished a frame, but at the latest after this many frames
+    /// (which blocks until the GPU has caught up).
+    uint32_t latency{3};
+    /// Number of samples used for computing the rolling statistics of a scope.
+    uint32_t history_size{64};
+    /// Number of resolved frames kept for trace export.
+    uint32_t trace_frame_count{16};
+    /// Number of timestamp queries per query pool. Additional pools are created on demand.
+    uint32_t queries_per_pool{1024};
+};
+
+/**
+ * \brief Scoped CPU and GPU profiler.
+ *
+ * The profiler measures the duration of named scopes. GPU scopes are recorded into command buffers
+ * using timestamp queries, CPU scopes are measured on the host using \c Timer.
+ * Scopes can be nested, each command buffer (and the host) maintains its own scope stack.
+ * Scopes are identified by their path (i.e. the names of all enclosing scopes joined by '/').
+ *
+ * Scopes are recorded in frames, delimited by \c begin_frame and \c end_frame.
+ * Command buffers containing GPU scopes of a frame must be submitted before calling \c end_frame.
+ * Timestamp query pools are managed per frame in flight and resolved without stalling once the GPU
+ * has finished a frame (or after \c latency frames at the latest).
+ *
+ * Resolved scope durations are accumulated into rolling statistics (see \c stats) and the events of the
+ * last \c trace_frame_count frames can be exported as a Chrome trace (see \c trace_json), which
+ * can be viewed in chrome://tracing or Perfetto.
+ */
+class SGL_API Profiler : public DeviceResource {
+    SGL_OBJECT(Profiler)
+public:
+    SGL_NON_COPYABLE_AND_MOVABLE(Profiler);
+
+    struct ScopeStats {
+        /// Scope path.
+        std::string name;
+        /// True if this is a GPU scope.
+        bool gpu{false};
+        /// Total number of samples.
+        uint64_t count{0};
+        /// Duration of the last sample in milliseconds.
+        double last_ms{0.0};
+        /// Average duration over the sample history in milliseconds.
+        double average_ms{0.0};
+        /// Minimum duration over the sample history in milliseconds.
+        double min_ms{0.0};
+        /// Maximum duration over the sample history in milliseconds.
+        double max_ms{0.0};
+    };
+
+    /// RAII helper for recording a CPU or GPU scope.
+    class Scope {
+    public:
+        SGL_NON_COPYABLE_AND_MOVABLE(Scope);
+
+        /**
+         * Begin a scope.
+         * \param profiler Profiler.
+         * \param name Scope name.
+         * \param command_buffer Command buffer to record a GPU scope into (nullptr for a CPU scope).
+         */
+        Scope(Profiler* profiler, std::string_view name, CommandBuffer* command_buffer = nullptr)
+            : m_profiler(profiler)
+            , m_command_buffer(command_buffer)
+        {
+            if (m_command_buffer)
+                m_profiler->begin_scope(m_command_buffer, name);
+            else
+                m_profiler->begin_cpu_scope(name);
+        }
+
+        /// End the scope. Errors (i.e. unbalanced scopes) are logged instead of thrown.
+        ~Scope();
+
+    private:
+        Profiler* m_profiler;
+        CommandBuffer* m_command_buffer;
+    };
+
+    Profiler(ref<Device> device, ref<Fence> fence, ProfilerDesc desc);
+    ~Profiler();
+
+    /// Description of the profiler.
+    const ProfilerDesc& desc() const { return m_desc; }
+
+    /// Index of the current (or last) frame.
+    uint64_t frame_index() const { return m_frame_index; }
+
+    /// Begin a new frame. Resolves all finished frames.
+    void begin_frame();
+
+    /// End the current frame. All scopes must be closed and all command buffers containing scopes submitted.
+    void end_frame();
+
+    /// Block until all frames have finished on the GPU and resolve them.
+    void flush();
+
+    /**
+     * Begin a GPU scope.
+     * \param command_buffer Command buffer to record the begin timestamp into.
+     * \param name Scope name.
+     */
+    void begin_scope(CommandBuffer* command_buffer, std::string_view name);
+
+    /**
+     * End the innermost GPU scope of a command buffer.
+     * \param command_buffer Command buffer to record the end timestamp into.
+     */
+    void end_scope(CommandBuffer* command_buffer);
+
+    /// Begin a CPU scope.
+    void begin_cpu_scope(std::string_view name);
+
+    /// End the innermost CPU scope.
+    void end_cpu_scope();
+
+    /// Rolling statistics of all resolved scopes.
+    std::vector<ScopeStats> stats() const;
+
+    /// Rolling statistics of a resolved scope. Returns empty statistics if the scope does not exist.
+    ScopeStats scope_stats(std::string_view name, bool gpu = true) const;
+
+    /// Reset all statistics and the trace history.
+    void reset_stats();
+
+    /// Generate a Chrome trace (JSON) of the resolved frames in the trace history.
+    std::string trace_json() const;
+
+    /// Write a Chrome trace (JSON) of the resolved frames in the trace history to a file.
+    void write_trace(const std::filesystem::path& path) const;
+
+    std::string to_string() const override;
+
+private:
+    struct GpuScope {
+        std::string name;
+        uint32_t depth;
+        uint32_t begin_query;
+        uint32_t end_query;
+        Timer::TimePoint cpu_time;
+    };
+
+    struct CpuScope {
+        std::string name;
+        uint32_t depth;
+        Timer::TimePoint begin_time;
+        Timer::TimePoint end_time;
+    };
+
+    struct Frame {
+        uint64_t index{0};
+        bool pending{false};
+        uint64_t fence_value{0};
+        Timer::TimePoint begin_time{0};
+        Timer::TimePoint end_time{0};
+        std::vector<ref<QueryPool>> query_pools;
+        uint32_t query_count{0};
+        std::vector<GpuScope> gpu_scopes;
+        std::vector<CpuScope> cpu_scopes;
+        std::map<CommandBuffer*, std::vector<uint32_t>> gpu_stacks;
+        std::vector<uint32_t> cpu_stack;
+    };
+
+    struct TraceEvent {
+        std::string name;
+        bool gpu;
+        double start_us;
+        double duration_us;
+    };
+
+    struct History {
+        std::vector<double> samples;
+        size_t next{0};
+        ScopeStats stats;
+    };
+
+    using StatsKey = std::pair<std::string, bool>;
+
+    Frame& current_frame() { return m_frames[m_frame_index % m_frames.size()]; }
+    /// Index of the oldest frame that may not be resolved yet.
+    uint64_t oldest_frame_index() const
+    {
+        return m_frame_index > m_desc.latency ? m_frame_index - m_desc.latency : 1;
+    }
+    uint32_t write_timestamp(Frame& frame, CommandBuffer* command_buffer);
+    void resolve_frame(Frame& frame);
+    void add_sample(const std::string& name, bool gpu, double duration_ms);
+
+    ProfilerDesc m_desc;
+    ref<Fence> m_fence;
+
+    Timer::TimePoint m_start_time;
+    uint64_t m_frame_index{0};
+    bool m_in_frame{false};
+    std::vector<Frame> m_frames;
+
+    std::map<StatsKey, History> m_history;
+    std::deque<std::vector<TraceEvent>> m_trace;
+};
+
+} // namespace sgl
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/buffer_pool.h"
+
+SGL_PY_EXPORT(device_buffer_pool)
+{
+    using namespace sgl;
+
+    nb::class_<BufferPoolDesc>(m, "BufferPoolDesc", D(BufferPoolDesc))
+        .def(nb::init<>())
+        .def_rw("usage", &BufferPoolDesc::usage, D(BufferPoolDesc, usage))
+        .def_rw("struct_size", &BufferPoolDesc::struct_size, D(BufferPoolDesc, struct_size))
+        .def_rw("format", &BufferPoolDesc::format, D(BufferPoolDesc, format))
+        .def_rw("page_size", &BufferPoolDesc::page_size, D(BufferPoolDesc, page_size))
+        .def_rw("min_block_size", &BufferPoolDesc::min_block_size, D(BufferPoolDesc, min_block_size))
+        .def_rw("debug_name", &BufferPoolDesc::debug_name, D(BufferPoolDesc, debug_name));
+
+    nb::class_<BufferPool, DeviceResource> buffer_pool(m, "BufferPool", D(BufferPool));
+
+    nb::class_<BufferPool::AllocationData>(buffer_pool, "Allocation", D(BufferPool, AllocationData))
+        .def_ro("buffer", &BufferPool::AllocationData::buffer, D(BufferPool, AllocationData, buffer))
+        .def_ro("size", &BufferPool::AllocationData::size, D(BufferPool, AllocationData, size))
+        .def_ro("offset", &BufferPool::AllocationData::offset, D(BufferPool, AllocationData, offset))
+        .def_ro("size_class", &BufferPool::AllocationData::size_class, D(BufferPool, AllocationData, size_class))
+        .def_prop_ro(
+            "device_address",
+            &BufferPool::AllocationData::device_address,
+            D(BufferPool, AllocationData, device_address)
+        )
+        .def("get_srv", &BufferPool::AllocationData::get_srv, D(BufferPool, AllocationData, get_srv))
+        .def("get_uav", &BufferPool::AllocationData::get_uav, D(BufferPool, AllocationData, get_uav))
+        .def(
+            "set_data",
+            [](BufferPool::AllocationData* self, nb::ndarray<nb::device::cpu> data, DeviceOffset offset)
+            {
+                SGL_CHECK(is_ndarray_contiguous(data), "data is not contiguous");
+                self->set_data(data.data(), data.nbytes(), offset);
+            },
+            "data"_a,
+            "offset"_a = 0,
+            D(BufferPool, AllocationData, set_data)
+        );
+
+    nb::class_<BufferPool::Stats>(buffer_pool, "Stats", D(BufferPool, Stats))
+        .def_ro("total_size", &BufferPool::Stats::total_size, D(BufferPool, Stats, total_size))
+        .def_ro("used_size", &BufferPool::Stats::used_size, D(BufferPool, Stats, used_size))
+        .def_ro("allocated_size", &BufferPool::Stats::allocated_size, D(BufferPool, Stats, allocated_size))
+        .def_ro("free_size", &BufferPool::Stats::free_size, D(BufferPool, Stats, free_size))
+        .def_ro("allocation_count", &BufferPool::Stats::allocation_count, D(BufferPool, Stats, allocation_count))
+        .def_ro("page_count", &BufferPool::Stats::page_count, D(BufferPool, Stats, page_count))
+        .def_ro("large_page_count", &BufferPool::Stats::large_page_count, D(BufferPool, Stats, large_page_count))
+        .def_prop_ro("fragmentation", &BufferPool::Stats::fragmentation, D(BufferPool, Stats, fragmentation));
+
+    buffer_pool //
+        .def("allocate", &BufferPool::allocate, "size"_a, D(BufferPool, allocate))
+        .def_prop_ro("stats", &BufferPool::stats, D(BufferPool, stats))
+        .def_prop_ro("size_class_count", &BufferPool::size_class_count, D(BufferPool, size_class_count))
+        .def("block_size", &BufferPool::block_size, "size_class"_a, D(BufferPool, block_size))
+        .def("free_block_count", &BufferPool::free_block_count, "size_class"_a, D(BufferPool, free_block_count));
+}
@@ -31,6 +31,24 @@ SGL_DICT_TO_DESC_FIELD(adapter_luid, AdapterLUID)
 SGL_DICT_TO_DESC_FIELD_DICT(compiler_options, SlangCompilerOptions)
 SGL_DICT_TO_DESC_FIELD(shader_cache_path, std::filesystem::path)
 SGL_DICT_TO_DESC_END()
+
+static const char* __doc_sgl_read_back_request_to_numpy
+    = R"doc(Wait for the read-back to complete and return the data as a numpy array of bytes.)doc";
+
+inline nb::ndarray<nb::numpy> read_back_request_to_numpy(const ReadBackRequest* self)
+{
+    size_t size = self->size();
+    uint8_t* data = new uint8_t[size];
+    {
+        nb::gil_scoped_release guard;
+        self->get_data(data, size);
+    }
+
+    nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
+    size_t shape[1] = {size};
+    return nb::ndarray<nb::numpy>(data, 1, shape, owner, nullptr, nb::dtype<uint8_t>(), nb::device::cpu::value);
+}
+
 } // namespace sgl
 
 SGL_PY_EXPORT(device_device)
@@ -145,6 +163,19 @@ SGL_PY_EXPORT(device_device)
         .def_ro("hit_count", &ShaderCacheStats::hit_count, D(ShaderCacheStats, hit_count))
         .def_ro("miss_count", &ShaderCacheStats::miss_count, D(ShaderCacheStats, miss_count));
 
+    nb::class_<PipelineCacheStats>(m, "PipelineCacheStats", D(PipelineCacheStats))
+        .def_ro("entry_count", &PipelineCacheStats::entry_count, D(PipelineCacheStats, entry_count))
+        .def_ro("hit_count", &PipelineCacheStats::hit_count, D(PipelineCacheStats, hit_count))
+        .def_ro("miss_count", &PipelineCacheStats::miss_count, D(PipelineCacheStats, miss_count))
+        .def_ro("eviction_count", &PipelineCacheStats::eviction_count, D(PipelineCacheStats, eviction_count));
+
+    nb::class_<ReadBackRequest, Object>(m, "ReadBackRequest", D(ReadBackRequest))
+        .def_prop_ro("submission_id", &ReadBackRequest::submission_id, D(ReadBackRequest, submission_id))
+        .def_prop_ro("size", &ReadBackRequest::size, D(ReadBackRequest, size))
+        .def("is_ready", &ReadBackRequest::is_ready, D(ReadBackRequest, is_ready))
+        .def("wait", &ReadBackRequest::wait, nb::call_guard<nb::gil_scoped_release>(), D(ReadBackRequest, wait))
+        .def("to_numpy", &read_back_request_to_numpy, D(read_back_request_to_numpy));
+
     nb::class_<Device, Object> device(m, "Device", D(Device));
     device.def(
         "__init__",
@@ -183,6 +214,33 @@ SGL_PY_EXPORT(device_device)
     device.def_prop_ro("desc", &Device::desc, D(Device, desc));
     device.def_prop_ro("info", &Device::info, D(Device, info));
     device.def_prop_ro("shader_cache_stats", &Device::shader_cache_stats, D(Device, shader_cache_stats));
+    device.def_prop_ro("pipeline_cache_stats", &Device::pipeline_cache_stats, D(Device, pipeline_cache_stats));
+    device.def("clear_pipeline_cache", &Device::clear_pipeline_cache, D(Device, clear_pipeline_cache));
+    device.def_prop_rw(
+        "pipeline_cache_capacity",
+        &Device::pipeline_cache_capacity,
+        &Device::set_pipeline_cache_capacity,
+        D(Device, pipeline_cache_capacity)
+    );
+    device.def_prop_rw(
+        "record_pipeline_manifest",
+        &Device::record_pipeline_manifest,
+        &Device::set_record_pipeline_manifest,
+        D(Device, record_pipeline_manifest)
+    );
+    device.def(
+        "save_pipeline_manifest",
+        &Device::save_pipeline_manifest,
+        "path"_a.none() = nb::none(),
+        D(Device, save_pipeline_manifest)
+    );
+    device.def(
+        "warm_up_pipeline_cache",
+        &Device::warm_up_pipeline_cache,
+        "path"_a.none() = nb::none(),
+        nb::call_guard<nb::gil_scoped_release>(),
+        D(Device, warm_up_pipeline_cache)
+    );
     device.def_prop_ro("supported_shader_model", &Device::supported_shader_model, D(Device, supported_shader_model));
     device.def_prop_ro("features", &Device::features, D(Device, features));
     device.def_prop_ro("supports_cuda_interop", &Device::supports_cuda_interop, D(Device, supports_cuda_interop));
@@ -718,6 +776,7 @@ SGL_PY_EXPORT(device_device)
         D(Device, create_compute_kernel)
     );
     device.def("create_compute_kernel", &Device::create_compute_kernel, "desc"_a, D(Device, create_compute_kernel));
+    device.def("create_dispatch_sequence", &Device::create_dispatch_sequence, D(Device, create_dispatch_sequence));
 
     device.def(
         "create_memory_heap",
@@ -726,6 +785,7 @@ SGL_PY_EXPORT(device_device)
            ResourceUsage usage,
            DeviceSize page_size,
            bool retain_large_pages,
+           bool ring_buffer,
            std::string debug_name)
         {
             return self->create_memory_heap({
@@ -733,6 +793,7 @@ SGL_PY_EXPORT(device_device)
                 .usage = usage,
                 .page_size = page_size,
                 .retain_large_pages = retain_large_pages,
+                .ring_buffer = ring_buffer,
                 .debug_name = std::move(debug_name),
             });
         },
@@ -740,15 +801,89 @@ SGL_PY_EXPORT(device_device)
         "usage"_a,
         "page_size"_a = MemoryHeapDesc().page_size,
         "retain_large_pages"_a = MemoryHeapDesc().retain_large_pages,
+        "ring_buffer"_a = MemoryHeapDesc().ring_buffer,
         "debug_name"_a = MemoryHeapDesc().debug_name,
         D(Device, create_memory_heap)
     );
     device.def("create_memory_heap", &Device::create_memory_heap, "desc"_a, D(Device, create_memory_heap));
 
+    device.def(
+        "create_buffer_pool",
+        [](Device* self,
+           ResourceUsage usage,
+           size_t struct_size,
+           Format format,
+           DeviceSize page_size,
+           DeviceSize min_block_size,
+           std::string debug_name)
+        {
+            return self->create_buffer_pool({
+                .usage = usage,
+                .struct_size = struct_size,
+                .format = format,
+                .page_size = page_size,
+                .min_block_size = min_block_size,
+                .debug_name = std::move(debug_name),
+            });
+        },
+        "usage"_a = BufferPoolDesc().usage,
+        "struct_size"_a = BufferPoolDesc().struct_size,
+        "format"_a = BufferPoolDesc().format,
+        "page_size"_a = BufferPoolDesc().page_size,
+        "min_block_size"_a = BufferPoolDesc().min_block_size,
+        "debug_name"_a = BufferPoolDesc().debug_name,
+        D(Device, create_buffer_pool)
+    );
+    device.def("create_buffer_pool", &Device::create_buffer_pool, "desc"_a, D(Device, create_buffer_pool));
+
+    device.def(
+        "create_profiler",
+        [](Device* self, uint32_t latency, uint32_t history_size, uint32_t trace_frame_count, uint32_t queries_per_pool)
+        {
+            return self->create_profiler({
+                .latency = latency,
+                .history_size = history_size,
+                .trace_frame_count = trace_frame_count,
+                .queries_per_pool = queries_per_pool,
+            });
+        },
+        "latency"_a = ProfilerDesc().latency,
+        "history_size"_a = ProfilerDesc().history_size,
+        "trace_frame_count"_a = ProfilerDesc().trace_frame_count,
+        "queries_per_pool"_a = ProfilerDesc().queries_per_pool,
+        D(Device, create_profiler)
+    );
+    device.def("create_profiler", &Device::create_profiler, "desc"_a, D(Device, create_profiler));
+
     device.def_prop_ro("upload_heap", &Device::upload_heap, D(Device, upload_heap));
     device.def_prop_ro("read_back_heap", &Device::read_back_heap, D(Device, read_back_heap));
-    device.def("flush_print", &Device::flush_print, D(Device, flush_print));
-    device.def("flush_print_to_string", &Device::flush_print_to_string, D(Device, flush_print_to_string));
+    device.def(
+        "read_buffer_data_async",
+        [](Device* self, const Buffer* buffer, std::optional<size_t> size, size_t offset)
+        {
+            SGL_CHECK_NOT_NULL(buffer);
+            SGL_CHECK_LE(offset, buffer->size());
+            return self->read_buffer_data_async(buffer, size.value_or(buffer->size() - offset), offset);
+        },
+        "buffer"_a,
+        "size"_a.none() = nb::none(),
+        "offset"_a = 0,
+        D(Device, read_buffer_data_async)
+    );
+    device.def(
+        "read_texture_data_async",
+        &Device::read_texture_data_async,
+        "texture"_a,
+        "subresource"_a = 0,
+        D(Device, read_texture_data_async)
+    );
+    device.def("flush_print", &Device::flush_print, "wait"_a = true, D(Device, flush_print));
+    device.def(
+        "flush_print_to_string",
+        &Device::flush_print_to_string,
+        "wait"_a = true,
+        D(Device, flush_print_to_string)
+    );
     device.def("run_garbage_collection", &Device::run_garbage_collection, D(Device, run_garbage_collection));
     device.def("wait", &Device::wait, D(Device, wait));
 
@@ -3,21 +3,36 @@
 #include "nanobind.h"
 
 #include "sgl/device/kernel.h"
+#include "sgl/device/buffer_pool.h"
 #include "sgl/device/command.h"
 #include "sgl/device/resource.h"
 #include "sgl/device/sampler.h"
 #include "sgl/device/pipeline.h"
 #include "sgl/device/shader.h"
+#include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
+
+#include "sgl/core/format.h"
+#include "sgl/core/hash.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace sgl {
 
-inline void bind_python_var(ShaderCursor cursor, nb::handle var)
+/// Function binding a single (non-container) Python value through a precompiled path.
+using BindFunc = void (*)(const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var);
+
+/// Get the function to bind a Python value, or nullptr if the value is a container or unsupported.
+inline BindFunc get_bind_func(nb::handle var)
 {
 #define HANDLE_VECTOR_TYPE(type)                                                                                       \
-    if (nb::isinstance<type>(var)) {                                                                                   \
-        cursor = nb::cast<type>(var);                                                                                  \
-        return;                                                                                                        \
-    }
+    if (nb::isinstance<type>(var))                                                                                     \
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)                           \
+        { path.set(shader_object, nb::cast<type>(var)); };
 
     HANDLE_VECTOR_TYPE(uint2);
     HANDLE_VECTOR_TYPE(uint3);
@@ -34,36 +49,260 @@ inline void bind_python_var(ShaderCursor cursor, nb::handle var)
 
 #undef HANDLE_VECTOR_TYPE
 
-    if (nb::isinstance<nb::int_>(var)) {
-        cursor = nb::cast<int>(var);
-    } else if (nb::isinstance<nb::float_>(var)) {
-        cursor = nb::cast<float>(var);
-    } else if (nb::isinstance<ResourceView>(var)) {
-        cursor = ref<ResourceView>(nb::cast<ResourceView*>(var));
-    } else if (nb::isinstance<Buffer>(var)) {
-        cursor = ref<Buffer>(nb::cast<Buffer*>(var));
-    } else if (nb::isinstance<Texture>(var)) {
-        cursor = ref<Texture>(nb::cast<Texture*>(var));
-    } else if (nb::isinstance<Sampler>(var)) {
-        cursor = ref<Sampler>(nb::cast<Sampler*>(var));
-    } else if (nb::isinstance<AccelerationStructure>(var)) {
-        cursor = ref<AccelerationStructure>(nb::cast<AccelerationStructure*>(var));
-    } else if (nb::isinstance<MutableShaderObject>(var)) {
-        cursor = ref<MutableShaderObject>(nb::cast<MutableShaderObject*>(var));
-    } else if (nb::isinstance<nb::list>(var)) {
-        uint32_t index = 0;
-        for (const auto& value : nb::cast<nb::list>(var))
-            bind_python_var(cursor[index++], value);
-    } else if (nb::isinstance<nb::dict>(var)) {
-        for (const auto& [key, value] : nb::cast<nb::dict>(var))
-            bind_python_var(cursor[nb::cast<std::string_view>(key)], value);
-    } else if (nb::isinstance<nb::ndarray<nb::device::cuda>>(var)) {
-        cursor.set_cuda_tensor_view(ndarray_to_cuda_tensor_view(nb::cast<nb::ndarray<nb::device::cuda>>(var)));
-    } else {
-        SGL_THROW("Unsupported variable type!");
-    }
+#define HANDLE_REF_TYPE(type)                                                                                          \
+    if (nb::isinstance<type>(var))                                                                                     \
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)                           \
+        { path.set(shader_object, ref<type>(nb::cast<type*>(var))); };
+
+    if (nb::isinstance<nb::int_>(var))
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)
+        { path.set(shader_object, nb::cast<int>(var)); };
+    if (nb::isinstance<nb::float_>(var))
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)
+        { path.set(shader_object, nb::cast<float>(var)); };
+    HANDLE_REF_TYPE(ResourceView);
+    HANDLE_REF_TYPE(Buffer);
+    HANDLE_REF_TYPE(Texture);
+    HANDLE_REF_TYPE(Sampler);
+    HANDLE_REF_TYPE(AccelerationStructure);
+    HANDLE_REF_TYPE(MutableShaderObject);
+    // Buffer pool allocations bind the range of their backing buffer.
+    if (nb::isinstance<BufferPool::AllocationData>(var))
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)
+        {
+            const BufferPool::AllocationData* allocation = nb::cast<const BufferPool::AllocationData*>(var);
+            path.set_buffer(shader_object, allocation->buffer, allocation->range());
+        };
+    // Note: Tensors on the CPU have the same Python type as tensors on the GPU,
+    // in which case the cast will fail when the cached plan is executed.
+    if (nb::isinstance<nb::ndarray<nb::device::cuda>>(var))
+        return [](const ShaderCursorPath& path, ShaderObject* shader_object, nb::handle var)
+        {
+            path.set_cuda_tensor_view(
+                shader_object,
+                ndarray_to_cuda_tensor_view(nb::cast<nb::ndarray<nb::device::cuda>>(var))
+            );
+        };
+
+#undef HANDLE_REF_TYPE
+
+    return nullptr;
 }
 
+/**
+ * Plan for binding a tree of Python variables (nested dicts and lists).
+ *
+ * The plan is built once for a given signature (argument names and Python types) and stores
+ * the tree in pre-order together with a precompiled shader cursor path and bind function for
+ * every leaf value. Executing the plan only needs to check that the variables still match
+ * the signature and does not touch the reflection data.
+ */
+class BindingPlan {
+public:
+    /// Build a plan for binding \c vars relative to \c cursor.
+    BindingPlan(const ShaderCursor& cursor, nb::dict vars) { build(cursor, vars, "", ""); }
+
+    /// Bind \c vars to \c shader_object.
+    /// Returns false if \c vars does not match the signature the plan was built for.
+    bool execute(ShaderObject* shader_object, nb::dict vars) const
+    {
+        size_t node_index = 0;
+        return execute(shader_object, vars, node_index) && node_index == m_nodes.size();
+    }
+
+private:
+    static constexpr uint32_t NO_STEP = uint32_t(-1);
+
+    struct Node {
+        /// Dict key (empty for list elements and the root).
+        std::string key;
+        /// Python type of the value.
+        PyTypeObject* type;
+        /// Number of children (dicts and lists only).
+        size_t child_count{0};
+        /// Index of the bind step (leaf values only).
+        uint32_t step_index{NO_STEP};
+    };
+
+    struct Step {
+        ShaderCursorPath path;
+        BindFunc bind;
+    };
+
+    void build(const ShaderCursor& cursor, nb::handle var, std::string_view key, const std::string& path)
+    {
+        size_t node_index = m_nodes.size();
+        m_nodes.push_back({std::string(key), Py_TYPE(var.ptr())});
+
+        if (nb::isinstance<nb::dict>(var)) {
+            nb::dict dict = nb::borrow<nb::dict>(var);
+            m_nodes[node_index].child_count = dict.size();
+            for (const auto& [child_key, value] : dict) {
+                std::string_view name = nb::cast<std::string_view>(child_key);
+                build(cursor, value, name, path.empty() ? std::string(name) : fmt::format("{}.{}", path, name));
+            }
+        } else if (nb::isinstance<nb::list>(var)) {
+            nb::list list = nb::borrow<nb::list>(var);
+            m_nodes[node_index].child_count = list.size();
+            uint32_t index = 0;
+            for (const auto& value : list)
+                build(cursor, value, "", fmt::format("{}[{}]", path, index++));
+        } else {
+            BindFunc bind = get_bind_func(var);
+            SGL_CHECK(bind, "Unsupported variable type!");
+            m_nodes[node_index].step_index = narrow_cast<uint32_t>(m_steps.size());
+            m_steps.push_back({ShaderCursorPath(cursor, path), bind});
+        }
+    }
+
+    bool execute(ShaderObject* shader_object, nb::handle var, size_t& node_index) const
+    {
+        if (node_index >= m_nodes.size())
+            return false;
+        const Node& node = m_nodes[node_index++];
+        if (Py_TYPE(var.ptr()) != node.type)
+            return false;
+
+        if (node.step_index != NO_STEP) {
+            const Step& step = m_steps[node.step_index];
+            step.bind(step.path, shader_object, var);
+        } else if (nb::isinstance<nb::dict>(var)) {
+            nb::dict dict = nb::borrow<nb::dict>(var);
+            if (dict.size() != node.child_count)
+                return false;
+            for (const auto& [key, value] : dict) {
+                if (node_index >= m_nodes.size() || nb::cast<std::string_view>(key) != m_nodes[node_index].key)
+                    return false;
+                if (!execute(shader_object, value, node_index))
+                    return false;
+            }
+        } else {
+            nb::list list = nb::borrow<nb::list>(var);
+            if (list.size() != node.child_count)
+                return false;
+            for (const auto& value : list)
+                if (!execute(shader_object, value, node_index))
+                    return false;
+        }
+        return true;
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<Step> m_steps;
+};
+
+/**
+ * Per-kernel cache of binding plans used by `ComputeKernel.dispatch`.
+ *
+ * Plans are keyed by a hash of the argument names and Python types. Dispatching with
+ * the same signature again reuses the plan and skips both the type probing and the
+ * shader cursor lookups. Plans are only valid for the program generation they were
+ * built for, the cache is cleared when the program is hot reloaded.
+ */
+class BindingPlanCache : public Object {
+    SGL_OBJECT(BindingPlanCache)
+public:
+    /// Maximum number of cached signatures per kernel before the cache is reset.
+    static constexpr size_t MAX_PLANS = 64;
+
+    static BindingPlanCache* get(Kernel* kernel)
+    {
+        if (!kernel->binding_cache())
+            kernel->set_binding_cache(make_ref<BindingPlanCache>());
+        BindingPlanCache* cache = static_cast<BindingPlanCache*>(kernel->binding_cache());
+
+        // Shader cursor paths refer to the program layout, which is recreated on hot reload.
+        uint64_t generation = kernel->program()->generation();
+        if (cache->m_program_generation != generation) {
+            cache->m_plans.clear();
+            cache->m_program_generation = generation;
+        }
+        return cache;
+    }
+
+    void bind(ShaderCursor cursor, nb::dict entry_point_vars, nb::dict global_vars)
+    {
+        size_t hash = signature_hash(global_vars, signature_hash(entry_point_vars, 0));
+
+        ShaderObject* global_object = cursor.shader_object();
+        ref<ShaderObject> entry_point_object;
+        if (entry_point_vars.size() > 0)
+            entry_point_object = global_object->get_entry_point(0);
+
+        auto it = m_plans.find(hash);
+        if (it != m_plans.end() && it->second.execute(entry_point_object, global_object, entry_point_vars, global_vars))
+            return;
+
+        // Build a new plan. This happens for a new signature or (very rarely) on a hash collision.
+        if (m_plans.size() >= MAX_PLANS)
+            m_plans.clear();
+        Plan plan{.globals = BindingPlan(cursor, global_vars)};
+        if (entry_point_object)
+            plan.entry_point.emplace(ShaderCursor(entry_point_object), entry_point_vars);
+        bool success = plan.execute(entry_point_object, global_object, entry_point_vars, global_vars);
+        SGL_ASSERT(success);
+        SGL_UNUSED(success);
+        m_plans.insert_or_assign(hash, std::move(plan));
+    }
+
+private:
+    struct Plan {
+        std::optional<BindingPlan> entry_point;
+        BindingPlan globals;
+
+        bool execute(
+            ShaderObject* entry_point_object,
+            ShaderObject* global_object,
+            nb::dict entry_point_vars,
+            nb::dict global_vars
+        ) const
+        {
+            if (entry_point.has_value() != (entry_point_object != nullptr))
+                return false;
+            // bind locals
+            if (entry_point && !entry_point->execute(entry_point_object, entry_point_vars))
+                return false;
+            // bind globals
+            return globals.execute(global_object, global_vars);
+        }
+    };
+
+    static size_t signature_hash(nb::handle var, size_t hash)
+    {
+        hash = hash_combine(hash, reinterpret_cast<uintptr_t>(Py_TYPE(var.ptr())));
+        if (nb::isinstance<nb::dict>(var)) {
+            nb::dict dict = nb::borrow<nb::dict>(var);
+            hash = hash_combine(hash, dict.size());
+            for (const auto& [key, value] : dict) {
+                // String hashes are cached by Python, so this is cheap.
+                hash = hash_combine(hash, size_t(PyObject_Hash(key.ptr())));
+                hash = signature_hash(value, hash);
+            }
+        } else if (nb::isinstance<nb::list>(var)) {
+            nb::list list = nb::borrow<nb::list>(var);
+            hash = hash_combine(hash, list.size());
+            for (const auto& value : list)
+                hash = signature_hash(value, hash);
+        }
+        return hash;
+    }
+
+    std::unordered_map<size_t, Plan> m_plans;
+    uint64_t m_program_generation{0};
+};
+
+/// Python variables captured by a recorded dispatch for rebinding after a hot reload.
+/// The sequence may be destroyed without holding the GIL, so the reference is released with the GIL acquired.
+struct CapturedVars {
+    std::optional<nb::dict> vars;
+
+    ~CapturedVars()
+    {
+        nb::gil_scoped_acquire guard;
+        vars.reset();
+    }
+};
+
 } // namespace sgl
 
 SGL_PY_EXPORT(device_kernel)
@@ -84,14 +323,8 @@ SGL_PY_EXPORT(device_kernel)
             "dispatch",
             [](ComputeKernel* self, uint3 thread_count, nb::dict vars, CommandBuffer* command_buffer, nb::kwargs kwargs)
             {
-                auto bind_vars = [&](ShaderCursor cursor)
-                {
-                    // bind locals
-                    if (kwargs.size() > 0)
-                        bind_python_var(cursor.find_entry_point(0), kwargs);
-                    // bind globals
-                    bind_python_var(cursor, vars);
-                };
+                BindingPlanCache* binding_plan_cache = BindingPlanCache::get(self);
+                auto bind_vars = [&](ShaderCursor cursor) { binding_plan_cache->bind(cursor, kwargs, vars); };
                 self->dispatch(thread_count, bind_vars, command_buffer);
             },
             "thread_count"_a,
@@ -100,4 +333,46 @@ SGL_PY_EXPORT(device_kernel)
             "kwargs"_a,
             D(ComputeKernel, dispatch)
         );
+
+    nb::class_<DispatchSequence, DeviceResource>(m, "DispatchSequence", D(DispatchSequence))
+        .def_prop_ro("dispatch_count", &DispatchSequence::dispatch_count, D(DispatchSequence, dispatch_count))
+        .def(
+            "record",
+            [](DispatchSequence* self, ComputeKernel* kernel, uint3 thread_count, nb::dict vars)
+            {
+                auto captured = std::make_shared<CapturedVars>();
+                captured->vars = vars;
+                auto bind_vars = [kernel, captured](ShaderCursor cursor)
+                {
+                    nb::gil_scoped_acquire guard;
+                    BindingPlanCache::get(kernel)->bind(cursor, nb::dict(), *captured->vars);
+                };
+                return self->record(kernel, thread_count, bind_vars);
+            },
+            "kernel"_a,
+            "thread_count"_a,
+            "vars"_a = nb::dict(),
+            D(DispatchSequence, record)
+        )
+        .def(
+            "update",
+            [](DispatchSequence* self, uint32_t index, nb::dict vars)
+            { BindingPlanCache::get(self->kernel(index))->bind(self->cursor(index), nb::dict(), vars); },
+            "index"_a,
+            "vars"_a,
+            D(DispatchSequence, update)
+        )
+        .def("kernel", &DispatchSequence::kernel, "index"_a, D(DispatchSequence, kernel))
+        .def("shader_object", &DispatchSequence::shader_object, "index"_a, D(DispatchSequence, shader_object))
+        .def("cursor", &DispatchSequence::cursor, "index"_a, D(DispatchSequence, cursor))
+        .def(
+            "set_thread_count",
+            &DispatchSequence::set_thread_count,
+            "index"_a,
+            "thread_count"_a,
+            D(DispatchSequence, set_thread_count)
+        )
+        .def("clear", &DispatchSequence::clear, D(DispatchSequence, clear))
+        .def("encode", &DispatchSequence::encode, "encoder"_a, D(DispatchSequence, encode))
+        .def("submit", &DispatchSequence::submit, "command_buffer"_a = nullptr, D(DispatchSequence, submit));
 }
@@ -14,6 +14,7 @@ SGL_PY_EXPORT(device_memory_heap)
         .def_rw("usage", &MemoryHeapDesc::usage, D(MemoryHeapDesc, usage))
         .def_rw("page_size", &MemoryHeapDesc::page_size, D(MemoryHeapDesc, page_size))
         .def_rw("retain_large_pages", &MemoryHeapDesc::retain_large_pages, D(MemoryHeapDesc, retain_large_pages))
+        .def_rw("ring_buffer", &MemoryHeapDesc::ring_buffer, D(MemoryHeapDesc, ring_buffer))
         .def_rw("debug_name", &MemoryHeapDesc::debug_name, D(MemoryHeapDesc, debug_name));
 
     nb::class_<MemoryHeap, DeviceResource> memory_heap(m, "MemoryHeap", D(MemoryHeap));
@@ -28,6 +29,20 @@ SGL_PY_EXPORT(device_memory_heap)
             D(MemoryHeap, AllocationData, device_address)
         );
 
+    nb::class_<MemoryHeap::TransientAllocation>(
+        memory_heap,
+        "TransientAllocation",
+        D(MemoryHeap, TransientAllocation)
+    )
+        .def_ro("buffer", &MemoryHeap::TransientAllocation::buffer, D(MemoryHeap, TransientAllocation, buffer))
+        .def_ro("size", &MemoryHeap::TransientAllocation::size, D(MemoryHeap, TransientAllocation, size))
+        .def_ro("offset", &MemoryHeap::TransientAllocation::offset, D(MemoryHeap, TransientAllocation, offset))
+        .def_prop_ro(
+            "device_address",
+            &MemoryHeap::TransientAllocation::device_address,
+            D(MemoryHeap, TransientAllocation, device_address)
+        );
+
     nb::class_<MemoryHeap::Stats>(memory_heap, "Stats", D(MemoryHeap, Stats))
         .def_ro("total_size", &MemoryHeap::Stats::total_size, D(MemoryHeap, Stats, total_size))
         .def_ro("used_size", &MemoryHeap::Stats::used_size, D(MemoryHeap, Stats, used_size))
@@ -36,5 +51,18 @@ SGL_PY_EXPORT(device_memory_heap)
 
     memory_heap //
         .def("allocate", &MemoryHeap::allocate, "size"_a, "alignment"_a = 1, D(MemoryHeap, allocate))
+        .def(
+            "allocate_transient",
+            &MemoryHeap::allocate_transient,
+            "size"_a,
+            "alignment"_a = 1,
+            D(MemoryHeap, allocate_transient)
+        )
+        .def("retire_pages", &MemoryHeap::retire_pages, "fence_value"_a, D(MemoryHeap, retire_pages))
+        .def(
+            "execute_deferred_releases",
+            &MemoryHeap::execute_deferred_releases,
+            D(MemoryHeap, execute_deferred_releases)
+        )
         .def_prop_ro("stats", &MemoryHeap::stats, D(MemoryHeap, stats));
 }
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/profiler.h"
+#include "sgl/device/command.h"
+
+namespace sgl {
+
+/// Python context manager for recording a CPU or GPU scope.
+struct PyProfilerScope {
+    ref<Profiler> profiler;
+    std::string name;
+    ref<CommandBuffer> command_buffer;
+
+    void enter()
+    {
+        if (command_buffer)
+            profiler->begin_scope(command_buffer, name);
+        else
+            profiler->begin_cpu_scope(name);
+    }
+
+    void exit()
+    {
+        if (command_buffer)
+            profiler->end_scope(command_buffer);
+        else
+            profiler->end_cpu_scope();
+    }
+};
+
+} // namespace sgl
+
+SGL_PY_EXPORT(device_profiler)
+{
+    using namespace sgl;
+
+    nb::class_<ProfilerDesc>(m, "ProfilerDesc", D(ProfilerDesc))
+        .def(nb::init<>())
+        .def_rw("latency", &ProfilerDesc::latency, D(ProfilerDesc, latency))
+        .def_rw("history_size", &ProfilerDesc::history_size, D(ProfilerDesc, history_size))
+        .def_rw("trace_frame_count", &ProfilerDesc::trace_frame_count, D(ProfilerDesc, trace_frame_count))
+        .def_rw("queries_per_pool", &ProfilerDesc::queries_per_pool, D(ProfilerDesc, queries_per_pool));
+
+    nb::class_<Profiler, DeviceResource> profiler(m, "Profiler", D(Profiler));
+
+    nb::class_<Profiler::ScopeStats>(profiler, "ScopeStats", D(Profiler, ScopeStats))
+        .def_ro("name", &Profiler::ScopeStats::name, D(Profiler, ScopeStats, name))
+        .def_ro("gpu", &Profiler::ScopeStats::gpu, D(Profiler, ScopeStats, gpu))
+        .def_ro("count", &Profiler::ScopeStats::count, D(Profiler, ScopeStats, count))
+        .def_ro("last_ms", &Profiler::ScopeStats::last_ms, D(Profiler, ScopeStats, last_ms))
+        .def_ro("average_ms", &Profiler::ScopeStats::average_ms, D(Profiler, ScopeStats, average_ms))
+        .def_ro("min_ms", &Profiler::ScopeStats::min_ms, D(Profiler, ScopeStats, min_ms))
+        .def_ro("max_ms", &Profiler::ScopeStats::max_ms, D(Profiler, ScopeStats, max_ms));
+
+    nb::class_<PyProfilerScope>(profiler, "Scope", D(Profiler, Scope))
+        .def(
+            "__enter__",
+            [](PyProfilerScope* self)
+            {
+                self->enter();
+                return self;
+            },
+            nb::rv_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](PyProfilerScope* self, nb::object, nb::object, nb::object) { self->exit(); },
+            "exc_type"_a = nb::none(),
+            "exc_value"_a = nb::none(),
+            "traceback"_a = nb::none()
+        );
+
+    profiler //
+        .def_prop_ro("desc", &Profiler::desc, D(Profiler, desc))
+        .def_prop_ro("frame_index", &Profiler::frame_index, D(Profiler, frame_index))
+        .def("begin_frame", &Profiler::begin_frame, D(Profiler, begin_frame))
+        .def("end_frame", &Profiler::end_frame, D(Profiler, end_frame))
+        .def("flush", &Profiler::flush, D(Profiler, flush))
+        .def("begin_scope", &Profiler::begin_scope, "command_buffer"_a, "name"_a, D(Profiler, begin_scope))
+        .def("end_scope", &Profiler::end_scope, "command_buffer"_a, D(Profiler, end_scope))
+        .def("begin_cpu_scope", &Profiler::begin_cpu_scope, "name"_a, D(Profiler, begin_cpu_scope))
+        .def("end_cpu_scope", &Profiler::end_cpu_scope, D(Profiler, end_cpu_scope))
+        .def(
+            "scope",
+            [](Profiler* self, std::string name, CommandBuffer* command_buffer)
+            {
+                return PyProfilerScope{
+                    .profiler = ref<Profiler>(self),
+                    .name = std::move(name),
+                    .command_buffer = ref<CommandBuffer>(command_buffer),
+                };
+            },
+            "name"_a,
+            "command_buffer"_a.none() = nullptr,
+            D(Profiler, scope)
+        )
+        .def_prop_ro("stats", &Profiler::stats, D(Profiler, stats))
+        .def("scope_stats", &Profiler::scope_stats, "name"_a, "gpu"_a = true, D(Profiler, scope_stats))
+        .def("reset_stats", &Profiler::reset_stats, D(Profiler, reset_stats))
+        .def("trace_json", &Profiler::trace_json, D(Profiler, trace_json))
+        .def("write_trace", &Profiler::write_trace, "path"_a, D(Profiler, write_trace));
+}
@@ -234,5 +234,6 @@ SGL_PY_EXPORT(device_shader)
 
     nb::class_<ShaderProgram, DeviceResource>(m, "ShaderProgram", D(ShaderProgram))
         .def_prop_ro("layout", &ShaderProgram::layout, D(ShaderProgram, layout))
+        .def_prop_ro("hash", &ShaderProgram::hash, D(ShaderProgram, hash))
         .def_prop_ro("reflection", &ShaderProgram::reflection, D(ShaderProgram, reflection));
 }
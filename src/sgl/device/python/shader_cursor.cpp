@@ -5,6 +5,7 @@
 #include "sgl/device/shader_cursor.h"
 #include "sgl/device/shader_object.h"
 #include "sgl/device/resource.h"
+#include "sgl/device/buffer_pool.h"
 #include "sgl/device/sampler.h"
 #include "sgl/device/raytracing.h"
 #include "sgl/device/cuda_interop.h"
@@ -53,6 +54,128 @@ inline std::optional<TypeReflection::ScalarType> dtype_to_scalar_type(nb::dlpack
     }
     return {};
 }
+/// Adapter to bind values through a \c ShaderCursorPath using the interface of \c ShaderCursor.
+struct ShaderCursorPathTarget {
+    const ShaderCursorPath& path;
+    ShaderObject* shader_object;
+
+    template<typename T>
+    void operator=(const T& value) const
+    {
+        path.set(shader_object, value);
+    }
+
+    void _set_array(const void* data, size_t size, TypeReflection::ScalarType scalar_type, size_t element_count) const
+    {
+        path._set_array(shader_object, data, size, scalar_type, element_count);
+    }
+    void _set_vector(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int dimension) const
+    {
+        path._set_vector(shader_object, data, size, scalar_type, dimension);
+    }
+    void _set_matrix(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int rows, int cols) const
+    {
+        path._set_matrix(shader_object, data, size, scalar_type, rows, cols);
+    }
+};
+
+// Python only has an `int` and `float` type that can have different bit-width.
+// We use reflection data to convert the Python types to the correct types before assigning.
+// The helpers below are shared by ShaderCursor and ShaderCursorPath, \c describe returns the
+// name of the variable for error messages.
+
+template<typename Target, typename Describe>
+inline void set_python_int(
+    const Target& target,
+    TypeReflection::Kind kind,
+    TypeReflection::ScalarType scalar_type,
+    nb::int_ value,
+    Describe describe
+)
+{
+    SGL_CHECK(kind == TypeReflection::Kind::scalar, "{} is not a scalar type.", describe());
+    switch (scalar_type) {
+    case TypeReflection::ScalarType::int16:
+    case TypeReflection::ScalarType::int32:
+        target = nb::cast<int32_t>(value);
+        break;
+    case TypeReflection::ScalarType::int64:
+        target = nb::cast<int64_t>(value);
+        break;
+    case TypeReflection::ScalarType::uint16:
+    case TypeReflection::ScalarType::uint32:
+        target = nb::cast<uint32_t>(value);
+        break;
+    case TypeReflection::ScalarType::uint64:
+        target = nb::cast<uint64_t>(value);
+        break;
+    default:
+        SGL_THROW("{} is not an integer type.", describe());
+        break;
+    }
+}
+
+template<typename Target, typename Describe>
+inline void set_python_float(
+    const Target& target,
+    TypeReflection::Kind kind,
+    TypeReflection::ScalarType scalar_type,
+    nb::float_ value,
+    Describe describe
+)
+{
+    SGL_CHECK(kind == TypeReflection::Kind::scalar, "{} is not a scalar type.", describe());
+    switch (scalar_type) {
+    case TypeReflection::ScalarType::float16:
+        target = float16_t(nb::cast<float>(value));
+        break;
+    case TypeReflection::ScalarType::float32:
+        target = nb::cast<float>(value);
+        break;
+    case TypeReflection::ScalarType::float64:
+        target = nb::cast<double>(value);
+        break;
+    default:
+        SGL_THROW("{} is not a floating point type.", describe());
+        break;
+    }
+}
+
+template<typename Target, typename Describe>
+inline void set_numpy(const Target& target, TypeReflection::Kind kind, nb::ndarray<nb::numpy> value, Describe describe)
+{
+    auto src_scalar_type = dtype_to_scalar_type(value.dtype());
+    SGL_CHECK(src_scalar_type, "numpy array has unsupported dtype.");
+    SGL_CHECK(is_ndarray_contiguous(value), "numpy array is not contiguous.");
+
+    switch (kind) {
+    case TypeReflection::Kind::array:
+        SGL_CHECK(value.ndim() == 1, "numpy array must have 1 dimension.");
+        target._set_array(value.data(), value.nbytes(), *src_scalar_type, narrow_cast<int>(value.shape(0)));
+        break;
+    case TypeReflection::Kind::matrix:
+        SGL_CHECK(value.ndim() == 2, "numpy array must have 2 dimensions.");
+        target._set_matrix(
+            value.data(),
+            value.nbytes(),
+            *src_scalar_type,
+            narrow_cast<int>(value.shape(0)),
+            narrow_cast<int>(value.shape(1))
+        );
+        break;
+    case TypeReflection::Kind::vector: {
+        SGL_CHECK(value.ndim() == 1 || value.ndim() == 2, "numpy array must have 1 or 2 dimensions.");
+        size_t dimension = 1;
+        for (size_t i = 0; i < value.ndim(); ++i)
+            dimension *= value.shape(i);
+        target._set_vector(value.data(), value.nbytes(), *src_scalar_type, narrow_cast<int>(dimension));
+        break;
+    }
+    default:
+        SGL_THROW("{} is not a vector, matrix, or array type.", describe());
+    }
+}
+
 } // namespace sgl
 
 SGL_PY_EXPORT(device_shader_cursor)
@@ -81,7 +204,15 @@ SGL_PY_EXPORT(device_shader_cursor)
         .def("has_element", &ShaderCursor::has_element, "index"_a, D(ShaderCursor, has_element))
         .def("set_object", &ShaderCursor::set_object, "object"_a, D(ShaderCursor, set_object))
         .def("set_resource", &ShaderCursor::set_resource, "resource_view"_a, D(ShaderCursor, set_resource))
-        .def("set_buffer", &ShaderCursor::set_buffer, "buffer"_a, D(ShaderCursor, set_buffer))
+        .def(
+            "set_buffer",
+            [](ShaderCursor& self, const ref<Buffer>& buffer, uint64_t offset, uint64_t size)
+            { self.set_buffer(buffer, {.offset = offset, .size = size}); },
+            "buffer"_a,
+            "offset"_a = 0,
+            "size"_a = BufferRange::ALL,
+            D(ShaderCursor, set_buffer, 2)
+        )
         .def("set_texture", &ShaderCursor::set_texture, "texture"_a, D(ShaderCursor, set_texture))
         .def("set_sampler", &ShaderCursor::set_sampler, "sampler"_a, D(ShaderCursor, set_sampler))
         .def(
@@ -119,6 +250,18 @@ SGL_PY_EXPORT(device_shader_cursor)
     def_setter(ref<Sampler>);
     def_setter(ref<AccelerationStructure>);
 
+    // Buffer pool allocations bind the range of their backing buffer.
+    shader_cursor.def(
+        "__setitem__",
+        [](ShaderCursor& self, std::string_view name, const BufferPool::AllocationData* allocation)
+        { self[name].set_buffer(allocation->buffer, allocation->range()); }
+    );
+    shader_cursor.def(
+        "__setattr__",
+        [](ShaderCursor& self, std::string_view name, const BufferPool::AllocationData* allocation)
+        { self[name].set_buffer(allocation->buffer, allocation->range()); }
+    );
+
     def_setter(bool);
     def_setter(bool2);
     def_setter(bool3);
@@ -148,58 +291,32 @@ SGL_PY_EXPORT(device_shader_cursor)
 
 #undef def_setter
 
-    // We need to handle integers and floats specially.
-    // Python only has an `int` and `float` type that can have different bit-width.
-    // We use reflection data to convert the Python types to the correct types before assigning.
+    // Python integers, floats and numpy arrays are converted using the reflection data.
 
     auto set_int_field = [](ShaderCursor& self, std::string_view name, nb::int_ value)
     {
-        ref<const TypeReflection> type = self[name].type();
-        SGL_CHECK(type->kind() == TypeReflection::Kind::scalar, "Field \"{}\" is not a scalar type.", name);
-        switch (type->scalar_type()) {
-        case TypeReflection::ScalarType::int16:
-        case TypeReflection::ScalarType::int32:
-            self[name] = nb::cast<int32_t>(value);
-            break;
-        case TypeReflection::ScalarType::int64:
-            self[name] = nb::cast<int64_t>(value);
-            break;
-        case TypeReflection::ScalarType::uint16:
-        case TypeReflection::ScalarType::uint32:
-            self[name] = nb::cast<uint32_t>(value);
-            break;
-        case TypeReflection::ScalarType::uint64:
-            self[name] = nb::cast<uint64_t>(value);
-            break;
-        default:
-            SGL_THROW("Field \"{}\" is not an integer type.");
-            break;
-        }
+        ShaderCursor field = self[name];
+        ref<const TypeReflection> type = field.type();
+        set_python_int(
+            field,
+            type->kind(),
+            type->scalar_type(),
+            value,
+            [&] { return fmt::format("Field \"{}\"", name); }
+        );
     };
 
     auto set_int_element = [](ShaderCursor& self, int index, nb::int_ value)
     {
-        ref<const TypeReflection> type = self[index].type();
-        SGL_CHECK(type->kind() == TypeReflection::Kind::scalar, "Element {} is not a scalar type.", index);
-        switch (type->scalar_type()) {
-        case TypeReflection::ScalarType::int16:
-        case TypeReflection::ScalarType::int32:
-            self[index] = nb::cast<int32_t>(value);
-            break;
-        case TypeReflection::ScalarType::int64:
-            self[index] = nb::cast<int64_t>(value);
-            break;
-        case TypeReflection::ScalarType::uint16:
-        case TypeReflection::ScalarType::uint32:
-            self[index] = nb::cast<uint32_t>(value);
-            break;
-        case TypeReflection::ScalarType::uint64:
-            self[index] = nb::cast<uint64_t>(value);
-            break;
-        default:
-            SGL_THROW("Element {} is not an integer type.");
-            break;
-        }
+        ShaderCursor element = self[index];
+        ref<const TypeReflection> type = element.type();
+        set_python_int(
+            element,
+            type->kind(),
+            type->scalar_type(),
+            value,
+            [&] { return fmt::format("Element {}", index); }
+        );
     };
 
     shader_cursor.def("__setitem__", set_int_field);
@@ -208,42 +325,28 @@ SGL_PY_EXPORT(device_shader_cursor)
 
     auto set_float_field = [](ShaderCursor& self, std::string_view name, nb::float_ value)
     {
-        ref<const TypeReflection> type = self[name].type();
-        SGL_CHECK(type->kind() == TypeReflection::Kind::scalar, "Field \"{}\" is not a scalar type.", name);
-        switch (type->scalar_type()) {
-        case TypeReflection::ScalarType::float16:
-            self[name] = float16_t(nb::cast<float>(value));
-            break;
-        case TypeReflection::ScalarType::float32:
-            self[name] = nb::cast<float>(value);
-            break;
-        case TypeReflection::ScalarType::float64:
-            self[name] = nb::cast<double>(value);
-            break;
-        default:
-            SGL_THROW("Field \"{}\" is not a floating point type.");
-            break;
-        }
+        ShaderCursor field = self[name];
+        ref<const TypeReflection> type = field.type();
+        set_python_float(
+            field,
+            type->kind(),
+            type->scalar_type(),
+            value,
+            [&] { return fmt::format("Field \"{}\"", name); }
+        );
     };
 
     auto set_float_element = [](ShaderCursor& self, int index, nb::float_ value)
     {
-        ref<const TypeReflection> type = self[index].type();
-        SGL_CHECK(type->kind() == TypeReflection::Kind::scalar, "Element {} is not a scalar type.", index);
-        switch (type->scalar_type()) {
-        case TypeReflection::ScalarType::float16:
-            self[index] = float16_t(nb::cast<float>(value));
-            break;
-        case TypeReflection::ScalarType::float32:
-            self[index] = nb::cast<float>(value);
-            break;
-        case TypeReflection::ScalarType::float64:
-            self[index] = nb::cast<double>(value);
-            break;
-        default:
-            SGL_THROW("Element {} is not a floating point type.");
-            break;
-        }
+        ShaderCursor element = self[index];
+        ref<const TypeReflection> type = element.type();
+        set_python_float(
+            element,
+            type->kind(),
+            type->scalar_type(),
+            value,
+            [&] { return fmt::format("Element {}", index); }
+        );
     };
 
     shader_cursor.def("__setitem__", set_float_field);
@@ -252,37 +355,8 @@ SGL_PY_EXPORT(device_shader_cursor)
 
     auto set_numpy_field = [](ShaderCursor& self, std::string_view name, nb::ndarray<nb::numpy> value)
     {
-        ref<const TypeReflection> type = self[name].type();
-        auto src_scalar_type = dtype_to_scalar_type(value.dtype());
-        SGL_CHECK(src_scalar_type, "numpy array has unsupported dtype.");
-        SGL_CHECK(is_ndarray_contiguous(value), "numpy array is not contiguous.");
-
-        switch (type->kind()) {
-        case TypeReflection::Kind::array:
-            SGL_CHECK(value.ndim() == 1, "numpy array must have 1 dimension.");
-            self[name]._set_array(value.data(), value.nbytes(), *src_scalar_type, narrow_cast<int>(value.shape(0)));
-            break;
-        case TypeReflection::Kind::matrix:
-            SGL_CHECK(value.ndim() == 2, "numpy array must have 2 dimensions.");
-            self[name]._set_matrix(
-                value.data(),
-                value.nbytes(),
-                *src_scalar_type,
-                narrow_cast<int>(value.shape(0)),
-                narrow_cast<int>(value.shape(1))
-            );
-            break;
-        case TypeReflection::Kind::vector: {
-            SGL_CHECK(value.ndim() == 1 || value.ndim() == 2, "numpy array must have 1 or 2 dimensions.");
-            size_t dimension = 1;
-            for (size_t i = 0; i < value.ndim(); ++i)
-                dimension *= value.shape(i);
-            self[name]._set_vector(value.data(), value.nbytes(), *src_scalar_type, narrow_cast<int>(dimension));
-            break;
-        }
-        default:
-            SGL_THROW("Field \"{}\" is not a vector, matrix, or array type.", name);
-        }
+        ShaderCursor field = self[name];
+        set_numpy(field, field.type()->kind(), value, [&] { return fmt::format("Field \"{}\"", name); });
     };
 
     shader_cursor.def("__setitem__", set_numpy_field);
@@ -297,4 +371,181 @@ SGL_PY_EXPORT(device_shader_cursor)
     shader_cursor.def("__setitem__", set_cuda_tensor_field);
     shader_cursor.def("__setitem__", set_cuda_tensor_element);
     shader_cursor.def("__setattr__", set_cuda_tensor_field);
+
+    nb::class_<ShaderCursorPath> shader_cursor_path(m, "ShaderCursorPath", D(ShaderCursorPath));
+
+    shader_cursor_path //
+        .def(
+            nb::init<const ShaderCursor&, std::string_view>(),
+            "cursor"_a,
+            "path"_a,
+            D(ShaderCursorPath, ShaderCursorPath, 2)
+        )
+        .def_prop_ro("path", &ShaderCursorPath::path, D(ShaderCursorPath, path))
+        .def_prop_ro("offset", &ShaderCursorPath::offset, D(ShaderCursorPath, offset))
+        .def_prop_ro("object_hop_count", &ShaderCursorPath::object_hop_count, D(ShaderCursorPath, object_hop_count))
+        .def("is_valid", &ShaderCursorPath::is_valid, D(ShaderCursorPath, is_valid))
+        .def("resolve", &ShaderCursorPath::resolve, "shader_object"_a, D(ShaderCursorPath, resolve))
+        .def(
+            "set_object",
+            &ShaderCursorPath::set_object,
+            "shader_object"_a,
+            "object"_a,
+            D(ShaderCursorPath, set_object)
+        )
+        .def(
+            "set_resource",
+            &ShaderCursorPath::set_resource,
+            "shader_object"_a,
+            "resource_view"_a,
+            D(ShaderCursorPath, set_resource)
+        )
+        .def(
+            "set_buffer",
+            &ShaderCursorPath::set_buffer,
+            "shader_object"_a,
+            "buffer"_a,
+            D(ShaderCursorPath, set_buffer)
+        )
+        .def(
+            "set_texture",
+            &ShaderCursorPath::set_texture,
+            "shader_object"_a,
+            "texture"_a,
+            D(ShaderCursorPath, set_texture)
+        )
+        .def(
+            "set_sampler",
+            &ShaderCursorPath::set_sampler,
+            "shader_object"_a,
+            "sampler"_a,
+            D(ShaderCursorPath, set_sampler)
+        )
+        .def(
+            "set_acceleration_structure",
+            &ShaderCursorPath::set_acceleration_structure,
+            "shader_object"_a,
+            "acceleration_structure"_a,
+            D(ShaderCursorPath, set_acceleration_structure)
+        )
+        .def(
+            "set_data",
+            [](ShaderCursorPath& self, ShaderObject* shader_object, nb::ndarray<nb::device::cpu> data)
+            {
+                SGL_CHECK(is_ndarray_contiguous(data), "data is not contiguous");
+                self.set_data(shader_object, data.data(), data.nbytes());
+            },
+            "shader_object"_a,
+            "data"_a,
+            D(ShaderCursorPath, set_data)
+        )
+        .def("__repr__", &ShaderCursorPath::to_string);
+
+#define def_path_setter(type)                                                                                          \
+    shader_cursor_path.def(                                                                                            \
+        "set",                                                                                                         \
+        [](ShaderCursorPath& self, ShaderObject* shader_object, type value) { self.set(shader_object, value); },       \
+        "shader_object"_a,                                                                                             \
+        "value"_a,                                                                                                     \
+        D(ShaderCursorPath, set)                                                                                       \
+    );
+
+    def_path_setter(ref<MutableShaderObject>);
+    def_path_setter(ref<ResourceView>);
+    def_path_setter(ref<Buffer>);
+    def_path_setter(ref<Texture>);
+    def_path_setter(ref<Sampler>);
+    def_path_setter(ref<AccelerationStructure>);
+
+    def_path_setter(bool);
+    def_path_setter(bool2);
+    def_path_setter(bool3);
+    def_path_setter(bool4);
+
+    def_path_setter(uint2);
+    def_path_setter(uint3);
+    def_path_setter(uint4);
+
+    def_path_setter(int2);
+    def_path_setter(int3);
+    def_path_setter(int4);
+
+    def_path_setter(float2);
+    def_path_setter(float3);
+    def_path_setter(float4);
+
+    def_path_setter(float2x2);
+    def_path_setter(float3x3);
+    def_path_setter(float2x4);
+    def_path_setter(float3x4);
+    def_path_setter(float4x4);
+
+    def_path_setter(float16_t2);
+    def_path_setter(float16_t3);
+    def_path_setter(float16_t4);
+
+#undef def_path_setter
+
+    // Python integers, floats and numpy arrays are converted using the type information cached in the path.
+
+    shader_cursor_path.def(
+        "set",
+        [](ShaderCursorPath& self, ShaderObject* shader_object, nb::int_ value)
+        {
+            const ShaderCursorPath::TypeInfo& type_info = self.type_info();
+            set_python_int(
+                ShaderCursorPathTarget{self, shader_object},
+                type_info.element_kind,
+                type_info.scalar_type,
+                value,
+                [&] { return fmt::format("Path \"{}\"", self.path()); }
+            );
+        },
+        "shader_object"_a,
+        "value"_a,
+        D(ShaderCursorPath, set)
+    );
+
+    shader_cursor_path.def(
+        "set",
+        [](ShaderCursorPath& self, ShaderObject* shader_object, nb::float_ value)
+        {
+            const ShaderCursorPath::TypeInfo& type_info = self.type_info();
+            set_python_float(
+                ShaderCursorPathTarget{self, shader_object},
+                type_info.element_kind,
+                type_info.scalar_type,
+                value,
+                [&] { return fmt::format("Path \"{}\"", self.path()); }
+            );
+        },
+        "shader_object"_a,
+        "value"_a,
+        D(ShaderCursorPath, set)
+    );
+
+    shader_cursor_path.def(
+        "set",
+        [](ShaderCursorPath& self, ShaderObject* shader_object, nb::ndarray<nb::numpy> value)
+        {
+            set_numpy(
+                ShaderCursorPathTarget{self, shader_object},
+                self.type_info().kind,
+                value,
+                [&] { return fmt::format("Path \"{}\"", self.path()); }
+            );
+        },
+        "shader_object"_a,
+        "value"_a,
+        D(ShaderCursorPath, set)
+    );
+
+    shader_cursor_path.def(
+        "set",
+        [](ShaderCursorPath& self, ShaderObject* shader_object, nb::ndarray<nb::device::cuda> ndarray)
+        { self.set_cuda_tensor_view(shader_object, ndarray_to_cuda_tensor_view(ndarray)); },
+        "shader_object"_a,
+        "value"_a,
+        D(ShaderCursorPath, set)
+    );
 }
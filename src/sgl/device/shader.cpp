@@ -18,9 +18,11 @@
 #include "sgl/core/crypto.h"
 #include "sgl/core/timer.h"
 #include "sgl/core/file_stream.h"
+#include "sgl/core/thread.h"
 
 #include <slang.h>
 
+#include <atomic>
 #include <random>
 
 namespace sgl {
@@ -195,6 +197,8 @@ void SlangSession::recreate_session()
 {
     SGL_CHECK_NOT_NULL(m_device);
 
+    std::lock_guard lock(m_mutex);
+
     SlangSessionBuild build;
 
     // Build everything first.
@@ -219,6 +223,72 @@ void SlangSession::recreate_session()
     update_module_cache_and_dependencies();
 }
 
+bool SlangSession::recreate_session(const std::set<std::filesystem::path>& changed_files)
+{
+    SGL_CHECK_NOT_NULL(m_device);
+
+    std::lock_guard lock(m_mutex);
+
+    // Find modules that depend on any of the changed files.
+    std::set<const SlangModule*> affected_modules;
+    for (auto module : m_registered_modules) {
+        for (const auto& path : module->_data()->dependencies) {
+            if (changed_files.contains(path)) {
+                affected_modules.insert(module);
+                break;
+            }
+        }
+    }
+    if (affected_modules.empty())
+        return false;
+
+    // Find programs that are composed from any of the affected modules.
+    std::vector<ShaderProgram*> affected_programs;
+    for (auto program : m_registered_programs) {
+        bool affected = false;
+        for (const auto& module : program->desc().modules)
+            affected |= affected_modules.contains(module.get());
+        for (const auto& entry_point : program->desc().entry_points)
+            affected |= affected_modules.contains(entry_point->module());
+        if (affected)
+            affected_programs.push_back(program);
+    }
+
+    Timer timer;
+    SlangSessionBuild build;
+
+    // Build everything first. Modules can only be loaded into a new session,
+    // but linking (and recreating pipelines) is limited to the affected programs.
+    create_session(build);
+    for (auto module : m_registered_modules) {
+        module->load(build);
+    }
+    for (auto program : affected_programs) {
+        program->link(build);
+    }
+
+    // On success, store it all.
+    m_data = build.session;
+    for (auto module : m_registered_modules) {
+        module->store_built_data(build);
+    }
+    for (auto program : affected_programs) {
+        program->store_built_data(build);
+    }
+
+    // Update cache of loaded modules.
+    update_module_cache_and_dependencies();
+
+    log_debug(
+        "Recreating slang session relinked {} of {} programs and took {}",
+        affected_programs.size(),
+        m_registered_programs.size(),
+        string::format_duration(timer.elapsed_s())
+    );
+
+    return true;
+}
+
 void SlangSession::create_session(SlangSessionBuild& build)
 {
     SGL_CHECK_NOT_NULL(m_device);
@@ -413,6 +483,10 @@ void SlangSession::create_session(SlangSessionBuild& build)
         session_desc.compilerOptionEntryCount = narrow_cast<uint32_t>(slang_session_option_entries.size());
     }
 
+    // Load source files through the hot reload system, which records the contents modules are compiled from.
+    if (m_device->_hot_reload())
+        session_desc.fileSystem = m_device->_hot_reload()->_file_system();
+
     SLANG_CALL(m_device->global_session()->createSession(session_desc, data->slang_session.writeRef()));
 
     // Store session.
@@ -421,6 +495,8 @@ void SlangSession::create_session(SlangSessionBuild& build)
 
 ref<SlangModule> SlangSession::load_module(std::string_view module_name)
 {
+    std::lock_guard lock(m_mutex);
+
     SlangModuleDesc desc;
     desc.module_name = module_name;
 
@@ -444,6 +520,8 @@ ref<SlangModule> SlangSession::load_module_from_source(
     std::optional<std::filesystem::path> path
 )
 {
+    std::lock_guard lock(m_mutex);
+
     SlangModuleDesc desc;
     desc.module_name = module_name;
     desc.source = source;
@@ -469,6 +547,8 @@ ref<ShaderProgram> SlangSession::link_program(
     std::optional<SlangLinkOptions> link_options
 )
 {
+    std::lock_guard lock(m_mutex);
+
     for (const auto& module : modules)
         SGL_CHECK(module->session() == this, "All modules must belong to this session.");
     for (const auto& entry_point : entry_points)
@@ -509,6 +589,8 @@ ref<ShaderProgram> SlangSession::load_program(
     std::optional<SlangLinkOptions> link_options
 )
 {
+    std::lock_guard lock(m_mutex);
+
     ref<SlangModule> module = load_module(module_name);
     std::vector<ref<SlangModule>> modules{module};
     // TODO improve the way we generate unique names for additional sources
@@ -518,7 +600,53 @@ ref<ShaderProgram> SlangSession::load_program(
     std::vector<ref<SlangEntryPoint>> entry_points;
     for (const auto& entry_point_name : entry_point_names)
         entry_points.push_back(module->entry_point(entry_point_name));
-    return link_program(std::move(modules), std::move(entry_points), link_options);
+    ref<ShaderProgram> program = link_program(std::move(modules), std::move(entry_points), link_options);
+
+    program->_set_load_desc({
+        .module_name = std::string{module_name},
+        .entry_point_names = {entry_point_names.begin(), entry_point_names.end()},
+        .additional_source = additional_source ? std::optional<std::string>(*additional_source) : std::nullopt,
+        .link_options = link_options,
+    });
+
+    return program;
+}
+
+std::future<ref<SlangModule>> SlangSession::load_module_async(std::string_view module_name)
+{
+    return thread::do_async([self = ref(this), module_name = std::string(module_name)]()
+                            { return self->load_module(module_name); });
+}
+
+std::future<ref<ShaderProgram>> SlangSession::link_program_async(
+    std::vector<ref<SlangModule>> modules,
+    std::vector<ref<SlangEntryPoint>> entry_points,
+    std::optional<SlangLinkOptions> link_options
+)
+{
+    return thread::do_async(
+        [self = ref(this),
+         modules = std::move(modules),
+         entry_points = std::move(entry_points),
+         link_options = std::move(link_options)]() mutable
+        { return self->link_program(std::move(modules), std::move(entry_points), link_options); }
+    );
+}
+
+static ref<ShaderProgram> load_program_from_desc(SlangSession* session, const ShaderProgramLoadDesc& desc)
+{
+    std::vector<std::string_view> entry_point_names(desc.entry_point_names.begin(), desc.entry_point_names.end());
+    std::optional<std::string_view> additional_source;
+    if (desc.additional_source)
+        additional_source = *desc.additional_source;
+    return session->load_program(desc.module_name, std::move(entry_point_names), additional_source, desc.link_options);
+}
+
+std::future<ref<ShaderProgram>> SlangSession::load_program_async(ShaderProgramLoadDesc desc)
+{
+    return thread::do_async(
+        [self = ref(this), desc = std::move(desc)]() { return load_program_from_desc(self, desc); }
+    );
 }
 
 std::string SlangSession::load_source(std::string_view module_name)
@@ -540,16 +668,19 @@ std::string SlangSession::load_source(std::string_view module_name)
 
 void SlangSession::_register_program(ShaderProgram* program)
 {
+    std::lock_guard lock(m_mutex);
     m_registered_programs.insert(program);
 }
 
 void SlangSession::_unregister_program(ShaderProgram* program)
 {
+    std::lock_guard lock(m_mutex);
     m_registered_programs.erase(program);
 }
 
 void SlangSession::_register_module(SlangModule* module)
 {
+    std::lock_guard lock(m_mutex);
     auto existing = std::find(m_registered_modules.begin(), m_registered_modules.end(), module);
     if (existing == m_registered_modules.end())
         m_registered_modules.push_back(module);
@@ -557,6 +688,7 @@ void SlangSession::_register_module(SlangModule* module)
 
 void SlangSession::_unregister_module(SlangModule* module)
 {
+    std::lock_guard lock(m_mutex);
     auto existing = std::find(m_registered_modules.begin(), m_registered_modules.end(), module);
     if (existing != m_registered_modules.end())
         m_registered_modules.erase(existing);
@@ -757,6 +889,16 @@ void SlangModule::load(SlangSessionBuild& build_data) const
     data->name = slang_module->getName();
     data->path = slang_module->getFilePath() ? slang_module->getFilePath() : "";
 
+    // Store dependencies, used by hot reload to find affected programs.
+    for (SlangInt32 i = 0; i < slang_module->getDependencyFileCount(); ++i) {
+        const char* dependency = slang_module->getDependencyFilePath(i);
+        if (!dependency)
+            continue;
+        std::filesystem::path path = dependency;
+        if (path.is_absolute())
+            data->dependencies.push_back(path.lexically_normal().make_preferred());
+    }
+
     // Output the built module.
     build_data.modules[this] = std::move(data);
 
@@ -782,6 +924,8 @@ void SlangModule::populate_build_data(SlangSessionBuild& build_data)
 
 std::vector<ref<SlangEntryPoint>> SlangModule::entry_points() const
 {
+    std::lock_guard lock(m_session->_mutex());
+
     std::vector<ref<SlangEntryPoint>> entry_points;
     for (SlangInt32 i = 0; i < m_data->slang_module->getDefinedEntryPointCount(); ++i) {
         Slang::ComPtr<slang::IEntryPoint> slang_entry_point;
@@ -797,6 +941,8 @@ std::vector<ref<SlangEntryPoint>> SlangModule::entry_points() const
 
 ref<SlangEntryPoint> SlangModule::entry_point(std::string_view name, std::span<TypeConformance> type_conformances) const
 {
+    std::lock_guard lock(m_session->_mutex());
+
     SlangEntryPointDesc desc;
     desc.name = name;
     desc.type_conformances.assign(type_conformances.begin(), type_conformances.end());
@@ -827,11 +973,13 @@ ref<const DeclReflection> SlangModule::module_decl() const
 
 void SlangModule::_register_entry_point(SlangEntryPoint* entry_point) const
 {
+    std::lock_guard lock(m_session->_mutex());
     m_registered_entry_points.insert(entry_point);
 }
 
 void SlangModule::_unregister_entry_point(SlangEntryPoint* entry_point) const
 {
+    std::lock_guard lock(m_session->_mutex());
     m_registered_entry_points.erase(entry_point);
 }
 
@@ -1136,6 +1284,29 @@ void ShaderProgram::link(SlangSessionBuild& build_data) const
         report_diagnostics(diagnostics);
     }
 
+    // Compute hash identifying the generated code. Slang's entry point hashes cover the
+    // sources and compiler options, link options and session are added for robustness.
+    SHA1 hash;
+    hash.update(build_data.session->uid);
+    for (SlangInt i = 0; i < narrow_cast<SlangInt>(desc.entry_points.size()); ++i) {
+        Slang::ComPtr<ISlangBlob> entry_point_hash;
+        linked_program->getEntryPointHash(i, 0, entry_point_hash.writeRef());
+        if (entry_point_hash)
+            hash.update(entry_point_hash->getBufferPointer(), entry_point_hash->getBufferSize());
+    }
+    if (desc.link_options) {
+        const SlangLinkOptions& link_options = desc.link_options.value();
+        hash.update(uint8_t(link_options.floating_point_mode.has_value()));
+        hash.update(link_options.floating_point_mode.value_or(SlangFloatingPointMode::default_));
+        hash.update(uint8_t(link_options.debug_info.has_value()));
+        hash.update(link_options.debug_info.value_or(SlangDebugInfoLevel::none));
+        hash.update(uint8_t(link_options.optimization.has_value()));
+        hash.update(link_options.optimization.value_or(SlangOptimizationLevel::none));
+        for (const auto& arg : link_options.downstream_args.value_or(std::vector<std::string>{}))
+            hash.update(arg).update(uint8_t(0));
+        hash.update(uint8_t(link_options.dump_intermediates.value_or(false)));
+    }
+
     // Report link time.
     std::string name;
     for (const auto& entry_point : desc.entry_points) {
@@ -1148,8 +1319,10 @@ void ShaderProgram::link(SlangSessionBuild& build_data) const
     auto data = make_ref<ShaderProgramData>();
 
     // Store program info.
+    data->session = build_data.session;
     data->linked_program = linked_program;
     data->gfx_shader_program = gfx_shader_program;
+    data->hash = hash.hex_digest();
 
     // Store resulting program.
     build_data.programs[this] = std::move(data);
@@ -1159,6 +1332,9 @@ void ShaderProgram::store_built_data(SlangSessionBuild& build_data)
 {
     // Store built program data
     m_data = build_data.programs[this];
+    // Generations are drawn from a global counter, so a generation also identifies the program.
+    static std::atomic<uint64_t> s_generation{0};
+    m_generation = ++s_generation;
 
     // Notify all registered pipelines that this program has rebuilt.
     for (auto pipeline : m_registered_pipelines)
@@ -1167,11 +1343,13 @@ void ShaderProgram::store_built_data(SlangSessionBuild& build_data)
 
 void ShaderProgram::_register_pipeline(Pipeline* pipeline)
 {
+    std::lock_guard lock(m_session->_mutex());
     m_registered_pipelines.insert(pipeline);
 }
 
 void ShaderProgram::_unregister_pipeline(Pipeline* pipeline)
 {
+    std::lock_guard lock(m_session->_mutex());
     m_registered_pipelines.erase(pipeline);
 }
 
@@ -11,8 +11,11 @@
 #include "sgl/core/enum.h"
 
 #include <exception>
+#include <future>
 #include <map>
+#include <mutex>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -260,7 +263,25 @@ struct SlangSessionData : Object {
     std::string resolve_module_name(std::string_view module_name) const;
 };
 
-/// A slang session, used to load modules and link programs.
+/// Description of a program to load (see \ref SlangSession::load_program for details).
+struct ShaderProgramLoadDesc {
+    /// Name of the module containing the entry points.
+    std::string module_name;
+    /// Names of the entry points.
+    std::vector<std::string> entry_point_names;
+    /// Optional additional source code that is compiled into a separate module.
+    std::optional<std::string> additional_source;
+    /// Optional link options.
+    std::optional<SlangLinkOptions> link_options;
+};
+
+/**
+ * A slang session, used to load modules and link programs.
+ *
+ * Slang sessions are not thread-safe. All calls into the underlying slang session are
+ * serialized using a per-session mutex, so modules and programs can be loaded from
+ * multiple threads (see the \c _async variants), but are never compiled concurrently.
+ */
 class SGL_API SlangSession : public Object {
     SGL_OBJECT(SlangSession)
 public:
@@ -270,6 +291,18 @@ public:
     /// Fully recreates this session and any loaded modules or linked programs.
     void recreate_session();
 
+    /**
+     * \brief Recreates this session, only relinking programs that depend on changed files.
+     *
+     * Slang sessions cannot unload modules, so all modules are reloaded into a new session.
+     * However, only programs using a module that depends on any of the changed files are
+     * relinked (and their pipelines recreated). All other programs keep their existing data.
+     *
+     * \param changed_files Absolute, lexically normalized paths of the changed files.
+     * \return False if no module depends on the changed files (the session is left untouched).
+     */
+    bool recreate_session(const std::set<std::filesystem::path>& changed_files);
+
     Device* device() const { return m_device; }
     const SlangSessionDesc& desc() const { return m_desc; }
 
@@ -300,6 +333,19 @@ public:
         std::optional<SlangLinkOptions> link_options = {}
     );
 
+    /// Load a module by name on the global thread pool.
+    std::future<ref<SlangModule>> load_module_async(std::string_view module_name);
+
+    /// Link a program on the global thread pool.
+    std::future<ref<ShaderProgram>> link_program_async(
+        std::vector<ref<SlangModule>> modules,
+        std::vector<ref<SlangEntryPoint>> entry_points,
+        std::optional<SlangLinkOptions> link_options = {}
+    );
+
+    /// Load a program on the global thread pool.
+    std::future<ref<ShaderProgram>> load_program_async(ShaderProgramLoadDesc desc);
+
     /// Load the source code for a given module.
     std::string load_source(std::string_view module_name);
 
@@ -316,6 +362,9 @@ public:
     // Internal access to the built session data.
     ref<SlangSessionData> _data() { return m_data; }
 
+    /// Internal mutex serializing access to the slang session.
+    std::recursive_mutex& _mutex() const { return m_mutex; }
+
 private:
     ref<Device> m_device;
 
@@ -335,6 +384,8 @@ private:
     /// All created sgl programs (via link_program)
     std::set<ShaderProgram*> m_registered_programs;
 
+    mutable std::recursive_mutex m_mutex;
+
     void update_module_cache_and_dependencies();
     bool write_module_to_cache(slang::IModule* module);
     void create_session(SlangSessionBuild& build);
@@ -355,6 +406,8 @@ struct SlangModuleData : Object {
     slang::IModule* slang_module = nullptr;
     std::string name;
     std::filesystem::path path;
+    /// Absolute paths of all files the module depends on (including transitive imports).
+    std::vector<std::filesystem::path> dependencies;
 };
 
 class SGL_API SlangModule : public Object {
@@ -475,8 +528,12 @@ struct ShaderProgramDesc {
     std::optional<SlangLinkOptions> link_options;
 };
 struct ShaderProgramData : Object {
+    /// Session the program was linked in, kept alive as programs are not always relinked on hot reload.
+    ref<SlangSessionData> session;
     Slang::ComPtr<slang::IComponentType> linked_program;
     Slang::ComPtr<gfx::IShaderProgram> gfx_shader_program;
+    /// Hash identifying the generated code (used as pipeline cache key).
+    std::string hash;
 };
 class SGL_API ShaderProgram : public DeviceResource {
     SGL_OBJECT(ShaderProgram)
@@ -490,8 +547,19 @@ public:
     /// Finds this program in current build and updates internal m_data to point at it.
     void store_built_data(SlangSessionBuild& build);
 
+    /// The session from which this program was linked.
+    SlangSession* session() const { return m_session; }
+
     const ShaderProgramDesc& desc() const { return m_desc; }
 
+    /// Description used to load the program.
+    /// Only available for programs created with \ref SlangSession::load_program.
+    const std::optional<ShaderProgramLoadDesc>& load_desc() const { return m_load_desc; }
+
+    /// Hash identifying the generated code of the linked program.
+    /// Programs linked from the same sources with the same options have the same hash.
+    const std::string& hash() const { return m_data->hash; }
+
     ref<const ProgramLayout> layout() const
     {
         return ProgramLayout::from_slang(ref(this), m_data->linked_program->getLayout());
@@ -501,15 +569,23 @@ public:
 
     gfx::IShaderProgram* gfx_shader_program() const { return m_data->gfx_shader_program; }
 
+    /// Generation of the linked program, updated each time the program is (re)linked (i.e. after a hot reload).
+    /// Generations are unique across all programs. Objects derived from the program layout can compare the
+    /// generation to detect a reload.
+    uint64_t generation() const { return m_generation; }
+
     virtual std::string to_string() const override;
 
     void _register_pipeline(Pipeline* pipeline);
     void _unregister_pipeline(Pipeline* pipeline);
+    void _set_load_desc(ShaderProgramLoadDesc load_desc) { m_load_desc = std::move(load_desc); }
 
 private:
     ref<SlangSession> m_session;
     ShaderProgramDesc m_desc;
+    std::optional<ShaderProgramLoadDesc> m_load_desc;
     ref<ShaderProgramData> m_data;
+    uint64_t m_generation{0};
     std::set<Pipeline*> m_registered_pipelines;
 };
 
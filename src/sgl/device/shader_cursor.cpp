@@ -11,6 +11,9 @@
 #include "sgl/math/vector_types.h"
 #include "sgl/math/matrix_types.h"
 
+#include <algorithm>
+#include <charconv>
+
 namespace sgl {
 
 // Helper class for checking if implicit conversion between scalar types is allowed.
@@ -388,50 +391,233 @@ inline bool is_acceleration_structure_resource_type(const TypeReflection* type)
         && type->resource_shape() == TypeReflection::ResourceShape::acceleration_structure;
 }
 
-void ShaderCursor::set_resource(const ref<ResourceView>& resource_view) const
+// Validation and write helpers shared by ShaderCursor and ShaderCursorPath.
+// The cursor passes type information from the reflection data, the path passes its cached TypeInfo.
+
+inline void check_resource_view(
+    const char* name,
+    bool is_shader_resource,
+    bool is_unordered_access,
+    const ResourceView* resource_view
+)
 {
-    ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
+    if (!resource_view)
+        return;
+    if (is_shader_resource) {
+        SGL_CHECK(
+            resource_view->type() == ResourceViewType::shader_resource,
+            "\"{}\" expects a shader resource view",
+            name
+        );
+    } else if (is_unordered_access) {
+        SGL_CHECK(
+            resource_view->type() == ResourceViewType::unordered_access,
+            "\"{}\" expects an unordered access view",
+            name
+        );
+    } else {
+        SGL_THROW("\"{}\" expects a valid resource view", name);
+    }
+}
 
-    SGL_CHECK(is_resource_type(type), "\"{}\" cannot bind a resource", m_type_layout->name());
+/// Get the view of a buffer or texture matching the access of the bound variable.
+template<typename T, typename Range>
+inline ref<ResourceView> get_resource_view(
+    const char* name,
+    const char* resource_name,
+    bool is_shader_resource,
+    bool is_unordered_access,
+    const ref<T>& resource,
+    const Range& range
+)
+{
+    if (!resource)
+        return nullptr;
+    if (is_shader_resource)
+        return resource->get_srv(range);
+    if (is_unordered_access)
+        return resource->get_uav(range);
+    SGL_THROW("\"{}\" expects a valid {}", name, resource_name);
+}
 
-    if (resource_view) {
-        if (is_shader_resource_type(type)) {
-            SGL_CHECK(
-                resource_view->type() == ResourceViewType::shader_resource,
-                "\"{}\" expects a shader resource view",
-                m_type_layout->name()
-            );
-        } else if (is_unordered_access_type(type)) {
-            SGL_CHECK(
-                resource_view->type() == ResourceViewType::unordered_access,
-                "\"{}\" expects an unordered access view",
-                m_type_layout->name()
-            );
-        } else {
-            SGL_THROW("\"{}\" expects a valid resource view", m_type_layout->name());
+/// Returns true if a CUDA tensor view is bound as an unordered access view.
+inline bool is_cuda_tensor_view_uav(const char* name, bool is_shader_resource, bool is_unordered_access)
+{
+    if (is_shader_resource)
+        return false;
+    if (is_unordered_access)
+        return true;
+    SGL_THROW("\"{}\" expects a valid buffer", name);
+}
+
+inline void check_array(
+    const char* name,
+    bool is_array,
+    size_t max_element_count,
+    TypeReflection::ScalarType expected_scalar_type,
+    TypeReflection::ScalarType scalar_type,
+    size_t element_count
+)
+{
+    SGL_CHECK(is_array, "\"{}\" cannot bind an array", name);
+    SGL_CHECK(
+        allow_scalar_conversion(scalar_type, expected_scalar_type),
+        "\"{}\" expects scalar type {} (no implicit conversion from type {})",
+        name,
+        expected_scalar_type,
+        scalar_type
+    );
+    SGL_CHECK(
+        element_count <= max_element_count,
+        "\"{}\" expects an array with at most {} elements (got {})",
+        name,
+        max_element_count,
+        element_count
+    );
+}
+
+inline void check_scalar(
+    const char* name,
+    TypeReflection::Kind kind,
+    TypeReflection::ScalarType expected_scalar_type,
+    TypeReflection::ScalarType scalar_type
+)
+{
+    SGL_CHECK(kind == TypeReflection::Kind::scalar, "\"{}\" cannot bind a scalar value", name);
+    SGL_CHECK(
+        allow_scalar_conversion(scalar_type, expected_scalar_type),
+        "\"{}\" expects scalar type {} (no implicit conversion from type {})",
+        name,
+        expected_scalar_type,
+        scalar_type
+    );
+}
+
+inline void check_vector(
+    const char* name,
+    TypeReflection::Kind kind,
+    uint32_t col_count,
+    TypeReflection::ScalarType expected_scalar_type,
+    TypeReflection::ScalarType scalar_type,
+    int dimension
+)
+{
+    SGL_CHECK(kind == TypeReflection::Kind::vector, "\"{}\" cannot bind a vector value", name);
+    SGL_CHECK(
+        col_count == uint32_t(dimension),
+        "\"{}\" expects a vector with dimension {} (got dimension {})",
+        name,
+        col_count,
+        dimension
+    );
+    SGL_CHECK(
+        allow_scalar_conversion(scalar_type, expected_scalar_type),
+        "\"{}\" expects a vector with scalar type {} (no implicit conversion from type {})",
+        name,
+        expected_scalar_type,
+        scalar_type
+    );
+}
+
+inline void check_matrix(
+    const char* name,
+    TypeReflection::Kind kind,
+    uint32_t row_count,
+    uint32_t col_count,
+    TypeReflection::ScalarType expected_scalar_type,
+    TypeReflection::ScalarType scalar_type,
+    int rows,
+    int cols
+)
+{
+    SGL_CHECK(kind == TypeReflection::Kind::matrix, "\"{}\" cannot bind a matrix value", name);
+    SGL_CHECK(
+        row_count == uint32_t(rows) && col_count == uint32_t(cols),
+        "\"{}\" expects a matrix with dimension {}x{} (got dimension {}x{})",
+        name,
+        row_count,
+        col_count,
+        rows,
+        cols
+    );
+    SGL_CHECK(
+        allow_scalar_conversion(scalar_type, expected_scalar_type),
+        "\"{}\" expects a matrix with scalar type {} (no implicit conversion from type {})",
+        name,
+        expected_scalar_type,
+        scalar_type
+    );
+}
+
+inline void write_array(
+    ShaderObject* shader_object,
+    ShaderOffset offset,
+    const void* data,
+    size_t size,
+    size_t element_size,
+    size_t element_count,
+    size_t stride
+)
+{
+    SGL_ASSERT(element_count * element_size == size);
+    if (element_size == stride) {
+        shader_object->set_data(offset, data, size);
+    } else {
+        for (size_t i = 0; i < element_count; ++i) {
+            shader_object->set_data(offset, reinterpret_cast<const uint8_t*>(data) + i * element_size, element_size);
+            offset.uniform_offset += narrow_cast<uint32_t>(stride);
         }
     }
+}
+
+inline void write_matrix(ShaderObject* shader_object, ShaderOffset offset, const void* data, size_t size, int rows)
+{
+    if (rows > 1) {
+        // each row is aligned to 16 bytes
+        size_t row_size = size / rows;
+        for (int row = 0; row < rows; ++row) {
+            shader_object->set_data(offset, reinterpret_cast<const uint8_t*>(data) + row * row_size, row_size);
+            offset.uniform_offset += 16;
+        }
+    } else {
+        shader_object->set_data(offset, data, size);
+    }
+}
+
+void ShaderCursor::set_resource(const ref<ResourceView>& resource_view) const
+{
+    ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
+
+    SGL_CHECK(is_resource_type(type), "\"{}\" cannot bind a resource", m_type_layout->name());
+    check_resource_view(
+        m_type_layout->name(),
+        is_shader_resource_type(type),
+        is_unordered_access_type(type),
+        resource_view
+    );
 
     m_shader_object->set_resource(m_offset, resource_view);
 }
 
 void ShaderCursor::set_buffer(const ref<Buffer>& buffer) const
+{
+    set_buffer(buffer, BufferRange());
+}
+
+void ShaderCursor::set_buffer(const ref<Buffer>& buffer, const BufferRange& range) const
 {
     ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
 
     SGL_CHECK(is_buffer_resource_type(type), "\"{}\" cannot bind a buffer", m_type_layout->name());
 
-    if (buffer) {
-        if (is_shader_resource_type(type)) {
-            set_resource(buffer->get_srv());
-        } else if (is_unordered_access_type(type)) {
-            set_resource(buffer->get_uav());
-        } else {
-            SGL_THROW("\"{}\" expects a valid buffer", m_type_layout->name());
-        }
-    } else {
-        set_resource(nullptr);
-    }
+    set_resource(get_resource_view(
+        m_type_layout->name(),
+        "buffer",
+        is_shader_resource_type(type),
+        is_unordered_access_type(type),
+        buffer,
+        range
+    ));
 }
 
 void ShaderCursor::set_texture(const ref<Texture>& texture) const
@@ -440,17 +626,14 @@ void ShaderCursor::set_texture(const ref<Texture>& texture) const
 
     SGL_CHECK(is_texture_resource_type(type), "\"{}\" cannot bind a texture", m_type_layout->name());
 
-    if (texture) {
-        if (is_shader_resource_type(type)) {
-            set_resource(texture->get_srv());
-        } else if (is_unordered_access_type(type)) {
-            set_resource(texture->get_uav());
-        } else {
-            SGL_THROW("\"{}\" expects a valid texture", m_type_layout->name());
-        }
-    } else {
-        set_resource(nullptr);
-    }
+    set_resource(get_resource_view(
+        m_type_layout->name(),
+        "texture",
+        is_shader_resource_type(type),
+        is_unordered_access_type(type),
+        texture,
+        SubresourceRange()
+    ));
 }
 
 void ShaderCursor::set_sampler(const ref<Sampler>& sampler) const
@@ -497,13 +680,9 @@ void ShaderCursor::set_cuda_tensor_view(const cuda::TensorView& tensor_view) con
 
     SGL_CHECK(is_buffer_resource_type(type), "\"{}\" cannot bind a CUDA tensor view", m_type_layout->name());
 
-    if (is_shader_resource_type(type)) {
-        m_shader_object->set_cuda_tensor_view(m_offset, tensor_view, false);
-    } else if (is_unordered_access_type(type)) {
-        m_shader_object->set_cuda_tensor_view(m_offset, tensor_view, true);
-    } else {
-        SGL_THROW("\"{}\" expects a valid buffer", m_type_layout->name());
-    }
+    bool is_uav
+        = is_cuda_tensor_view_uav(m_type_layout->name(), is_shader_resource_type(type), is_unordered_access_type(type));
+    m_shader_object->set_cuda_tensor_view(m_offset, tensor_view, is_uav);
 }
 
 void ShaderCursor::_set_array(
@@ -515,49 +694,32 @@ void ShaderCursor::_set_array(
 {
     ref<const TypeReflection> type = m_type_layout->type();
     ref<const TypeReflection> element_type = m_type_layout->unwrap_array()->type();
-    size_t element_size = get_scalar_type_size(element_type->scalar_type());
 
-    SGL_CHECK(type->is_array(), "\"{}\" cannot bind an array", m_type_layout->name());
-    SGL_CHECK(
-        allow_scalar_conversion(scalar_type, element_type->scalar_type()),
-        "\"{}\" expects scalar type {} (no implicit conversion from type {})",
-        m_type_layout->name(),
-        element_type->scalar_type(),
-        scalar_type
-    );
-    SGL_CHECK(
-        element_count <= type->element_count(),
-        "\"{}\" expects an array with at most {} elements (got {})",
+    check_array(
         m_type_layout->name(),
+        type->is_array(),
         type->element_count(),
+        element_type->scalar_type(),
+        scalar_type,
         element_count
     );
-    SGL_ASSERT(element_count * element_size == size);
 
-    size_t stride = m_type_layout->element_stride();
-    if (element_size == stride) {
-        m_shader_object->set_data(m_offset, data, size);
-    } else {
-        ShaderOffset offset = m_offset;
-        for (size_t i = 0; i < element_count; ++i) {
-            m_shader_object->set_data(offset, reinterpret_cast<const uint8_t*>(data) + i * element_size, element_size);
-            offset.uniform_offset += narrow_cast<uint32_t>(stride);
-        }
-    }
+    write_array(
+        m_shader_object,
+        m_offset,
+        data,
+        size,
+        get_scalar_type_size(element_type->scalar_type()),
+        element_count,
+        m_type_layout->element_stride()
+    );
 }
 
 void ShaderCursor::_set_scalar(const void* data, size_t size, TypeReflection::ScalarType scalar_type) const
 {
     ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
 
-    SGL_CHECK(type->kind() == TypeReflection::Kind::scalar, "\"{}\" cannot bind a scalar value", m_type_layout->name());
-    SGL_CHECK(
-        allow_scalar_conversion(scalar_type, type->scalar_type()),
-        "\"{}\" expects scalar type {} (no implicit conversion from type {})",
-        m_type_layout->name(),
-        type->scalar_type(),
-        scalar_type
-    );
+    check_scalar(m_type_layout->name(), type->kind(), type->scalar_type(), scalar_type);
 
     m_shader_object->set_data(m_offset, data, size);
 }
@@ -567,21 +729,7 @@ void ShaderCursor::_set_vector(const void* data, size_t size, TypeReflection::Sc
 {
     ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
 
-    SGL_CHECK(type->kind() == TypeReflection::Kind::vector, "\"{}\" cannot bind a vector value", m_type_layout->name());
-    SGL_CHECK(
-        type->col_count() == uint32_t(dimension),
-        "\"{}\" expects a vector with dimension {} (got dimension {})",
-        m_type_layout->name(),
-        type->col_count(),
-        dimension
-    );
-    SGL_CHECK(
-        allow_scalar_conversion(scalar_type, type->scalar_type()),
-        "\"{}\" expects a vector with scalar type {} (no implicit conversion from type {})",
-        m_type_layout->name(),
-        type->scalar_type(),
-        scalar_type
-    );
+    check_vector(m_type_layout->name(), type->kind(), type->col_count(), type->scalar_type(), scalar_type, dimension);
 
     m_shader_object->set_data(m_offset, data, size);
 }
@@ -596,35 +744,18 @@ void ShaderCursor::_set_matrix(
 {
     ref<const TypeReflection> type = m_type_layout->unwrap_array()->type();
 
-    SGL_CHECK(type->kind() == TypeReflection::Kind::matrix, "\"{}\" cannot bind a matrix value", m_type_layout->name());
-    SGL_CHECK(
-        type->row_count() == uint32_t(rows) && type->col_count() == uint32_t(cols),
-        "\"{}\" expects a matrix with dimension {}x{} (got dimension {}x{})",
+    check_matrix(
         m_type_layout->name(),
+        type->kind(),
         type->row_count(),
         type->col_count(),
+        type->scalar_type(),
+        scalar_type,
         rows,
         cols
     );
-    SGL_CHECK(
-        allow_scalar_conversion(scalar_type, type->scalar_type()),
-        "\"{}\" expects a matrix with scalar type {} (no implicit conversion from type {})",
-        m_type_layout->name(),
-        type->scalar_type(),
-        scalar_type
-    );
 
-    if (rows > 1) {
-        // each row is aligned to 16 bytes
-        size_t row_size = size / rows;
-        ShaderOffset offset = m_offset;
-        for (int row = 0; row < rows; ++row) {
-            m_shader_object->set_data(offset, reinterpret_cast<const uint8_t*>(data) + row * row_size, row_size);
-            offset.uniform_offset += 16;
-        }
-    } else {
-        m_shader_object->set_data(m_offset, data, size);
-    }
+    write_matrix(m_shader_object, m_offset, data, size, rows);
 }
 
 //
@@ -755,4 +886,431 @@ SGL_API void ShaderCursor::set(const bool4& value) const
     _set_vector(&v, sizeof(v), TypeReflection::ScalarType::bool_, 4);
 }
 
+//
+// ShaderCursorPath
+//
+
+ShaderCursorPath::ShaderCursorPath(const ShaderCursor& cursor, std::string_view path)
+    : m_path(path)
+{
+    SGL_CHECK(cursor.is_valid(), "Invalid cursor");
+    SGL_CHECK(cursor.m_offset == ShaderOffset::zero(), "Paths must be compiled relative to a root cursor");
+
+    m_program_generation = cursor.m_shader_object->program_generation();
+    m_root_type_layout = cursor.m_type_layout->get_slang_type_layout();
+
+    ShaderCursor current = cursor;
+    size_t pos = 0;
+    while (pos < path.size()) {
+        if (path[pos] == '[') {
+            size_t end = path.find(']', pos);
+            SGL_CHECK(end != std::string_view::npos, "Invalid path \"{}\" (missing ']')", path);
+            uint32_t index{0};
+            auto [ptr, ec] = std::from_chars(path.data() + pos + 1, path.data() + end, index);
+            SGL_CHECK(
+                ec == std::errc() && ptr == path.data() + end && end > pos + 1,
+                "Invalid path \"{}\" (invalid index)",
+                path
+            );
+            current = current[index];
+            pos = end + 1;
+        } else {
+            if (path[pos] == '.') {
+                SGL_CHECK(pos > 0, "Invalid path \"{}\" (empty field name)", path);
+                ++pos;
+            }
+            size_t end = std::min(path.find_first_of(".[", pos), path.size());
+            std::string_view name = path.substr(pos, end - pos);
+            SGL_CHECK(!name.empty(), "Invalid path \"{}\" (empty field name)", path);
+            // Dereference constant buffers and parameter blocks explicitly (instead of
+            // letting find_field do it) so that the object hops can be recorded.
+            while (current.m_type_layout->kind() == TypeReflection::Kind::constant_buffer
+                   || current.m_type_layout->kind() == TypeReflection::Kind::parameter_block) {
+                m_object_offsets.push_back(current.m_offset);
+                current = current.dereference();
+            }
+            current = current[name];
+            pos = end;
+        }
+    }
+
+    m_offset = current.m_offset;
+    m_type_layout = current.m_type_layout->get_slang_type_layout();
+
+    ref<const TypeReflection> type = current.m_type_layout->type();
+    ref<const TypeReflection> element_type = current.m_type_layout->unwrap_array()->type();
+
+    TypeInfo& info = m_type_info;
+    if (const char* name = current.m_type_layout->name())
+        info.name = name;
+    info.kind = type->kind();
+    info.element_kind = element_type->kind();
+    info.scalar_type = element_type->scalar_type();
+    info.parameter_category = current.m_type_layout->parameter_category();
+    info.row_count = element_type->row_count();
+    info.col_count = element_type->col_count();
+    if (type->is_array()) {
+        info.element_count = narrow_cast<uint32_t>(type->element_count());
+        info.element_stride = narrow_cast<uint32_t>(current.m_type_layout->element_stride());
+    }
+    info.is_parameter_block = is_parameter_block(type);
+    info.is_resource = is_resource_type(element_type);
+    info.is_buffer_resource = is_buffer_resource_type(element_type);
+    info.is_texture_resource = is_texture_resource_type(element_type);
+    info.is_sampler = is_sampler_type(element_type);
+    info.is_shader_resource = is_shader_resource_type(element_type);
+    info.is_unordered_access = is_unordered_access_type(element_type);
+    info.is_acceleration_structure = is_acceleration_structure_resource_type(type);
+}
+
+std::string ShaderCursorPath::to_string() const
+{
+    return fmt::format("ShaderCursorPath(path=\"{}\", type=\"{}\")", m_path, m_type_info.name);
+}
+
+ref<ShaderObject> ShaderCursorPath::resolve_object(ShaderObject* shader_object) const
+{
+    SGL_CHECK(is_valid(), "Invalid shader cursor path");
+    SGL_CHECK_NOT_NULL(shader_object);
+    // Generations are unique across programs and (re)links, so layouts cannot be confused after a reload.
+    SGL_CHECK(
+        shader_object->program_generation() == m_program_generation
+            && (m_program_generation != 0
+                || shader_object->gfx_shader_object()->getElementTypeLayout() == m_root_type_layout),
+        "Shader object does not match the program path \"{}\" was compiled for (was the program reloaded?)",
+        m_path
+    );
+
+    ref<ShaderObject> object(shader_object);
+    for (const ShaderOffset& offset : m_object_offsets)
+        object = object->get_object(offset);
+    return object;
+}
+
+ShaderCursor ShaderCursorPath::resolve(ShaderObject* shader_object) const
+{
+    ref<ShaderObject> object = resolve_object(shader_object);
+
+    // Sub-objects are owned by their parent, so the cursor can hold on to a raw pointer.
+    ShaderCursor cursor;
+    cursor.m_shader_object = object;
+    cursor.m_type_layout = TypeLayoutReflection::from_slang(object, m_type_layout);
+    cursor.m_offset = m_offset;
+    return cursor;
+}
+
+void ShaderCursorPath::set_object(ShaderObject* shader_object, const ref<MutableShaderObject>& object) const
+{
+    SGL_CHECK(m_type_info.is_parameter_block, "\"{}\" cannot bind an object", m_type_info.name);
+
+    resolve_object(shader_object)->set_object(m_offset, object);
+}
+
+void ShaderCursorPath::set_resource(ShaderObject* shader_object, const ref<ResourceView>& resource_view) const
+{
+    SGL_CHECK(m_type_info.is_resource, "\"{}\" cannot bind a resource", m_type_info.name);
+    check_resource_view(
+        m_type_info.name.c_str(),
+        m_type_info.is_shader_resource,
+        m_type_info.is_unordered_access,
+        resource_view
+    );
+
+    resolve_object(shader_object)->set_resource(m_offset, resource_view);
+}
+
+void ShaderCursorPath::set_buffer(ShaderObject* shader_object, const ref<Buffer>& buffer) const
+{
+    set_buffer(shader_object, buffer, BufferRange());
+}
+
+void ShaderCursorPath::set_buffer(ShaderObject* shader_object, const ref<Buffer>& buffer, const BufferRange& range)
+    const
+{
+    SGL_CHECK(m_type_info.is_buffer_resource, "\"{}\" cannot bind a buffer", m_type_info.name);
+
+    set_resource(
+        shader_object,
+        get_resource_view(
+            m_type_info.name.c_str(),
+            "buffer",
+            m_type_info.is_shader_resource,
+            m_type_info.is_unordered_access,
+            buffer,
+            range
+        )
+    );
+}
+
+void ShaderCursorPath::set_texture(ShaderObject* shader_object, const ref<Texture>& texture) const
+{
+    SGL_CHECK(m_type_info.is_texture_resource, "\"{}\" cannot bind a texture", m_type_info.name);
+
+    set_resource(
+        shader_object,
+        get_resource_view(
+            m_type_info.name.c_str(),
+            "texture",
+            m_type_info.is_shader_resource,
+            m_type_info.is_unordered_access,
+            texture,
+            SubresourceRange()
+        )
+    );
+}
+
+void ShaderCursorPath::set_sampler(ShaderObject* shader_object, const ref<Sampler>& sampler) const
+{
+    SGL_CHECK(m_type_info.is_sampler, "\"{}\" cannot bind a sampler", m_type_info.name);
+
+    resolve_object(shader_object)->set_sampler(m_offset, sampler);
+}
+
+void ShaderCursorPath::set_acceleration_structure(
+    ShaderObject* shader_object,
+    const ref<AccelerationStructure>& acceleration_structure
+) const
+{
+    SGL_CHECK(
+        m_type_info.is_acceleration_structure,
+        "\"{}\" cannot bind an acceleration structure",
+        m_type_info.name
+    );
+
+    resolve_object(shader_object)->set_acceleration_structure(m_offset, acceleration_structure);
+}
+
+void ShaderCursorPath::set_data(ShaderObject* shader_object, const void* data, size_t size) const
+{
+    if (m_type_info.parameter_category != TypeReflection::ParameterCategory::uniform)
+        SGL_THROW("\"{}\" cannot bind data", m_type_info.name);
+    resolve_object(shader_object)->set_data(m_offset, data, size);
+}
+
+void ShaderCursorPath::set_cuda_tensor_view(ShaderObject* shader_object, const cuda::TensorView& tensor_view) const
+{
+    SGL_CHECK(m_type_info.is_buffer_resource, "\"{}\" cannot bind a CUDA tensor view", m_type_info.name);
+
+    bool is_uav = is_cuda_tensor_view_uav(
+        m_type_info.name.c_str(),
+        m_type_info.is_shader_resource,
+        m_type_info.is_unordered_access
+    );
+    resolve_object(shader_object)->set_cuda_tensor_view(m_offset, tensor_view, is_uav);
+}
+
+void ShaderCursorPath::_set_array(
+    ShaderObject* shader_object,
+    const void* data,
+    size_t size,
+    TypeReflection::ScalarType scalar_type,
+    size_t element_count
+) const
+{
+    check_array(
+        m_type_info.name.c_str(),
+        m_type_info.kind == TypeReflection::Kind::array,
+        m_type_info.element_count,
+        m_type_info.scalar_type,
+        scalar_type,
+        element_count
+    );
+
+    write_array(
+        resolve_object(shader_object),
+        m_offset,
+        data,
+        size,
+        get_scalar_type_size(m_type_info.scalar_type),
+        element_count,
+        m_type_info.element_stride
+    );
+}
+
+void ShaderCursorPath::_set_scalar(
+    ShaderObject* shader_object,
+    const void* data,
+    size_t size,
+    TypeReflection::ScalarType scalar_type
+) const
+{
+    check_scalar(m_type_info.name.c_str(), m_type_info.element_kind, m_type_info.scalar_type, scalar_type);
+
+    resolve_object(shader_object)->set_data(m_offset, data, size);
+}
+
+void ShaderCursorPath::_set_vector(
+    ShaderObject* shader_object,
+    const void* data,
+    size_t size,
+    TypeReflection::ScalarType scalar_type,
+    int dimension
+) const
+{
+    check_vector(
+        m_type_info.name.c_str(),
+        m_type_info.element_kind,
+        m_type_info.col_count,
+        m_type_info.scalar_type,
+        scalar_type,
+        dimension
+    );
+
+    resolve_object(shader_object)->set_data(m_offset, data, size);
+}
+
+void ShaderCursorPath::_set_matrix(
+    ShaderObject* shader_object,
+    const void* data,
+    size_t size,
+    TypeReflection::ScalarType scalar_type,
+    int rows,
+    int cols
+) const
+{
+    check_matrix(
+        m_type_info.name.c_str(),
+        m_type_info.element_kind,
+        m_type_info.row_count,
+        m_type_info.col_count,
+        m_type_info.scalar_type,
+        scalar_type,
+        rows,
+        cols
+    );
+
+    write_matrix(resolve_object(shader_object), m_offset, data, size, rows);
+}
+
+//
+// ShaderCursorPath setter specializations
+//
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<MutableShaderObject>& value) const
+{
+    set_object(shader_object, value);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<Buffer>& value) const
+{
+    set_buffer(shader_object, value);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<Texture>& value) const
+{
+    set_texture(shader_object, value);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<ResourceView>& value) const
+{
+    set_resource(shader_object, value);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<Sampler>& value) const
+{
+    set_sampler(shader_object, value);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const ref<AccelerationStructure>& value) const
+{
+    set_acceleration_structure(shader_object, value);
+}
+
+#define SET_SCALAR(type, scalar_type)                                                                                  \
+    template<>                                                                                                         \
+    SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const type& value) const                           \
+    {                                                                                                                  \
+        _set_scalar(shader_object, &value, sizeof(value), TypeReflection::ScalarType::scalar_type);                    \
+    }
+
+#define SET_VECTOR(type, scalar_type)                                                                                  \
+    template<>                                                                                                         \
+    SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const type& value) const                           \
+    {                                                                                                                  \
+        _set_vector(shader_object, &value, sizeof(value), TypeReflection::ScalarType::scalar_type, type::dimension);   \
+    }
+
+#define SET_MATRIX(type, scalar_type)                                                                                  \
+    template<>                                                                                                         \
+    SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const type& value) const                           \
+    {                                                                                                                  \
+        _set_matrix(                                                                                                   \
+            shader_object,                                                                                             \
+            &value,                                                                                                    \
+            sizeof(value),                                                                                             \
+            TypeReflection::ScalarType::scalar_type,                                                                   \
+            type::rows,                                                                                                \
+            type::cols                                                                                                 \
+        );                                                                                                             \
+    }
+
+SET_SCALAR(int, int32);
+SET_VECTOR(int2, int32);
+SET_VECTOR(int3, int32);
+SET_VECTOR(int4, int32);
+
+SET_SCALAR(uint, uint32);
+SET_VECTOR(uint2, uint32);
+SET_VECTOR(uint3, uint32);
+SET_VECTOR(uint4, uint32);
+
+SET_SCALAR(int64_t, int64);
+SET_SCALAR(uint64_t, uint64);
+
+SET_SCALAR(float16_t, float16);
+SET_VECTOR(float16_t2, float16);
+SET_VECTOR(float16_t3, float16);
+SET_VECTOR(float16_t4, float16);
+
+SET_SCALAR(float, float32);
+SET_VECTOR(float2, float32);
+SET_VECTOR(float3, float32);
+SET_VECTOR(float4, float32);
+
+SET_MATRIX(float2x2, float32);
+SET_MATRIX(float3x3, float32);
+SET_MATRIX(float2x4, float32);
+SET_MATRIX(float3x4, float32);
+SET_MATRIX(float4x4, float32);
+
+SET_SCALAR(double, float64);
+
+#undef SET_SCALAR
+#undef SET_VECTOR
+#undef SET_MATRIX
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const bool& value) const
+{
+    uint v = value ? 1 : 0;
+    _set_scalar(shader_object, &v, sizeof(v), TypeReflection::ScalarType::bool_);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const bool2& value) const
+{
+    uint2 v = {value.x ? 1 : 0, value.y ? 1 : 0};
+    _set_vector(shader_object, &v, sizeof(v), TypeReflection::ScalarType::bool_, 2);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const bool3& value) const
+{
+    uint3 v = {value.x ? 1 : 0, value.y ? 1 : 0, value.z ? 1 : 0};
+    _set_vector(shader_object, &v, sizeof(v), TypeReflection::ScalarType::bool_, 3);
+}
+
+template<>
+SGL_API void ShaderCursorPath::set(ShaderObject* shader_object, const bool4& value) const
+{
+    uint4 v = {value.x ? 1 : 0, value.y ? 1 : 0, value.z ? 1 : 0, value.w ? 1 : 0};
+    _set_vector(shader_object, &v, sizeof(v), TypeReflection::ScalarType::bool_, 4);
+}
+
 } // namespace sgl
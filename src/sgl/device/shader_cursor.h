@@ -9,7 +9,9 @@
 #include "sgl/core/config.h"
 #include "sgl/core/macros.h"
 
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace sgl {
 
@@ -19,6 +21,8 @@ public:
 
     ShaderCursor(ShaderObject* shader_object);
 
+    ShaderObject* shader_object() const { return m_shader_object; }
+
     ref<const TypeLayoutReflection> type_layout() const { return m_type_layout; }
     ref<const TypeReflection> type() const { return m_type_layout->type(); }
 
@@ -53,6 +57,8 @@ public:
 
     void set_resource(const ref<ResourceView>& resource_view) const;
     void set_buffer(const ref<Buffer>& buffer) const;
+    /// Bind a range of a buffer (e.g. a \c BufferPool allocation).
+    void set_buffer(const ref<Buffer>& buffer, const BufferRange& range) const;
     void set_texture(const ref<Texture>& texture) const;
     void set_sampler(const ref<Sampler>& sampler) const;
     void set_acceleration_structure(const ref<AccelerationStructure>& acceleration_structure) const;
@@ -79,6 +85,144 @@ private:
     ShaderObject* m_shader_object{nullptr};
     ref<const TypeLayoutReflection> m_type_layout{nullptr};
     ShaderOffset m_offset;
+
+    friend class ShaderCursorPath;
+};
+
+/**
+ * Precompiled path to a shader variable.
+ *
+ * Navigating to a variable with \c ShaderCursor (e.g. `cursor["g_params"]["lights"][3]["color"]`)
+ * looks up every path component in the reflection data. A \c ShaderCursorPath does this lookup
+ * once and stores the resulting offsets together with the information needed for type checking.
+ * Binding values through the path skips the reflection walk entirely.
+ *
+ * A path can be applied to any shader object created for the same program generation as the shader
+ * object it was compiled for, e.g. the transient shader objects returned by binding the same
+ * pipeline in every frame. Paths need to be recompiled after the program is reloaded.
+ */
+class SGL_API ShaderCursorPath {
+public:
+    ShaderCursorPath() = default;
+
+    /**
+     * Compile a path relative to a root cursor.
+     *
+     * \param cursor Cursor pointing to the root of a shader object.
+     * \param path Path to the variable. Fields are separated by `.` and array/vector elements
+     * are accessed using `[index]`, e.g. "g_params.lights[3].color".
+     */
+    ShaderCursorPath(const ShaderCursor& cursor, std::string_view path);
+
+    /// The path string this path was compiled from.
+    const std::string& path() const { return m_path; }
+
+    /// Offset of the variable within the innermost shader object.
+    ShaderOffset offset() const { return m_offset; }
+
+    /// Number of constant buffers/parameter blocks that are dereferenced along the path.
+    size_t object_hop_count() const { return m_object_offsets.size(); }
+
+    bool is_valid() const { return m_offset.is_valid(); }
+
+    std::string to_string() const;
+
+    /// Resolve the path to a regular cursor on the given shader object.
+    ShaderCursor resolve(ShaderObject* shader_object) const;
+
+    //
+    // Resource binding
+    //
+
+    void set_object(ShaderObject* shader_object, const ref<MutableShaderObject>& object) const;
+
+    void set_resource(ShaderObject* shader_object, const ref<ResourceView>& resource_view) const;
+    void set_buffer(ShaderObject* shader_object, const ref<Buffer>& buffer) const;
+    /// Bind a range of a buffer (e.g. a \c BufferPool allocation).
+    void set_buffer(ShaderObject* shader_object, const ref<Buffer>& buffer, const BufferRange& range) const;
+    void set_texture(ShaderObject* shader_object, const ref<Texture>& texture) const;
+    void set_sampler(ShaderObject* shader_object, const ref<Sampler>& sampler) const;
+    void set_acceleration_structure(
+        ShaderObject* shader_object,
+        const ref<AccelerationStructure>& acceleration_structure
+    ) const;
+
+    void set_data(ShaderObject* shader_object, const void* data, size_t size) const;
+
+    void set_cuda_tensor_view(ShaderObject* shader_object, const cuda::TensorView& tensor_view) const;
+
+    template<typename T>
+    void set(ShaderObject* shader_object, const T& value) const;
+
+    void _set_array(
+        ShaderObject* shader_object,
+        const void* data,
+        size_t size,
+        TypeReflection::ScalarType scalar_type,
+        size_t element_count
+    ) const;
+    void _set_scalar(ShaderObject* shader_object, const void* data, size_t size, TypeReflection::ScalarType scalar_type)
+        const;
+    void _set_vector(
+        ShaderObject* shader_object,
+        const void* data,
+        size_t size,
+        TypeReflection::ScalarType scalar_type,
+        int dimension
+    ) const;
+    void _set_matrix(
+        ShaderObject* shader_object,
+        const void* data,
+        size_t size,
+        TypeReflection::ScalarType scalar_type,
+        int rows,
+        int cols
+    ) const;
+
+    /// Type information of the variable, cached when the path is compiled.
+    struct TypeInfo {
+        /// Name of the type (used for error messages).
+        std::string name;
+        /// Kind of the variable type.
+        TypeReflection::Kind kind{TypeReflection::Kind::none};
+        /// Kind of the variable type with arrays unwrapped.
+        TypeReflection::Kind element_kind{TypeReflection::Kind::none};
+        /// Scalar type of the variable type with arrays unwrapped.
+        TypeReflection::ScalarType scalar_type{TypeReflection::ScalarType::none_};
+        /// Parameter category of the variable.
+        TypeReflection::ParameterCategory parameter_category{TypeReflection::ParameterCategory::none};
+        uint32_t row_count{0};
+        uint32_t col_count{0};
+        /// Number of array elements (0 if not an array).
+        uint32_t element_count{0};
+        /// Uniform stride of array elements (0 if not an array).
+        uint32_t element_stride{0};
+        bool is_parameter_block{false};
+        bool is_resource{false};
+        bool is_buffer_resource{false};
+        bool is_texture_resource{false};
+        bool is_sampler{false};
+        bool is_shader_resource{false};
+        bool is_unordered_access{false};
+        bool is_acceleration_structure{false};
+    };
+
+    /// Cached type information of the variable.
+    const TypeInfo& type_info() const { return m_type_info; }
+
+private:
+    /// Walk the constant buffer/parameter block hops and return the innermost shader object.
+    ref<ShaderObject> resolve_object(ShaderObject* shader_object) const;
+
+    std::string m_path;
+    /// Program generation of the root shader object (zero if it was created from a type layout).
+    uint64_t m_program_generation{0};
+    /// Element type layout of the root shader object, only compared if there is no program generation.
+    slang::TypeLayoutReflection* m_root_type_layout{nullptr};
+    slang::TypeLayoutReflection* m_type_layout{nullptr};
+    std::vector<ShaderOffset> m_object_offsets;
+    ShaderOffset m_offset;
+    TypeInfo m_type_info;
 };
 
 } // namespace sgl
@@ -11,6 +11,9 @@
 #include "sgl/device/device.h"
 #include "sgl/device/cuda_interop.h"
 
+#include <algorithm>
+#include <atomic>
+
 namespace sgl {
 
 inline gfx::ShaderOffset gfx_shader_offset(const ShaderOffset& offset)
@@ -26,9 +29,10 @@ inline gfx::ShaderOffset gfx_shader_offset(const ShaderOffset& offset)
 // ShaderObject
 //
 
-ShaderObject::ShaderObject(ref<Device> device, gfx::IShaderObject* shader_object)
+ShaderObject::ShaderObject(ref<Device> device, gfx::IShaderObject* shader_object, uint64_t program_generation)
     : m_device(std::move(device))
     , m_shader_object(shader_object)
+    , m_program_generation(program_generation)
 {
 }
 
@@ -98,28 +102,40 @@ void ShaderObject::get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>
 TransientShaderObject::TransientShaderObject(
     ref<Device> device,
     gfx::IShaderObject* shader_object,
-    CommandBuffer* command_buffer
+    CommandBuffer* command_buffer,
+    uint64_t program_generation
 )
-    : ShaderObject(std::move(device), shader_object)
+    : ShaderObject(std::move(device), shader_object, program_generation)
     , m_command_buffer(command_buffer)
 {
 }
 
 ref<ShaderObject> TransientShaderObject::get_entry_point(uint32_t index)
 {
-    auto object = make_ref<TransientShaderObject>(m_device, m_shader_object->getEntryPoint(index), m_command_buffer);
-    m_sub_objects.push_back(object);
+    auto object = make_ref<TransientShaderObject>(
+        m_device,
+        m_shader_object->getEntryPoint(index),
+        m_command_buffer,
+        m_program_generation
+    );
+    m_entry_points.push_back(object);
     return object;
 }
 
 ref<ShaderObject> TransientShaderObject::get_object(const ShaderOffset& offset)
 {
+    // Sub-objects are cached so that repeatedly binding through the same
+    // constant buffer or parameter block does not allocate a new wrapper each time.
+    auto it = m_sub_objects.find(offset);
+    if (it != m_sub_objects.end())
+        return it->second;
     auto object = make_ref<TransientShaderObject>(
         m_device,
         m_shader_object->getObject(gfx_shader_offset(offset)),
-        m_command_buffer
+        m_command_buffer,
+        m_program_generation
     );
-    m_sub_objects.push_back(object);
+    m_sub_objects.insert({offset, object});
     return object;
 }
 
@@ -129,6 +145,12 @@ void TransientShaderObject::set_object(const ShaderOffset& offset, const ref<Sha
         mutable_object->set_resource_states(m_command_buffer);
     }
 
+    // Keep the sub-object cache in sync, so get_object does not return a wrapper of the replaced object.
+    if (ref<TransientShaderObject> transient_object = dynamic_ref_cast<TransientShaderObject>(object))
+        m_sub_objects.insert_or_assign(offset, transient_object);
+    else
+        m_sub_objects.erase(offset);
+
     ShaderObject::set_object(offset, object);
 }
 
@@ -156,7 +178,9 @@ void TransientShaderObject::set_resource(const ShaderOffset& offset, const ref<R
 void TransientShaderObject::get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers) const
 {
     ShaderObject::get_cuda_interop_buffers(cuda_interop_buffers);
-    for (const auto& sub_object : m_sub_objects)
+    for (const auto& entry_point : m_entry_points)
+        entry_point->get_cuda_interop_buffers(cuda_interop_buffers);
+    for (const auto& [_, sub_object] : m_sub_objects)
         sub_object->get_cuda_interop_buffers(cuda_interop_buffers);
 }
 
@@ -164,14 +188,18 @@ void TransientShaderObject::get_cuda_interop_buffers(std::vector<ref<cuda::Inter
 // MutableShaderObject
 //
 
-MutableShaderObject::MutableShaderObject(ref<Device> device, gfx::IShaderObject* shader_object)
-    : ShaderObject(std::move(device), shader_object)
+MutableShaderObject::MutableShaderObject(
+    ref<Device> device,
+    gfx::IShaderObject* shader_object,
+    uint64_t program_generation
+)
+    : ShaderObject(std::move(device), shader_object, program_generation)
 {
     m_shader_object->addRef();
 }
 
 MutableShaderObject::MutableShaderObject(ref<Device> device, const ShaderProgram* shader_program)
-    : ShaderObject(std::move(device), nullptr)
+    : ShaderObject(std::move(device), nullptr, shader_program->generation())
 {
     m_device->gfx_device()->createMutableRootShaderObject(shader_program->gfx_shader_program(), &m_shader_object);
 }
@@ -201,16 +229,23 @@ ref<ShaderObject> MutableShaderObject::get_object(const ShaderOffset& offset)
     auto it = m_sub_objects.find(offset);
     if (it != m_sub_objects.end())
         return it->second;
-    auto object = make_ref<MutableShaderObject>(m_device, m_shader_object->getObject(gfx_shader_offset(offset)));
+    auto object = make_ref<MutableShaderObject>(
+        m_device,
+        m_shader_object->getObject(gfx_shader_offset(offset)),
+        m_program_generation
+    );
     m_sub_objects.insert({offset, object});
+    invalidate();
     return object;
 }
 
 void MutableShaderObject::set_object(const ShaderOffset& offset, const ref<ShaderObject>& object)
 {
-    if (ref<MutableShaderObject> mutable_object = dynamic_ref_cast<MutableShaderObject>(object)) {
-        m_sub_objects.insert({offset, mutable_object});
-    }
+    if (ref<MutableShaderObject> mutable_object = dynamic_ref_cast<MutableShaderObject>(object))
+        m_sub_objects.insert_or_assign(offset, mutable_object);
+    else
+        m_sub_objects.erase(offset);
+    invalidate();
 
     ShaderObject::set_object(offset, object);
 }
@@ -219,32 +254,51 @@ void MutableShaderObject::set_resource(const ShaderOffset& offset, const ref<Res
 {
     ShaderObject::set_resource(offset, resource_view);
 
-    if (resource_view)
-        m_resource_views[offset] = resource_view;
-    else
-        m_resource_views.erase(offset);
+    auto it = m_resource_views.find(offset);
+    if (resource_view) {
+        if (it != m_resource_views.end() && it->second.get() == resource_view.get())
+            return;
+        m_resource_views.insert_or_assign(offset, resource_view);
+    } else {
+        if (it == m_resource_views.end())
+            return;
+        m_resource_views.erase(it);
+    }
+    invalidate();
 }
 
 void MutableShaderObject::set_resource_states(CommandBuffer* command_buffer) const
 {
-    for (auto& [offset, resource_view] : m_resource_views) {
-        switch (resource_view->type()) {
-        case ResourceViewType::shader_resource:
-            command_buffer->set_resource_state(resource_view, ResourceState::shader_resource);
-            break;
-        case ResourceViewType::unordered_access:
-            if (resource_view->resource()->state_tracker().global_state() == ResourceState::unordered_access)
-                command_buffer->uav_barrier(resource_view->resource());
-            else
-                command_buffer->set_resource_state(resource_view, ResourceState::unordered_access);
-            break;
-        default:
-            SGL_THROW("Invalid resource view type");
-        }
-    }
-    for (auto& [_, sub_object] : m_sub_objects) {
-        sub_object->set_resource_states(command_buffer);
+    uint64_t generation = subtree_generation();
+    if (generation != m_cached_resource_views_generation) {
+        m_cached_resource_views.clear();
+        collect_resource_views(m_cached_resource_views);
+        m_cached_resource_views_generation = generation;
     }
+    command_buffer->set_resource_view_states(m_cached_resource_views);
+}
+
+void MutableShaderObject::invalidate()
+{
+    static std::atomic<uint64_t> s_generation{0};
+    m_generation = ++s_generation;
+}
+
+uint64_t MutableShaderObject::subtree_generation() const
+{
+    // Generations are drawn from a global counter, so any change in the subtree increases the maximum.
+    uint64_t generation = m_generation;
+    for (const auto& [_, sub_object] : m_sub_objects)
+        generation = std::max(generation, sub_object->subtree_generation());
+    return generation;
+}
+
+void MutableShaderObject::collect_resource_views(std::vector<const ResourceView*>& resource_views) const
+{
+    for (const auto& [_, resource_view] : m_resource_views)
+        resource_views.push_back(resource_view);
+    for (const auto& [_, sub_object] : m_sub_objects)
+        sub_object->collect_resource_views(resource_views);
 }
 
 void MutableShaderObject::get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers) const
@@ -21,10 +21,14 @@ namespace sgl {
 class SGL_API ShaderObject : public Object {
     SGL_OBJECT(ShaderObject)
 public:
-    ShaderObject(ref<Device> device, gfx::IShaderObject* shader_object);
+    ShaderObject(ref<Device> device, gfx::IShaderObject* shader_object, uint64_t program_generation = 0);
 
     virtual ref<const TypeLayoutReflection> element_type_layout() const;
 
+    /// Generation of the shader program this object was created for (see \c ShaderProgram::generation).
+    /// Sub-objects inherit the generation of their parent. Zero if the object was created from a type layout.
+    uint64_t program_generation() const { return m_program_generation; }
+
     virtual uint32_t get_entry_point_count() const;
     virtual ref<ShaderObject> get_entry_point(uint32_t index) = 0;
 
@@ -45,13 +49,19 @@ public:
 protected:
     ref<Device> m_device;
     gfx::IShaderObject* m_shader_object;
+    uint64_t m_program_generation;
     std::vector<ref<cuda::InteropBuffer>> m_cuda_interop_buffers;
 };
 
 class SGL_API TransientShaderObject : public ShaderObject {
     SGL_OBJECT(TransientShaderObject)
 public:
-    TransientShaderObject(ref<Device> device, gfx::IShaderObject* shader_object, CommandBuffer* command_buffer);
+    TransientShaderObject(
+        ref<Device> device,
+        gfx::IShaderObject* shader_object,
+        CommandBuffer* command_buffer,
+        uint64_t program_generation
+    );
 
     virtual ref<ShaderObject> get_entry_point(uint32_t index) override;
 
@@ -64,13 +74,14 @@ public:
 
 private:
     CommandBuffer* m_command_buffer;
-    std::vector<ref<TransientShaderObject>> m_sub_objects;
+    std::vector<ref<TransientShaderObject>> m_entry_points;
+    std::map<ShaderOffset, ref<TransientShaderObject>> m_sub_objects;
 };
 
 class SGL_API MutableShaderObject : public ShaderObject {
     SGL_OBJECT(MutableShaderObject)
 public:
-    MutableShaderObject(ref<Device> device, gfx::IShaderObject* shader_object);
+    MutableShaderObject(ref<Device> device, gfx::IShaderObject* shader_object, uint64_t program_generation);
     MutableShaderObject(ref<Device> device, const ShaderProgram* shader_program);
     MutableShaderObject(ref<Device> device, const TypeLayoutReflection* type_layout);
     ~MutableShaderObject();
@@ -82,13 +93,27 @@ public:
 
     virtual void set_resource(const ShaderOffset& offset, const ref<ResourceView>& resource_view) override;
 
+    /// Transition all resources bound to this object and its sub-objects for shader access.
+    /// The list of resource views is cached and only rebuilt after bindings have changed.
     void set_resource_states(CommandBuffer* command_buffer) const;
 
     virtual void get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers) const override;
 
 private:
+    /// Mark the bindings of this object as changed.
+    void invalidate();
+    /// Latest change of the bindings of this object or any of its sub-objects.
+    uint64_t subtree_generation() const;
+    void collect_resource_views(std::vector<const ResourceView*>& resource_views) const;
+
     std::map<ShaderOffset, ref<ResourceView>> m_resource_views;
     std::map<ShaderOffset, ref<MutableShaderObject>> m_sub_objects;
+
+    /// Generation of the last change to the bindings (from a global counter, so it is unique across objects).
+    uint64_t m_generation{0};
+    /// Resource views of this object and all sub-objects, valid for \c m_cached_resource_views_generation.
+    mutable std::vector<const ResourceView*> m_cached_resource_views;
+    mutable uint64_t m_cached_resource_views_generation{0};
 };
 
 } // namespace sgl
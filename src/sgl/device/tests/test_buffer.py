@@ -41,6 +41,54 @@ def test_buffer_init_data(device_type: sgl.DeviceType):
     assert np.all(data == readback)
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_buffer_read_async(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    data = np.random.randint(0, 0xFFFFFFFF, size=1024, dtype=np.uint32)
+    buffer = device.create_buffer(
+        size=4 * 1024,
+        usage=sgl.ResourceUsage.shader_resource,
+        data=data,
+    )
+
+    # Issue multiple read-backs before waiting on any of them.
+    requests = [
+        device.read_buffer_data_async(buffer),
+        device.read_buffer_data_async(buffer, size=256, offset=512),
+    ]
+    assert requests[0].size == 4 * 1024
+    assert requests[1].size == 256
+    assert requests[0].submission_id < requests[1].submission_id
+
+    requests[1].wait()
+    assert requests[1].is_ready()
+    assert np.all(requests[1].to_numpy().view(np.uint32) == data[128:192])
+    assert np.all(requests[0].to_numpy().view(np.uint32) == data)
+
+    with pytest.raises(Exception):
+        device.read_buffer_data_async(buffer, size=4 * 1024, offset=4)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_texture_read_async(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    data = np.random.randint(0, 0xFFFFFFFF, size=(13, 17), dtype=np.uint32)
+    texture = device.create_texture(
+        format=sgl.Format.r32_uint,
+        width=17,
+        height=13,
+        mip_count=1,
+        usage=sgl.ResourceUsage.shader_resource,
+        data=data,
+    )
+
+    request = device.read_texture_data_async(texture)
+    assert request.size == data.nbytes
+    assert np.all(request.to_numpy().view(np.uint32).reshape(data.shape) == data)
+
+
 # TODO we should also test buffers bound as root descriptors in D3D12 (allow larger buffers)
 
 
@@ -136,5 +184,261 @@ def test_buffer(device_type: sgl.DeviceType, type: str, size_MB: int):
         assert np.all(data == readback)
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_dispatch_binding_plans(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    count = 256
+    src = device.create_buffer(
+        size=count * 4,
+        usage=sgl.ResourceUsage.shader_resource,
+    )
+    dst = device.create_buffer(
+        size=count * 4,
+        usage=sgl.ResourceUsage.unordered_access,
+    )
+
+    copy_kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["copy_byte_address_buffer"])
+    )
+
+    def copy(**kwargs):
+        copy_kernel.dispatch(thread_count=[count, 1, 1], src=src, dst=dst, **kwargs)
+
+    # Repeated dispatches with the same signature reuse the cached binding plan
+    # but must still bind the new values.
+    for i in range(3):
+        data = np.arange(count, dtype=np.uint32) + i
+        src.from_numpy(data)
+        copy(src_offset=0, dst_offset=0, count=count)
+        assert np.all(dst.to_numpy().view(np.uint32) == data)
+
+    # A different argument order results in a new signature.
+    data = np.arange(count, dtype=np.uint32) * 2
+    src.from_numpy(data)
+    copy(count=count, dst_offset=0, src_offset=0)
+    assert np.all(dst.to_numpy().view(np.uint32) == data)
+
+    # Type errors are still reported and do not corrupt the cache.
+    with pytest.raises(Exception):
+        copy(src_offset=0, dst_offset=0, count=1.0)
+    with pytest.raises(Exception):
+        copy(src_offset=0, dst_offset=0, unknown=count)
+
+    data = np.arange(count, dtype=np.uint32) * 3
+    src.from_numpy(data)
+    copy(src_offset=0, dst_offset=0, count=count)
+    assert np.all(dst.to_numpy().view(np.uint32) == data)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_dispatch_sequence(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    count = 256
+    src = device.create_buffer(
+        size=count * 4,
+        usage=sgl.ResourceUsage.shader_resource,
+    )
+    tmp = device.create_buffer(
+        size=count * 4,
+        usage=sgl.ResourceUsage.shader_resource | sgl.ResourceUsage.unordered_access,
+    )
+    dst = device.create_buffer(
+        size=count * 4,
+        usage=sgl.ResourceUsage.unordered_access,
+    )
+
+    add_kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["add_byte_address_buffer"])
+    )
+
+    sequence = device.create_dispatch_sequence()
+    assert sequence.dispatch_count == 0
+    assert (
+        sequence.record(
+            add_kernel,
+            thread_count=[count, 1, 1],
+            vars={"g_src": src, "g_dst": tmp, "g_add": 1, "g_count": count},
+        )
+        == 0
+    )
+    assert (
+        sequence.record(
+            add_kernel,
+            thread_count=[count, 1, 1],
+            vars={"g_src": tmp, "g_dst": dst, "g_add": 2, "g_count": count},
+        )
+        == 1
+    )
+    assert sequence.dispatch_count == 2
+
+    # Re-submitting uses the parameters bound at record time.
+    for i in range(2):
+        data = np.arange(count, dtype=np.uint32) + i
+        src.from_numpy(data)
+        sequence.submit()
+        assert np.all(dst.to_numpy().view(np.uint32) == data + 3)
+
+    # Patch individual parameters between submissions.
+    sequence.cursor(0)["g_add"] = 5
+    sequence.update(1, {"g_add": 10})
+    sequence.submit()
+    assert np.all(dst.to_numpy().view(np.uint32) == data + 15)
+
+    # Only process the first half.
+    dst.from_numpy(np.zeros(count, dtype=np.uint32))
+    sequence.update(1, {"g_count": count // 2})
+    sequence.set_thread_count(1, [count // 2, 1, 1])
+    sequence.submit()
+    result = dst.to_numpy().view(np.uint32)
+    assert np.all(result[: count // 2] == data[: count // 2] + 15)
+    assert np.all(result[count // 2 :] == 0)
+
+    with pytest.raises(Exception):
+        sequence.cursor(2)
+
+    sequence.clear()
+    assert sequence.dispatch_count == 0
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_dispatch_sequence_resource_states(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    count = 256
+    usage = sgl.ResourceUsage.shader_resource | sgl.ResourceUsage.unordered_access
+    a = device.create_buffer(size=count * 4, usage=usage)
+    b = device.create_buffer(size=count * 4, usage=usage)
+
+    add_kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["add_byte_address_buffer"])
+    )
+
+    # Ping-pong between two buffers, every dispatch reads the output of the previous one.
+    sequence = device.create_dispatch_sequence()
+    sequence.record(
+        add_kernel, [count, 1, 1], {"g_src": a, "g_dst": b, "g_add": 1, "g_count": count}
+    )
+    sequence.record(
+        add_kernel, [count, 1, 1], {"g_src": b, "g_dst": a, "g_add": 1, "g_count": count}
+    )
+
+    data = np.arange(count, dtype=np.uint32)
+    a.from_numpy(data)
+    sequence.submit()
+    assert np.all(b.to_numpy().view(np.uint32) == data + 1)
+    assert np.all(a.to_numpy().view(np.uint32) == data + 2)
+
+    # Swapping the bound buffers requires new state transitions.
+    sequence.update(0, {"g_src": b, "g_dst": a})
+    sequence.update(1, {"g_src": a, "g_dst": b})
+    sequence.submit()
+    assert np.all(a.to_numpy().view(np.uint32) == data + 2)
+    assert np.all(b.to_numpy().view(np.uint32) == data + 3)
+
+    # Unchanged bindings reuse the cached transitions.
+    sequence.submit()
+    sequence.submit()
+    assert np.all(a.to_numpy().view(np.uint32) == data + 6)
+    assert np.all(b.to_numpy().view(np.uint32) == data + 7)
+
+
+DISPATCH_RELOAD_SHADER = """
+struct Params {{
+    {0}
+    uint add;
+    uint count;
+}};
+ConstantBuffer<Params> g_params;
+RWStructuredBuffer<uint> g_dst;
+
+[shader("compute")]
+[numthreads(16, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadID)
+{{
+    if (tid.x < g_params.count)
+        g_dst[tid.x] = tid.x + {1};
+}}
+"""
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_dispatch_binding_plans_hot_reload(device_type: sgl.DeviceType, tmp_path: Path):
+    device = helpers.get_device(device_type)
+
+    count = 256
+    dst = device.create_buffer(
+        element_count=count,
+        struct_size=4,
+        usage=sgl.ResourceUsage.unordered_access,
+    )
+
+    path = tmp_path / "dispatch_reload.slang"
+    path.write_text(DISPATCH_RELOAD_SHADER.format("", "g_params.add"))
+    kernel = device.create_compute_kernel(device.load_program(str(path), ["main"]))
+
+    sequence = device.create_dispatch_sequence()
+    sequence.record(
+        kernel,
+        thread_count=[count, 1, 1],
+        vars={"g_params": {"add": 2, "count": count}, "g_dst": dst},
+    )
+
+    def dispatch():
+        kernel.dispatch(
+            thread_count=[count, 1, 1],
+            vars={"g_params": {"add": 1, "count": count}, "g_dst": dst},
+        )
+
+    dispatch()
+    assert np.all(dst.to_numpy().view(np.uint32) == np.arange(count) + 1)
+
+    # Change the layout of the parameters and reload. The cached binding plans
+    # refer to the old layout and must be rebuilt.
+    path.write_text(DISPATCH_RELOAD_SHADER.format("uint4 pad;", "g_params.add * 10 + g_params.pad.x"))
+    device.reload_all_programs()
+
+    dispatch()
+    assert np.all(dst.to_numpy().view(np.uint32) == np.arange(count) + 10)
+    dispatch()
+    assert np.all(dst.to_numpy().view(np.uint32) == np.arange(count) + 10)
+
+    # Recorded dispatches rebind through the binding plan cache as well.
+    sequence.submit()
+    assert np.all(dst.to_numpy().view(np.uint32) == np.arange(count) + 20)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_dispatch_sequence_shared_resource_views(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    count = 256
+    usage = sgl.ResourceUsage.shader_resource | sgl.ResourceUsage.unordered_access
+    a = device.create_buffer(size=count * 4, usage=usage)
+    b = device.create_buffer(size=count * 4, usage=usage)
+
+    add_kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["add_byte_address_buffer"])
+    )
+
+    # The first dispatch binds a shader resource and an unordered access view of the same buffer,
+    # the second one reads that buffer through a shader resource view only.
+    sequence = device.create_dispatch_sequence()
+    sequence.record(
+        add_kernel, [count, 1, 1], {"g_src": a, "g_dst": a, "g_add": 1, "g_count": count}
+    )
+    sequence.record(
+        add_kernel, [count, 1, 1], {"g_src": a, "g_dst": b, "g_add": 1, "g_count": count}
+    )
+
+    data = np.arange(count, dtype=np.uint32)
+    a.from_numpy(data)
+    for i in range(1, 4):
+        sequence.submit()
+        assert np.all(a.to_numpy().view(np.uint32) == data + i)
+        assert np.all(b.to_numpy().view(np.uint32) == data + i + 1)
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v", "-s"])
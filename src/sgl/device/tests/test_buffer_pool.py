@@ -0,0 +1,141 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import sys
+import sgl
+import numpy as np
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent))
+import helpers
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_buffer_pool(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    # Min block size must be a power of two
+    with pytest.raises(Exception):
+        device.create_buffer_pool(min_block_size=100)
+    with pytest.raises(Exception):
+        device.create_buffer_pool(min_block_size=0)
+
+    # Page size must hold at least one block
+    with pytest.raises(Exception):
+        device.create_buffer_pool(page_size=128, min_block_size=256)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_allocation(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    pool = device.create_buffer_pool(
+        page_size=64 * 1024, min_block_size=256, debug_name="test_pool"
+    )
+    assert pool.size_class_count == 9
+    assert pool.block_size(0) == 256
+    assert pool.block_size(8) == 64 * 1024
+
+    # Small allocations share a page and are rounded up to their size class.
+    a = pool.allocate(100)
+    b = pool.allocate(1000)
+    assert a.buffer == b.buffer
+    assert a.size == 100 and a.size_class == 0
+    assert b.size == 1000 and b.size_class == 2
+    assert b.offset == 256
+    assert pool.stats.page_count == 1
+    assert pool.stats.allocation_count == 2
+    assert pool.stats.used_size == 1100
+    assert pool.stats.allocated_size == 256 + 1024
+    assert pool.stats.fragmentation > 0
+
+    # Released blocks are reused by allocations of the same size class.
+    offset = b.offset
+    del b
+    assert pool.stats.free_size == 1024
+    assert pool.free_block_count(2) == 1
+    c = pool.allocate(800)
+    assert c.offset == offset
+    assert pool.stats.free_size == 0
+
+    # Allocations larger than the page size get a large page.
+    d = pool.allocate(100 * 1024)
+    assert d.buffer != a.buffer
+    assert d.offset == 0
+    assert pool.stats.large_page_count == 1
+    del d
+    assert pool.stats.large_page_count == 0
+
+    # The remainder of an exhausted page is put on the free lists.
+    e = pool.allocate(64 * 1024)
+    assert pool.stats.page_count == 2
+    assert pool.stats.free_size == 64 * 1024 - 256 - 1024
+    del a, c, e
+    assert pool.stats.allocation_count == 0
+    assert pool.stats.used_size == 0
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_allocation_struct_size(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    # Blocks are aligned to lcm(256, 12) = 768 bytes, the page is rounded down to 5 blocks.
+    pool = device.create_buffer_pool(page_size=4096, min_block_size=256, struct_size=12)
+    assert pool.block_size(0) == 768
+    assert pool.size_class_count == 3
+
+    a = pool.allocate(3 * 768)
+    b = pool.allocate(3072)
+    assert a.offset == 0 and a.size_class == 2
+    assert b.offset == 0 and b.buffer != a.buffer
+    assert pool.stats.page_count == 2
+    assert pool.stats.total_size == 2 * 3840
+    # The remainder of the first page (768 bytes) is a whole block on the free list.
+    assert pool.stats.free_size == 768
+    assert pool.free_block_count(0) == 1
+    del a, b
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_allocation_binding(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    pool = device.create_buffer_pool(debug_name="test_pool")
+
+    count = 64
+    allocations = [pool.allocate(count * 4) for _ in range(4)]
+    for i, allocation in enumerate(allocations):
+        allocation.set_data(np.arange(count, dtype=np.uint32) * (i + 1))
+
+    copy_kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["copy_byte_address_buffer"])
+    )
+
+    # Copy between allocations in the same backing buffer.
+    copy_kernel.dispatch(
+        thread_count=[count, 1, 1],
+        src=allocations[2].get_srv(),
+        dst=allocations[0].get_uav(),
+        src_offset=0,
+        dst_offset=0,
+        count=count,
+    )
+
+    data = allocations[0].buffer.to_numpy().view(np.uint32)
+    for i, allocation in enumerate(allocations):
+        begin = allocation.offset // 4
+        expected = np.arange(count, dtype=np.uint32) * (3 if i == 0 else i + 1)
+        assert np.all(data[begin : begin + count] == expected)
+
+    # Allocations can be passed to dispatch directly.
+    copy_kernel.dispatch(
+        thread_count=[count, 1, 1],
+        src=allocations[3],
+        dst=allocations[1],
+        src_offset=0,
+        dst_offset=0,
+        count=count,
+    )
+    data = allocations[1].buffer.to_numpy().view(np.uint32)
+    begin = allocations[1].offset // 4
+    assert np.all(data[begin : begin + count] == np.arange(count, dtype=np.uint32) * 4)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -461,6 +461,78 @@ TEST_CASE_GPU("change program and auto detect changes")
     CHECK(!ctx.device->_hot_reload()->last_build_failed());
 }
 
+TEST_CASE_GPU("rewrite program without changes and auto detect changes")
+{
+    // Enable auto detection and wipe any existing monitors to ensure test is from a 'clean slate'.
+    ctx.device->_hot_reload()->set_auto_detect_changes(true);
+    ctx.device->_hot_reload()->set_auto_detect_delay(25);
+    ctx.device->_hot_reload()->_clear_file_watches();
+
+    // Write first version of shader that outputs 1.
+    auto path = testing::get_case_temp_directory() / "detectunchangedprog.slang";
+    write_shader({.path = path, .set_to = "1"});
+
+    // Load program + kernel, and verify returns 1.
+    ref<ShaderProgram> program = ctx.device->load_program(path.string(), {"main"});
+    ref<ComputeKernel> kernel = ctx.device->create_compute_kernel({.program = program});
+    run_and_verify(ctx, kernel, 1);
+
+    // Re-write the shader with identical contents several times, which should not trigger a reload.
+    for (int i = 0; i < 3; i++)
+        write_shader({.path = path, .set_to = "1"});
+    ctx.device->_hot_reload()->_reset_reloaded();
+    for (int i = 0; i < 10; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        ctx.device->_hot_reload()->update();
+    }
+    CHECK(!ctx.device->_hot_reload()->_has_reloaded());
+
+    // Change the shader, which should trigger a reload.
+    write_shader({.path = path, .set_to = "2"});
+    for (int i = 0; i < 20 && !ctx.device->_hot_reload()->_has_reloaded(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        ctx.device->_hot_reload()->update();
+    }
+    CHECK(ctx.device->_hot_reload()->_has_reloaded());
+    CHECK(ctx.device->_hot_reload()->last_changed_files().contains(
+        std::filesystem::absolute(path).lexically_normal().make_preferred()
+    ));
+    run_and_verify(ctx, kernel, 2);
+}
+
+TEST_CASE_GPU("revert program after explicit recreate and auto detect changes")
+{
+    // Start with auto detection disabled, so the first change is picked up by an explicit reload.
+    ctx.device->_hot_reload()->set_auto_detect_changes(false);
+    ctx.device->_hot_reload()->set_auto_detect_delay(25);
+    ctx.device->_hot_reload()->_clear_file_watches();
+
+    // Write first version of shader that outputs 1.
+    auto path = testing::get_case_temp_directory() / "revertprog.slang";
+    write_shader({.path = path, .set_to = "1"});
+
+    // Load program + kernel, and verify returns 1.
+    ref<ShaderProgram> program = ctx.device->load_program(path.string(), {"main"});
+    ref<ComputeKernel> kernel = ctx.device->create_compute_kernel({.program = program});
+    run_and_verify(ctx, kernel, 1);
+
+    // Change the shader and force a reload, verify the result is now 2.
+    write_shader({.path = path, .set_to = "2"});
+    ctx.device->_hot_reload()->recreate_all_sessions();
+    run_and_verify(ctx, kernel, 2);
+
+    // Revert the shader to the first version, which differs from the contents it was last compiled from.
+    ctx.device->_hot_reload()->set_auto_detect_changes(true);
+    write_shader({.path = path, .set_to = "1"});
+    ctx.device->_hot_reload()->_reset_reloaded();
+    for (int i = 0; i < 20 && !ctx.device->_hot_reload()->_has_reloaded(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        ctx.device->_hot_reload()->update();
+    }
+    CHECK(ctx.device->_hot_reload()->_has_reloaded());
+    run_and_verify(ctx, kernel, 1);
+}
+
 /// SKIPPED: This test is flaky on CI, and needs to be reworked.
 TEST_CASE_GPU("create multi directory session and monitor for changes" * doctest::skip())
 {
@@ -554,4 +626,51 @@ TEST_CASE_GPU("create multi directory session and monitor for changes" * doctest
     run_and_verify(ctx, kernel, 20);
 }
 
+TEST_CASE_GPU("only relink programs depending on changed files")
+{
+    // Disable auto detect changes so can test explicit reload.
+    ctx.device->_hot_reload()->set_auto_detect_changes(false);
+
+    // Write two independent shaders, the first importing a module.
+    auto path_a = testing::get_case_temp_directory() / "depa.slang";
+    auto path_b = testing::get_case_temp_directory() / "depb.slang";
+    auto mod_path = testing::get_case_temp_directory() / "depmodule.slang";
+    write_module({.path = mod_path, .set_to = "1"});
+    write_shader({.path = path_a, .set_to = "func()", .imports = {"depmodule"}});
+    write_shader({.path = path_b, .set_to = "1"});
+
+    ref<ComputeKernel> kernel_a = ctx.device->create_compute_kernel({
+        .program = ctx.device->load_program(path_a.string(), {"main"}),
+    });
+    ref<ComputeKernel> kernel_b = ctx.device->create_compute_kernel({
+        .program = ctx.device->load_program(path_b.string(), {"main"}),
+    });
+    run_and_verify(ctx, kernel_a, 1);
+    run_and_verify(ctx, kernel_b, 1);
+
+    // Re-write both files, but only report the imported module as changed.
+    // The first program must be relinked, the second must be left untouched.
+    write_module({.path = mod_path, .set_to = "2"});
+    write_shader({.path = path_b, .set_to = "2"});
+    std::filesystem::path changed_files[] = {mod_path};
+    ctx.device->_hot_reload()->_reset_reloaded();
+    ctx.device->_hot_reload()->recreate_dependent_sessions(changed_files);
+    CHECK(ctx.device->_hot_reload()->_has_reloaded());
+    CHECK(!ctx.device->_hot_reload()->last_build_failed());
+    run_and_verify(ctx, kernel_a, 2);
+    run_and_verify(ctx, kernel_b, 1);
+
+    // Files that no module depends on do not trigger a reload.
+    std::filesystem::path unrelated_files[] = {testing::get_case_temp_directory() / "unrelated.slang"};
+    ctx.device->_hot_reload()->_reset_reloaded();
+    ctx.device->_hot_reload()->recreate_dependent_sessions(unrelated_files);
+    CHECK(!ctx.device->_hot_reload()->_has_reloaded());
+
+    // Reporting the second shader relinks it.
+    std::filesystem::path changed_files_b[] = {path_b};
+    ctx.device->_hot_reload()->recreate_dependent_sessions(changed_files_b);
+    run_and_verify(ctx, kernel_a, 2);
+    run_and_verify(ctx, kernel_b, 2);
+}
+
 TEST_SUITE_END();
@@ -3,6 +3,7 @@
 import pytest
 import sys
 import sgl
+import numpy as np
 from pathlib import Path
 
 sys.path.append(str(Path(__file__).parent))
@@ -54,6 +55,70 @@ def test_allocation(device_type: sgl.DeviceType, memory_type: sgl.MemoryType):
     pass
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_ring_buffer(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    page_size = 1024 * 1024
+    heap = device.create_memory_heap(
+        memory_type=sgl.MemoryType.upload,
+        usage=sgl.ResourceUsage.none,
+        page_size=page_size,
+        ring_buffer=True,
+        debug_name="test_ring_heap",
+    )
+
+    # Ring-buffer heaps only support transient allocations
+    with pytest.raises(Exception):
+        heap.allocate(16)
+
+    a = heap.allocate_transient(page_size // 2)
+    b = heap.allocate_transient(page_size // 2)
+    assert a.buffer == b.buffer
+    assert a.offset == 0
+    assert b.offset == page_size // 2
+    assert heap.stats.page_count == 1
+    assert heap.stats.used_size == 0
+
+    # Exhausting the page retires it and continues on a new page.
+    c = heap.allocate_transient(16)
+    assert c.buffer != a.buffer
+    assert c.offset == 0
+    assert heap.stats.page_count == 2
+    assert heap.stats.used_size == page_size
+
+    # Retired pages are reclaimed once the fence has reached the value of the submit using them.
+    buffer = device.create_buffer(size=16, usage=sgl.ResourceUsage.shader_resource)
+    command_buffer = device.create_command_buffer()
+    command_buffer.copy_buffer_region(buffer, 0, a.buffer, a.offset, 16)
+    submit_id = command_buffer.submit()
+    heap.retire_pages(submit_id)
+    device.wait_command_buffer(submit_id)
+    heap.execute_deferred_releases()
+    assert heap.stats.used_size == 0
+
+    d = heap.allocate_transient(page_size)
+    assert d.buffer == a.buffer
+    assert heap.stats.page_count == 2
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_device_heaps(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+
+    # The device's upload heap supports regular allocations.
+    a = device.upload_heap.allocate(16)
+    assert a.size == 16
+    del a
+
+    # Uploads use a separate ring-buffer heap and keep working across garbage collection.
+    buffer = device.create_buffer(size=1024 * 1024, usage=sgl.ResourceUsage.shader_resource)
+    for i in range(10):
+        data = np.full(256 * 1024, i, dtype=np.uint32)
+        buffer.from_numpy(data)
+        device.run_garbage_collection()
+    assert np.all(buffer.to_numpy().view(np.uint32) == 9)
+
+
 # @run_for_device_types()
 # def test_allocation1(device):
 #     # print(device)
@@ -97,6 +97,75 @@ def test_clear_and_count(device_type: sgl.DeviceType):
     ctx.expect_counts([0, 0, 0, 0])
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_pipeline_cache(device_type: sgl.DeviceType, tmp_path: Path):
+    device = helpers.get_device(type=device_type)
+    device.clear_pipeline_cache()
+    device.record_pipeline_manifest = True
+
+    # Pipelines of identically linked programs share the cached pipeline state.
+    stats = device.pipeline_cache_stats
+    device.create_compute_pipeline(
+        device.load_program("test_pipeline_utils.slang", ["clear"])
+    )
+    device.create_compute_pipeline(
+        device.load_program("test_pipeline_utils.slang", ["clear"])
+    )
+    new_stats = device.pipeline_cache_stats
+    assert new_stats.entry_count == 1
+    assert new_stats.miss_count == stats.miss_count + 1
+    assert new_stats.hit_count == stats.hit_count + 1
+
+    # Save the manifest and use it to warm up the cleared cache.
+    manifest_path = tmp_path / "pipeline_manifest.txt"
+    device.save_pipeline_manifest(manifest_path)
+    device.record_pipeline_manifest = False
+    device.clear_pipeline_cache()
+    assert device.pipeline_cache_stats.entry_count == 0
+    assert device.warm_up_pipeline_cache(manifest_path) >= 1
+    assert device.pipeline_cache_stats.entry_count >= 1
+
+    # The pipeline is now created from the cache.
+    stats = device.pipeline_cache_stats
+    device.create_compute_pipeline(
+        device.load_program("test_pipeline_utils.slang", ["clear"])
+    )
+    assert device.pipeline_cache_stats.hit_count == stats.hit_count + 1
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_pipeline_cache_eviction(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    device.clear_pipeline_cache()
+    capacity = device.pipeline_cache_capacity
+    device.pipeline_cache_capacity = 2
+
+    def create(entry_point: str):
+        device.create_compute_pipeline(
+            device.load_program("test_pipeline_utils.slang", [entry_point])
+        )
+
+    # Using "clear" again makes "count" the least recently used entry.
+    stats = device.pipeline_cache_stats
+    create("clear")
+    create("count")
+    create("clear")
+    create("setcolor")
+    new_stats = device.pipeline_cache_stats
+    assert new_stats.entry_count == 2
+    assert new_stats.eviction_count == stats.eviction_count + 1
+
+    # "clear" is still cached, "count" was evicted.
+    create("clear")
+    assert device.pipeline_cache_stats.hit_count == new_stats.hit_count + 1
+    create("count")
+    assert device.pipeline_cache_stats.miss_count == new_stats.miss_count + 1
+
+    with pytest.raises(Exception):
+        device.pipeline_cache_capacity = 0
+    device.pipeline_cache_capacity = capacity
+
+
 @pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
 def test_compute_set_square(device_type: sgl.DeviceType):
     ctx = PipelineTestContext(device_type)
@@ -102,5 +102,67 @@ float3x3: {{-4.00, -3.00, -1.00}, {+0.00, +1.00, +2.00}, {+3.00, +4.00, +5.00}}
     assert result == expected
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_print_no_wait(device_type: sgl.DeviceType):
+    if sys.platform == "darwin":
+        pytest.skip("Printing double/float64 not supported on macOS")
+
+    device = sgl.Device(type=device_type, enable_print=True)
+
+    def dispatch():
+        helpers.dispatch_compute(
+            device=device,
+            path=Path(__file__).parent / "test_print.slang",
+            entry_point="compute_main",
+            thread_count=[1, 1, 1],
+        )
+
+    # Non-blocking flushes output messages with a latency of two flushes.
+    dispatch()
+    assert device.flush_print_to_string(wait=False) == ""
+    assert device.flush_print_to_string(wait=False) == ""
+    result = device.flush_print_to_string(wait=False)
+    assert result.startswith("Hello World!\n")
+    assert device.flush_print_to_string() == ""
+
+    # Blocking flushes output pending messages in order.
+    dispatch()
+    assert device.flush_print_to_string(wait=False) == ""
+    dispatch()
+    assert device.flush_print_to_string() == result + result
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_print_no_wait_dispatch_sequence(device_type: sgl.DeviceType):
+    if sys.platform == "darwin":
+        pytest.skip("Printing double/float64 not supported on macOS")
+
+    device = sgl.Device(type=device_type, enable_print=True)
+    if sgl.ShaderModel.sm_6_6 > device.supported_shader_model:
+        pytest.skip("Shader model sm_6_6 not supported")
+
+    session = device.create_slang_session({"shader_model": sgl.ShaderModel.sm_6_6})
+    program = session.load_program(
+        module_name=str(Path(__file__).parent / "test_print.slang"),
+        entry_point_names=["compute_main"],
+    )
+    kernel = device.create_compute_kernel(program)
+
+    # The print buffer is bound once into the shader object of the recorded dispatch.
+    sequence = device.create_dispatch_sequence()
+    sequence.record(kernel, thread_count=[1, 1, 1])
+    sequence.submit()
+    expected = device.flush_print_to_string()
+    assert expected.startswith("Hello World!\n")
+
+    # Messages are neither lost nor duplicated when non-blocking flushes switch print buffers.
+    result = ""
+    for _ in range(4):
+        sequence.submit()
+        result += device.flush_print_to_string(wait=False)
+    result += device.flush_print_to_string()
+    assert result == expected * 4
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
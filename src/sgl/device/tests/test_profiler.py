@@ -0,0 +1,98 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import sys
+import json
+import sgl
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent))
+import helpers
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_profiler(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+
+    count = 1024
+    src = device.create_buffer(size=count * 4, usage=sgl.ResourceUsage.shader_resource)
+    dst = device.create_buffer(size=count * 4, usage=sgl.ResourceUsage.unordered_access)
+    kernel = device.create_compute_kernel(
+        device.load_program("test_buffer.slang", ["add_byte_address_buffer"])
+    )
+
+    profiler = device.create_profiler(latency=2, queries_per_pool=4)
+
+    # Scopes can only be recorded within a frame.
+    with pytest.raises(Exception):
+        profiler.begin_cpu_scope("outside")
+
+    frame_count = 5
+    for i in range(frame_count):
+        # All previous frames have finished on the GPU and are resolved without blocking.
+        device.wait_for_idle()
+        profiler.begin_frame()
+        assert profiler.scope_stats("frame").count == i
+        with profiler.scope("update"):
+            command_buffer = device.create_command_buffer()
+            with profiler.scope("frame", command_buffer):
+                # Nested scopes exceed the queries of a single pool.
+                for name in ["a", "b"]:
+                    with profiler.scope(name, command_buffer):
+                        kernel.dispatch(
+                            thread_count=[count, 1, 1],
+                            vars={"g_src": src, "g_dst": dst, "g_add": 1, "g_count": count},
+                            command_buffer=command_buffer,
+                        )
+            command_buffer.submit()
+        profiler.end_frame()
+
+    # The last frame is only resolved by the next begin_frame or flush.
+    assert profiler.scope_stats("frame").count == frame_count - 1
+    profiler.flush()
+
+    names = {(s.name, s.gpu) for s in profiler.stats}
+    assert names == {("update", False), ("frame", True), ("frame/a", True), ("frame/b", True)}
+
+    for name, gpu in names:
+        stats = profiler.scope_stats(name, gpu)
+        assert stats.count == frame_count
+        assert 0.0 <= stats.min_ms <= stats.average_ms <= stats.max_ms
+
+    frame = profiler.scope_stats("frame")
+    a = profiler.scope_stats("frame/a")
+    b = profiler.scope_stats("frame/b")
+    assert frame.max_ms >= a.min_ms + b.min_ms
+
+    assert profiler.scope_stats("unknown").count == 0
+
+    # Trace contains frame markers, CPU and GPU scopes.
+    trace = json.loads(profiler.trace_json())
+    events = [e for e in trace["traceEvents"] if e["ph"] == "X"]
+    assert len([e for e in events if e["name"].startswith("frame ")]) == frame_count
+    assert len([e for e in events if e["cat"] == "cpu" and e["name"] == "update"]) == frame_count
+    assert len([e for e in events if e["cat"] == "gpu"]) == 3 * frame_count
+
+    profiler.reset_stats()
+    assert len(profiler.stats) == 0
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_profiler_unbalanced_scopes(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    profiler = device.create_profiler()
+
+    profiler.begin_frame()
+    with pytest.raises(Exception):
+        profiler.end_cpu_scope()
+    profiler.begin_cpu_scope("open")
+    with pytest.raises(Exception):
+        profiler.end_frame()
+    profiler.end_cpu_scope()
+    profiler.end_frame()
+    profiler.flush()
+    assert profiler.scope_stats("open", gpu=False).count == 1
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
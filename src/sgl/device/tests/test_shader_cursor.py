@@ -233,7 +233,8 @@ def convert_matrix(type: str, rows: int, cols: int, values: Any):
 
 @pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
 @pytest.mark.parametrize("use_numpy", [False, True])
-def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool):
+@pytest.mark.parametrize("use_path", [False, True])
+def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool, use_path: bool):
     if sys.platform == "darwin":
         pytest.skip("Test shader doesn't currently compile on MoltenVK")
 
@@ -304,7 +305,10 @@ def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool):
         sizes.append(size)
         references.append(struct.pack(struct_pattern, *flat_value).hex())
 
-        cursor[name_or_index] = value
+        if use_path:
+            sgl.ShaderCursorPath(root_cursor, name).set(shader_object, value)
+        else:
+            cursor[name_or_index] = value
 
     def write_vars(
         cursor: sgl.ShaderCursor,
@@ -331,9 +335,9 @@ def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool):
     command_buffer = device.create_command_buffer()
     with command_buffer.encode_compute_commands() as encoder:
         shader_object = encoder.bind_pipeline(kernel.pipeline)
-        cursor = sgl.ShaderCursor(shader_object)
-        cursor["results"] = result_buffer
-        write_vars(cursor, TEST_VARS)
+        root_cursor = sgl.ShaderCursor(shader_object)
+        root_cursor["results"] = result_buffer
+        write_vars(root_cursor, TEST_VARS)
         encoder.dispatch(thread_count=[1, 1, 1])
     command_buffer.submit()
 
@@ -355,5 +359,76 @@ def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool):
         assert named_result == named_reference
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_shader_cursor_path(device_type: sgl.DeviceType):
+    if sys.platform == "darwin":
+        pytest.skip("Test shader doesn't currently compile on MoltenVK")
+
+    device = helpers.get_device(type=device_type)
+
+    program = device.load_program("test_shader_cursor.slang", ["main"])
+    kernel = device.create_compute_kernel(program)
+
+    command_buffer = device.create_command_buffer()
+    with command_buffer.encode_compute_commands() as encoder:
+        shader_object = encoder.bind_pipeline(kernel.pipeline)
+        cursor = sgl.ShaderCursor(shader_object)
+
+        path = sgl.ShaderCursorPath(cursor, "u_struct_array[2].f_float")
+        assert path.is_valid()
+        assert path.path == "u_struct_array[2].f_float"
+        offset = cursor["u_struct_array"][2]["f_float"].offset
+        assert path.offset.uniform_offset == offset.uniform_offset
+        assert path.offset.binding_range_index == offset.binding_range_index
+        assert path.offset.binding_array_index == offset.binding_array_index
+
+        resolved = path.resolve(shader_object)
+        assert resolved.offset.uniform_offset == offset.uniform_offset
+
+        # Type checks use the cached type information.
+        with pytest.raises(Exception):
+            path.set(shader_object, sgl.float2(1, 2))
+
+        # Invalid paths.
+        for invalid_path in [
+            "u_struct_array[2].missing",
+            "u_struct_array[2",
+            "u_struct_array[x]",
+            "u_struct_array..f_float",
+            ".u_int",
+        ]:
+            with pytest.raises(Exception):
+                sgl.ShaderCursorPath(cursor, invalid_path)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_shader_cursor_path_program_reload(device_type: sgl.DeviceType):
+    if sys.platform == "darwin":
+        pytest.skip("Test shader doesn't currently compile on MoltenVK")
+
+    device = helpers.get_device(type=device_type)
+
+    program = device.load_program("test_shader_cursor.slang", ["main"])
+    kernel = device.create_compute_kernel(program)
+
+    command_buffer = device.create_command_buffer()
+    with command_buffer.encode_compute_commands() as encoder:
+        shader_object = encoder.bind_pipeline(kernel.pipeline)
+        path = sgl.ShaderCursorPath(sgl.ShaderCursor(shader_object), "u_struct_array[2].f_float")
+        path.set(shader_object, 1.0)
+
+        # Paths can be reused with objects of later binds of the same program.
+        path.set(encoder.bind_pipeline(kernel.pipeline), 2.0)
+
+    # After a reload, the path no longer matches the shader objects of the program.
+    device.reload_all_programs()
+    with command_buffer.encode_compute_commands() as encoder:
+        shader_object = encoder.bind_pipeline(kernel.pipeline)
+        with pytest.raises(Exception, match="was the program reloaded"):
+            path.set(shader_object, 3.0)
+        path = sgl.ShaderCursorPath(sgl.ShaderCursor(shader_object), "u_struct_array[2].f_float")
+        path.set(shader_object, 3.0)
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
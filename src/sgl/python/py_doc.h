@@ -1657,6 +1657,8 @@ static const char *__doc_sgl_Bitmap_Bitmap_4 = R"doc(Copy constructor.)doc";
 
 static const char *__doc_sgl_Bitmap_Bitmap_5 = R"doc(Move constructor.)doc";
 
+static const char *__doc_sgl_Bitmap_BlockSink = R"doc(Receives decoded rows when reading an image in blocks (see ``read_blocks``).)doc";
+
 static const char *__doc_sgl_Bitmap_FileFormat = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_FileFormat_auto = R"doc()doc";
@@ -1703,6 +1705,46 @@ static const char *__doc_sgl_Bitmap_PixelFormat_y = R"doc(Luminance only.)doc";
 
 static const char *__doc_sgl_Bitmap_PixelFormat_ya = R"doc(Luminance + alpha.)doc";
 
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions = R"doc(Options for ``Bitmap::read_blocks``.)doc";
+
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions_ReadBlocksOptions = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions_block_height =
+R"doc(Number of image rows decoded per block (rounded up to a multiple of
+``downsample`` and the tile height).)doc";
+
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions_downsample =
+R"doc(Downsampling factor. Each output pixel is the average of a box of
+``downsample`` x ``downsample`` pixels.)doc";
+
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions_format = R"doc(File format (detected automatically by default).)doc";
+
+static const char *__doc_sgl_Bitmap_ReadBlocksOptions_region = R"doc(Region of the image to read in image pixels (reads the full image if not set).)doc";
+
+static const char *__doc_sgl_Bitmap_Region = R"doc(Rectangular region of a bitmap in pixels.)doc";
+
+static const char *__doc_sgl_Bitmap_Region_height = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_Region_width = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_Region_x = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_Region_y = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions = R"doc(Options for ``Bitmap::transform``.)doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions_TransformOptions = R"doc()doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions_flip_y = R"doc(Flip the rows vertically while converting.)doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions_region = R"doc(Region of the bitmap to convert (converts the full bitmap if not set).)doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions_row_alignment = R"doc(Row alignment of the destination in bytes (only used if ``row_pitch`` is 0).)doc";
+
+static const char *__doc_sgl_Bitmap_TransformOptions_row_pitch =
+R"doc(Row pitch of the destination in bytes (0 to use tightly packed rows
+aligned to ``row_alignment``).)doc";
+
 static const char *__doc_sgl_Bitmap_buffer_size = R"doc(The total size of the bitmap in bytes.)doc";
 
 static const char *__doc_sgl_Bitmap_bytes_per_pixel = R"doc(The number of bytes per pixel.)doc";
@@ -1735,6 +1777,10 @@ static const char *__doc_sgl_Bitmap_detect_file_format = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_empty = R"doc(True if bitmap is empty.)doc";
 
+static const char *__doc_sgl_Bitmap_exr_thread_count = R"doc(The maximum number of threads used for encoding/decoding a single OpenEXR image.)doc";
+
+static const char *__doc_sgl_Bitmap_get_region = R"doc(Validate a region of the bitmap (returns the full bitmap if none is specified).)doc";
+
 static const char *__doc_sgl_Bitmap_has_alpha = R"doc(Returns true if the bitmap has an alpha channel.)doc";
 
 static const char *__doc_sgl_Bitmap_height = R"doc(The height of the bitmap in pixels.)doc";
@@ -1767,6 +1813,26 @@ static const char *__doc_sgl_Bitmap_pixel_struct = R"doc(Struct describing the p
 
 static const char *__doc_sgl_Bitmap_read = R"doc()doc";
 
+static const char *__doc_sgl_Bitmap_read_blocks =
+R"doc(Read an image in blocks of rows using bounded memory.
+
+PNG (non-interlaced) and OpenEXR (scanline and tiled) images are
+decoded incrementally, only keeping a single block of rows in memory.
+Other formats are decoded in full and then passed to the callback in
+blocks. Decoding can be overlapped with processing and upload by
+handing the blocks to other threads from within the callback.
+
+Parameter ``stream``:
+    Stream to read from.
+
+Parameter ``callback``:
+    Callback receiving the blocks of rows in order.
+
+Parameter ``options``:
+    Read options.)doc";
+
+static const char *__doc_sgl_Bitmap_read_blocks_2 = R"doc(Read an image file in blocks of rows using bounded memory. See ``read_blocks``.)doc";
+
 static const char *__doc_sgl_Bitmap_read_bmp = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_read_exr = R"doc()doc";
@@ -1785,6 +1851,17 @@ static const char *__doc_sgl_Bitmap_read_tga = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_rebuild_pixel_struct = R"doc()doc";
 
+static const char *__doc_sgl_Bitmap_set_exr_thread_count =
+R"doc(Set the maximum number of threads used for encoding/decoding a single
+OpenEXR image.
+
+OpenEXR line buffer and tile tasks run on the global thread pool. A
+count of zero disables multi-threaded encoding/decoding. Defaults to
+the number of threads of the global thread pool. Images read from
+within tasks on the global thread pool (e.g. by ``read_multiple``) are
+always decoded on a single thread, as they are already processed in
+parallel.)doc";
+
 static const char *__doc_sgl_Bitmap_set_srgb_gamma =
 R"doc(Set the sRGB gamma flag. Note that this does not convert the pixel
 values, it only sets the flag and adjusts the pixel struct.)doc";
@@ -1816,6 +1893,32 @@ static const char *__doc_sgl_Bitmap_static_shutdown = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_to_string = R"doc()doc";
 
+static const char *__doc_sgl_Bitmap_transform =
+R"doc(Convert the bitmap into a destination buffer in a single pass.
+
+Pixels are converted to the layout described by ``dst_struct`` and
+written row by row directly into ``dst`` (e.g. a mapped upload
+buffer). Vertical flipping, destination row pitch and the region of
+interest are applied during the conversion, avoiding intermediate
+copies. Missing channels are derived in the same way as in
+``convert``.
+
+Parameter ``dst``:
+    Destination buffer.
+
+Parameter ``dst_size``:
+    Size of the destination buffer in bytes.
+
+Parameter ``dst_struct``:
+    Struct describing the destination pixel layout.
+
+Parameter ``options``:
+    Transform options.)doc";
+
+static const char *__doc_sgl_Bitmap_transform_row_pitch = R"doc(Row pitch in bytes of the destination buffer written by ``transform``.)doc";
+
+static const char *__doc_sgl_Bitmap_transform_size = R"doc(Size in bytes of the destination buffer required by ``transform``.)doc";
+
 static const char *__doc_sgl_Bitmap_uint8_data = R"doc(The raw image data as uint8_t.)doc";
 
 static const char *__doc_sgl_Bitmap_uint8_data_2 = R"doc()doc";
@@ -2020,6 +2123,161 @@ size of the struct.)doc";
 
 static const char *__doc_sgl_BufferDesc_usage = R"doc(Resource usage flags.)doc";
 
+static const char *__doc_sgl_BufferPool =
+R"doc(A buffer pool is used to suballocate persistent device-local memory.
+
+Creating a separate buffer for every small constant or structured
+buffer is costly. A buffer pool instead carves allocations out of
+large backing buffers (pages) of size ``page_size``.
+
+Allocations are rounded up to a power-of-two multiple of
+``min_block_size`` (the size class). Released blocks are put on a free
+list per size class and reused by later allocations of the same class.
+New blocks are carved from the current page. When the current page is
+exhausted, its remaining space is split into blocks of smaller size
+classes and a new page is allocated. For allocations larger than the
+largest size class, a new large page is allocated, which is released
+together with the allocation.
+
+Released blocks are reused immediately. This is safe because device-
+local memory is only accessed by commands on the device queue, which
+execute in submission order (data written with ``set_data`` is copied
+on the device queue as well).
+
+Allocations are returned as unique pointers. When the pointer is
+destroyed, the allocation is released. An allocation refers to a range
+of its backing buffer and can be bound to shaders through the resource
+views returned by ``get_srv`` and ``get_uav``.)doc";
+
+static const char *__doc_sgl_BufferPoolDesc = R"doc()doc";
+
+static const char *__doc_sgl_BufferPoolDesc_debug_name = R"doc(The debug name of the pool.)doc";
+
+static const char *__doc_sgl_BufferPoolDesc_format = R"doc(The format of the backing buffers (for typed buffer views).)doc";
+
+static const char *__doc_sgl_BufferPoolDesc_min_block_size =
+R"doc(The size of the smallest size class in bytes. This is also the
+alignment of all allocations.)doc";
+
+static const char *__doc_sgl_BufferPoolDesc_page_size =
+R"doc(The size of a page in bytes. Rounded down to a multiple of the
+smallest block size (see min_block_size and struct_size).)doc";
+
+static const char *__doc_sgl_BufferPoolDesc_struct_size =
+R"doc(The struct size of the backing buffers (for structured buffer views).
+Allocations are aligned to a multiple of the struct size.)doc";
+
+static const char *__doc_sgl_BufferPoolDesc_usage = R"doc(The resource usage of the backing buffers.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_buffer = R"doc(The buffer this allocation belongs to.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_device_address = R"doc(The device address of the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_get_srv = R"doc(Get a shader resource view for the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_get_uav = R"doc(Get an unordered access view for the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_offset = R"doc(The offset of the allocation within the buffer.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_page_index =
+R"doc(The page where the allocation is stored (``LARGE_PAGE`` for
+allocations in a large page).)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_pool = R"doc(The pool this allocation belongs to.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_range = R"doc(The range of the allocation within the buffer.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_set_data =
+R"doc(Set allocation data from host memory.
+
+Parameter ``data``:
+    Data to write.
+
+Parameter ``size``:
+    Size of the data in bytes.
+
+Parameter ``offset``:
+    Offset relative to the start of the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_size = R"doc(The size of the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_AllocationData_size_class =
+R"doc(The size class of the allocation (unused for allocations in a large
+page).)doc";
+
+static const char *__doc_sgl_BufferPool_Block = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_Block_offset = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_Block_page_index = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_BufferPool = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_BufferPool_2 = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_Stats = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_Stats_allocated_size = R"doc(The size of all live allocations rounded up to their size class.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_allocation_count = R"doc(The number of live allocations.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_fragmentation =
+R"doc(Fraction of the allocated and free-listed memory that is not used by
+allocations.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_free_size = R"doc(The size of all blocks in the free lists.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_large_page_count = R"doc(The number of large pages in the pool.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_page_count = R"doc(The number of pages in the pool.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_total_size = R"doc(The total size of all pages.)doc";
+
+static const char *__doc_sgl_BufferPool_Stats_used_size = R"doc(The requested size of all live allocations.)doc";
+
+static const char *__doc_sgl_BufferPool_add_free_range = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_allocate =
+R"doc(Allocate memory from this pool.
+
+Parameter ``size``:
+    The number of bytes to allocate.
+
+Returns:
+    Returns a unique pointer to the allocation.)doc";
+
+static const char *__doc_sgl_BufferPool_block_size = R"doc(Block size of a size class in bytes.)doc";
+
+static const char *__doc_sgl_BufferPool_create_page_buffer = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_desc = R"doc(Description of the pool.)doc";
+
+static const char *__doc_sgl_BufferPool_free_block_count = R"doc(Number of free blocks of a size class.)doc";
+
+static const char *__doc_sgl_BufferPool_get_size_class = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_m_block_size = R"doc(Size of the smallest size class.)doc";
+
+static const char *__doc_sgl_BufferPool_m_current_offset = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_m_desc = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_m_free_lists = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_m_pages = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_m_stats = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_release = R"doc()doc";
+
+static const char *__doc_sgl_BufferPool_size_class_count = R"doc(Number of size classes.)doc";
+
+static const char *__doc_sgl_BufferPool_stats = R"doc(Statistics of the pool.)doc";
+
+static const char *__doc_sgl_BufferPool_to_string = R"doc()doc";
+
 static const char *__doc_sgl_BufferRange = R"doc()doc";
 
 static const char *__doc_sgl_BufferRange_offset = R"doc()doc";
@@ -2113,6 +2371,18 @@ static const char *__doc_sgl_Buffer_unmap = R"doc(Unmap the buffer.)doc";
 
 static const char *__doc_sgl_CommandBuffer = R"doc()doc";
 
+static const char *__doc_sgl_CommandBuffer_BarrierBatch =
+R"doc(Barriers with the same state transition, collected by
+``set_resource_view_states``.)doc";
+
+static const char *__doc_sgl_CommandBuffer_BarrierBatch_after = R"doc()doc";
+
+static const char *__doc_sgl_CommandBuffer_BarrierBatch_before = R"doc()doc";
+
+static const char *__doc_sgl_CommandBuffer_BarrierBatch_buffers = R"doc()doc";
+
+static const char *__doc_sgl_CommandBuffer_BarrierBatch_textures = R"doc()doc";
+
 static const char *__doc_sgl_CommandBuffer_CommandBuffer = R"doc()doc";
 
 static const char *__doc_sgl_CommandBuffer_EncoderType = R"doc()doc";
@@ -2290,6 +2560,8 @@ static const char *__doc_sgl_CommandBuffer_is_open = R"doc(True if the command b
 
 static const char *__doc_sgl_CommandBuffer_m_active_gfx_encoder = R"doc()doc";
 
+static const char *__doc_sgl_CommandBuffer_m_barrier_batches = R"doc()doc";
+
 static const char *__doc_sgl_CommandBuffer_m_cuda_interop_buffers = R"doc()doc";
 
 static const char *__doc_sgl_CommandBuffer_m_encoder_open = R"doc()doc";
@@ -2400,6 +2672,18 @@ Parameter ``new_state``:
 Returns:
     True if barrier was recorded (i.e. state has changed).)doc";
 
+static const char *__doc_sgl_CommandBuffer_set_resource_view_states =
+R"doc(Transition the resources of a list of shader resource and unordered
+access views for shader access. Shader resource views are transitioned
+to ``ResourceState::shader_resource``, unordered access views to
+``ResourceState::unordered_access``. Unordered access views already in
+that state get a UAV barrier. Resources referenced by multiple views
+get a single transition to the state of the last view. Barriers on
+entire resources are batched into a single call per state transition.
+
+Parameter ``resource_views``:
+    Resource views.)doc";
+
 static const char *__doc_sgl_CommandBuffer_set_texture_state =
 R"doc(Transition resource state of a texture and add a barrier if state has
 changed.
@@ -2598,6 +2882,8 @@ static const char *__doc_sgl_ConsoleLoggerOutput_ConsoleLoggerOutput = R"doc()do
 
 static const char *__doc_sgl_ConsoleLoggerOutput_enable_ansi_control_sequences = R"doc()doc";
 
+static const char *__doc_sgl_ConsoleLoggerOutput_flush = R"doc()doc";
+
 static const char *__doc_sgl_ConsoleLoggerOutput_m_colored = R"doc()doc";
 
 static const char *__doc_sgl_ConsoleLoggerOutput_to_string = R"doc()doc";
@@ -2648,9 +2934,18 @@ static const char *__doc_sgl_CullMode_none = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile = R"doc(Helper class for loading DDS files.)doc";
 
-static const char *__doc_sgl_DDSFile_DDSFile = R"doc()doc";
+static const char *__doc_sgl_DDSFile_DDSFile = R"doc(Load a DDS file from a stream. The file is read into memory.)doc";
+
+static const char *__doc_sgl_DDSFile_DDSFile_2 =
+R"doc(Load a DDS file from disk.
 
-static const char *__doc_sgl_DDSFile_DDSFile_2 = R"doc()doc";
+Parameter ``path``:
+    File path.
+
+Parameter ``memory_mapped``:
+    If true, the file is memory mapped and ``data()``,
+    ``resource_data()`` and ``get_subresource_data()`` point directly
+    into the mapping instead of into a copy of the file.)doc";
 
 static const char *__doc_sgl_DDSFile_DDSFile_3 = R"doc()doc";
 
@@ -2729,8 +3024,12 @@ static const char *__doc_sgl_DDSFile_m_header_size = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_m_height = R"doc()doc";
 
+static const char *__doc_sgl_DDSFile_m_mapped_file = R"doc()doc";
+
 static const char *__doc_sgl_DDSFile_m_mip_count = R"doc()doc";
 
+static const char *__doc_sgl_DDSFile_m_owned_data = R"doc()doc";
+
 static const char *__doc_sgl_DDSFile_m_row_pitch = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_m_size = R"doc()doc";
@@ -2743,12 +3042,16 @@ static const char *__doc_sgl_DDSFile_m_type = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_m_width = R"doc()doc";
 
+static const char *__doc_sgl_DDSFile_memory_mapped = R"doc(True if the file data is memory mapped.)doc";
+
 static const char *__doc_sgl_DDSFile_mip_count = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_operator_assign = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_operator_assign_2 = R"doc()doc";
 
+static const char *__doc_sgl_DDSFile_read = R"doc()doc";
+
 static const char *__doc_sgl_DDSFile_resource_data = R"doc()doc";
 
 static const char *__doc_sgl_DDSFile_resource_size = R"doc()doc";
@@ -2776,9 +3079,36 @@ static const char *__doc_sgl_DebugConsoleLoggerOutput_write = R"doc()doc";
 static const char *__doc_sgl_DebugPrinter =
 R"doc(Debug printer.
 
-This class implements host-side support for shader debug printing.)doc";
+This class implements host-side support for shader debug printing.
+
+The print buffer is split into two halves that are used alternately.
+The active half is stored in the buffer header and read by the shader,
+so print buffer bindings in persistent shader objects stay valid.
+Flushing only reads back the used part of a half, by first reading
+back the size of the written data and then copying the data itself.
+Non-blocking flushes switch to the other half and output the messages
+of earlier flushes once they are available, which avoids stalling on
+the GPU (messages are output with a latency of two flushes).)doc";
 
-static const char *__doc_sgl_DebugPrinter_DebugPrinter = R"doc()doc";
+static const char *__doc_sgl_DebugPrinter_DebugPrinter =
+R"doc(Constructor.
+
+Parameter ``device``:
+    Device.
+
+Parameter ``buffer_size``:
+    Total size of both halves of the print buffer in bytes (multiple of
+    32).)doc";
+
+static const char *__doc_sgl_DebugPrinter_PrintBuffer = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_PrintBuffer_data_request = R"doc(Pending read-back of the written data.)doc";
+
+static const char *__doc_sgl_DebugPrinter_PrintBuffer_offset = R"doc(Offset of the half in the print buffer.)doc";
+
+static const char *__doc_sgl_DebugPrinter_PrintBuffer_size = R"doc(Size of the half in bytes.)doc";
+
+static const char *__doc_sgl_DebugPrinter_PrintBuffer_size_request = R"doc(Pending read-back of the size of the written data.)doc";
 
 static const char *__doc_sgl_DebugPrinter_add_hashed_strings =
 R"doc(Add a map of hashed strings to the printer. This needs to be called
@@ -2786,19 +3116,43 @@ for any shader that uses debug printing.)doc";
 
 static const char *__doc_sgl_DebugPrinter_bind = R"doc()doc";
 
-static const char *__doc_sgl_DebugPrinter_flush = R"doc(Flush the print buffer and output any messages to stdout.)doc";
+static const char *__doc_sgl_DebugPrinter_flush =
+R"doc(Flush the print buffer and output any messages to stdout.
 
-static const char *__doc_sgl_DebugPrinter_flush_device = R"doc()doc";
+Parameter ``wait``:
+    If true, block until all messages are available. Otherwise don't
+    wait for pending GPU work and output the messages of earlier
+    flushes instead.)doc";
 
-static const char *__doc_sgl_DebugPrinter_flush_to_string = R"doc(Flush the print buffer and output any messages as a string.)doc";
+static const char *__doc_sgl_DebugPrinter_flush_buffers = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_flush_to_string =
+R"doc(Flush the print buffer and output any messages as a string.
+
+Parameter ``wait``:
+    If true, block until all messages are available. Otherwise don't
+    wait for pending GPU work and output the messages of earlier
+    flushes instead.)doc";
 
 static const char *__doc_sgl_DebugPrinter_m_buffer = R"doc()doc";
 
+static const char *__doc_sgl_DebugPrinter_m_current = R"doc(Index of the active half of the print buffer.)doc";
+
+static const char *__doc_sgl_DebugPrinter_m_data = R"doc(Host copy of read-back data.)doc";
+
 static const char *__doc_sgl_DebugPrinter_m_device = R"doc()doc";
 
 static const char *__doc_sgl_DebugPrinter_m_hashed_strings = R"doc()doc";
 
-static const char *__doc_sgl_DebugPrinter_m_readback_buffer = R"doc()doc";
+static const char *__doc_sgl_DebugPrinter_m_print_buffers = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_read_data = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_request_data = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_request_size = R"doc()doc";
+
+static const char *__doc_sgl_DebugPrinter_set_active = R"doc()doc";
 
 static const char *__doc_sgl_DeclReflection = R"doc()doc";
 
@@ -3020,12 +3374,31 @@ static const char *__doc_sgl_Device_DeferredRelease_object = R"doc()doc";
 
 static const char *__doc_sgl_Device_Device = R"doc()doc";
 
+static const char *__doc_sgl_Device_PipelineCacheEntry = R"doc()doc";
+
+static const char *__doc_sgl_Device_PipelineCacheEntry_dependencies = R"doc()doc";
+
+static const char *__doc_sgl_Device_PipelineCacheEntry_last_use =
+R"doc(Value of the use counter at the last lookup (for least recently used
+eviction).)doc";
+
+static const char *__doc_sgl_Device_PipelineCacheEntry_pipeline_state = R"doc()doc";
+
 static const char *__doc_sgl_Device_begin_shared_command_buffer = R"doc()doc";
 
 static const char *__doc_sgl_Device_blitter = R"doc()doc";
 
 static const char *__doc_sgl_Device_class_name = R"doc()doc";
 
+static const char *__doc_sgl_Device_clear_pipeline_cache =
+R"doc(Clear the pipeline cache.
+
+Compute and graphics pipelines share the underlying pipeline state if
+they are created from programs with the same hash (see
+ShaderProgram::hash) and the same state. Pipeline states are kept in
+the cache until it is cleared, the device is closed or they are
+evicted (see pipeline_cache_capacity).)doc";
+
 static const char *__doc_sgl_Device_close =
 R"doc(Close the device.
 
@@ -3086,12 +3459,24 @@ Parameter ``data_size``:
 Returns:
     New buffer object.)doc";
 
+static const char *__doc_sgl_Device_create_buffer_pool = R"doc(Create a pool for suballocating persistent device-local buffer memory.)doc";
+
 static const char *__doc_sgl_Device_create_command_buffer = R"doc()doc";
 
 static const char *__doc_sgl_Device_create_compute_kernel = R"doc()doc";
 
+static const char *__doc_sgl_Device_create_compute_kernel_async =
+R"doc(Create a compute kernel (including its pipeline) on the global thread
+pool.)doc";
+
 static const char *__doc_sgl_Device_create_compute_pipeline = R"doc()doc";
 
+static const char *__doc_sgl_Device_create_compute_pipeline_async = R"doc(Create a compute pipeline on the global thread pool.)doc";
+
+static const char *__doc_sgl_Device_create_dispatch_sequence =
+R"doc(Create an empty sequence for recording and re-submitting compute
+dispatches.)doc";
+
 static const char *__doc_sgl_Device_create_fence =
 R"doc(Create a new fence.
 
@@ -3140,6 +3525,8 @@ static const char *__doc_sgl_Device_create_mutable_shader_object_2 = R"doc()doc"
 
 static const char *__doc_sgl_Device_create_mutable_shader_object_3 = R"doc()doc";
 
+static const char *__doc_sgl_Device_create_profiler = R"doc(Create a scoped CPU/GPU profiler.)doc";
+
 static const char *__doc_sgl_Device_create_query_pool =
 R"doc(Create a new query pool.
 
@@ -3329,15 +3716,36 @@ Python interpreter to be stored on the same drive as the sgl library.
 Returns:
     Return true if D3D12 Agility SDK was successfully enabled.)doc";
 
-static const char *__doc_sgl_Device_end_shared_command_buffer = R"doc()doc";
+static const char *__doc_sgl_Device_end_shared_command_buffer =
+R"doc(End recording to the shared command buffer and submit it. The currently
+open command buffer (if not the shared one) is only submitted if
+``wait`` or ``submit`` is set. Returns the submission ID (or 0 if
+nothing was submitted).)doc";
 
 static const char *__doc_sgl_Device_enumerate_adapters = R"doc(Enumerates all available adapters of a given device type.)doc";
 
+static const char *__doc_sgl_Device_evict_pipeline_cache_entries =
+R"doc(Evict least recently used entries until the cache fits its capacity.
+Evicted pipeline states are appended to ``evicted``, so they can be
+released outside of the lock.)doc";
+
 static const char *__doc_sgl_Device_features = R"doc(List of features supported by the device.)doc";
 
-static const char *__doc_sgl_Device_flush_print = R"doc(Block and flush all shader side debug print output.)doc";
+static const char *__doc_sgl_Device_flush_print =
+R"doc(Flush all shader side debug print output.
+
+Parameter ``wait``:
+    If true, block until all output is available. Otherwise don't wait
+    for pending GPU work and print the output of earlier flushes
+    instead.)doc";
+
+static const char *__doc_sgl_Device_flush_print_to_string =
+R"doc(Flush all shader side debug print output to a string.
 
-static const char *__doc_sgl_Device_flush_print_to_string = R"doc(Block and flush all shader side debug print output to a string.)doc";
+Parameter ``wait``:
+    If true, block until all output is available. Otherwise don't wait
+    for pending GPU work and return the output of earlier flushes
+    instead.)doc";
 
 static const char *__doc_sgl_Device_get_acceleration_structure_prebuild_info = R"doc()doc";
 
@@ -3351,6 +3759,11 @@ static const char *__doc_sgl_Device_get_native_handle =
 R"doc(Returns the native API handle: - D3D12: ID3D12Device* (0) - Vulkan:
 VkInstance (0), VkPhysicalDevice (1), VkDevice (2))doc";
 
+static const char *__doc_sgl_Device_get_or_create_pipeline_state =
+R"doc(Internal: look up a pipeline state in the pipeline cache, or create and
+add it. The cache keeps the given dependencies (e.g. layouts identified
+by the key) alive.)doc";
+
 static const char *__doc_sgl_Device_get_or_create_transient_resource_heap = R"doc()doc";
 
 static const char *__doc_sgl_Device_gfx_device = R"doc()doc";
@@ -3380,6 +3793,10 @@ static const char *__doc_sgl_Device_load_module_from_source = R"doc()doc";
 
 static const char *__doc_sgl_Device_load_program = R"doc()doc";
 
+static const char *__doc_sgl_Device_load_program_async =
+R"doc(Load a program on the global thread pool (see
+SlangSession::load_program_async).)doc";
+
 static const char *__doc_sgl_Device_m_blitter = R"doc()doc";
 
 static const char *__doc_sgl_Device_m_closed = R"doc()doc";
@@ -3418,8 +3835,22 @@ static const char *__doc_sgl_Device_m_open_command_buffer =
 R"doc(Currently open command buffer. Due to limitations in gfx, only one
 command buffer can be open at a time.)doc";
 
+static const char *__doc_sgl_Device_m_pipeline_cache = R"doc()doc";
+
+static const char *__doc_sgl_Device_m_pipeline_cache_capacity = R"doc()doc";
+
+static const char *__doc_sgl_Device_m_pipeline_cache_mutex = R"doc()doc";
+
+static const char *__doc_sgl_Device_m_pipeline_cache_stats = R"doc()doc";
+
+static const char *__doc_sgl_Device_m_pipeline_cache_use_counter = R"doc()doc";
+
+static const char *__doc_sgl_Device_m_pipeline_manifest = R"doc(Serialized manifest entries (one per line in the manifest file).)doc";
+
 static const char *__doc_sgl_Device_m_read_back_heap = R"doc()doc";
 
+static const char *__doc_sgl_Device_m_record_pipeline_manifest = R"doc()doc";
+
 static const char *__doc_sgl_Device_m_shader_cache_enabled = R"doc()doc";
 
 static const char *__doc_sgl_Device_m_shader_cache_path = R"doc()doc";
@@ -3434,8 +3865,17 @@ static const char *__doc_sgl_Device_m_supports_cuda_interop = R"doc()doc";
 
 static const char *__doc_sgl_Device_m_transient_resource_heap_pool = R"doc(Transient resource heaps available for reuse.)doc";
 
+static const char *__doc_sgl_Device_m_transient_upload_heap = R"doc(Ring-buffer heap used for uploads recorded to the shared command buffer.)doc";
+
 static const char *__doc_sgl_Device_m_upload_heap = R"doc()doc";
 
+static const char *__doc_sgl_Device_pipeline_cache_capacity =
+R"doc(Maximum number of pipeline states kept in the pipeline cache. The least
+recently used pipeline states are evicted when the cache exceeds this
+size.)doc";
+
+static const char *__doc_sgl_Device_pipeline_cache_stats = R"doc(Pipeline cache statistics.)doc";
+
 static const char *__doc_sgl_Device_read_back_heap = R"doc()doc";
 
 static const char *__doc_sgl_Device_read_buffer_data =
@@ -3454,6 +3894,22 @@ Parameter ``size``:
 Parameter ``offset``:
     Offset in the buffer to read from.)doc";
 
+static const char *__doc_sgl_Device_read_buffer_data_async =
+R"doc(Read buffer data to host memory without blocking. The copy is submitted
+immediately, the returned request can be polled or waited on.
+
+Parameter ``buffer``:
+    Buffer to read from.
+
+Parameter ``size``:
+    Size of the data in bytes.
+
+Parameter ``offset``:
+    Offset in the buffer to read from.
+
+Returns:
+    Read-back request.)doc";
+
 static const char *__doc_sgl_Device_read_texture_data =
 R"doc(Read texture data to host memory. \note This will wait until the data
 is copied back to host memory.
@@ -3467,8 +3923,27 @@ Parameter ``subresource``:
 Returns:
     Subresource data in host memory.)doc";
 
+static const char *__doc_sgl_Device_read_texture_data_async =
+R"doc(Read texture data to host memory without blocking. The copy is
+submitted immediately, the returned request can be polled or waited on.
+
+Parameter ``texture``:
+    Texture to read from.
+
+Parameter ``subresource``:
+    Subresource index.
+
+Returns:
+    Read-back request.)doc";
+
+static const char *__doc_sgl_Device_record_pipeline_manifest =
+R"doc(Enable/disable recording of created pipelines into the pipeline
+manifest.)doc";
+
 static const char *__doc_sgl_Device_reload_all_programs = R"doc()doc";
 
+static const char *__doc_sgl_Device_remove_cached_pipeline_state = R"doc()doc";
+
 static const char *__doc_sgl_Device_report_live_objects =
 R"doc(Report live objects in the slang/gfx layer. This is useful for
 checking clean shutdown with all resources released properly.)doc";
@@ -3479,8 +3954,26 @@ R"doc(Execute garbage collection.
 This function should be called regularly to execute deferred releases
 (at least once a frame).)doc";
 
+static const char *__doc_sgl_Device_save_pipeline_manifest =
+R"doc(Save the pipeline manifest.
+
+The manifest lists the programs of all compute pipelines created while
+recording was enabled. Only programs loaded with load_program (using
+the default slang session) are recorded. Graphics and ray tracing
+pipelines are not recorded: they depend on state that is only known at
+creation time (input layout, framebuffer layout, rasterizer state,
+...), so they cannot be recreated from a program description alone.
+
+Parameter ``path``:
+    Path of the manifest file. Defaults to "pipeline_manifest.txt" in
+    the shader cache directory.)doc";
+
 static const char *__doc_sgl_Device_set_open_command_buffer = R"doc()doc";
 
+static const char *__doc_sgl_Device_set_pipeline_cache_capacity = R"doc()doc";
+
+static const char *__doc_sgl_Device_set_record_pipeline_manifest = R"doc()doc";
+
 static const char *__doc_sgl_Device_shader_cache_stats = R"doc(Shader cache statistics.)doc";
 
 static const char *__doc_sgl_Device_slang_session = R"doc(Default slang session.)doc";
@@ -3569,6 +4062,107 @@ R"doc(Wait for the command queue to be idle.
 Parameter ``queue``:
     Command queue to wait for.)doc";
 
+static const char *__doc_sgl_Device_warm_up_pipeline_cache =
+R"doc(Precompile the programs and compute pipelines listed in a pipeline
+manifest.
+
+The entries are processed one after another on the calling thread,
+populating the pipeline cache before first use. They are not compiled
+in parallel: loading and pipeline creation go through the default
+slang session, which serializes compilation. Use
+warm_up_pipeline_cache_async to run the warm-up on the global thread
+pool during startup. Entries that fail to load are skipped with a
+warning, as are entries of kinds other than compute.
+
+Parameter ``path``:
+    Path of the manifest file. Defaults to "pipeline_manifest.txt" in
+    the shader cache directory, which is silently ignored if it does
+    not exist.
+
+Returns:
+    Number of precompiled manifest entries.)doc";
+
+static const char *__doc_sgl_Device_warm_up_pipeline_cache_async =
+R"doc(Run warm_up_pipeline_cache on the global thread pool. The device must
+be kept alive (and not closed) until the returned future is ready.)doc";
+
+static const char *__doc_sgl_DispatchSequence =
+R"doc(Recorded sequence of compute dispatches.
+
+Each recorded dispatch owns a persistent mutable root shader object.
+Parameters are bound once at record time and the pipeline, thread
+group count and bound resources are kept across submissions.
+Re-submitting the sequence only re-encodes the dispatches, individual
+parameters can be patched in between through ``cursor()``.
+
+If the program of a recorded kernel is hot reloaded, the shader object
+of the dispatch is recreated and the ``bind_vars`` callback passed to
+``record()`` is invoked again. Parameters patched through ``cursor()``
+after recording are lost in this case.
+
+Note:
+    Entry point parameters are not supported, all parameters need to
+    be global.)doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_DispatchSequence = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_bind_vars = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_kernel = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_program_generation =
+R"doc(Generation of the program the shader object was created for, used to
+detect hot reloads.)doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_shader_object = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_thread_count = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_Dispatch_thread_group_count = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_bind = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_clear = R"doc(Remove all recorded dispatches.)doc";
+
+static const char *__doc_sgl_DispatchSequence_cursor = R"doc(Shader cursor for patching the parameters of a recorded dispatch.)doc";
+
+static const char *__doc_sgl_DispatchSequence_dispatch_count = R"doc(Number of recorded dispatches.)doc";
+
+static const char *__doc_sgl_DispatchSequence_encode = R"doc(Encode all recorded dispatches.)doc";
+
+static const char *__doc_sgl_DispatchSequence_kernel = R"doc(Kernel of a recorded dispatch.)doc";
+
+static const char *__doc_sgl_DispatchSequence_m_dispatches = R"doc()doc";
+
+static const char *__doc_sgl_DispatchSequence_record =
+R"doc(Record a dispatch of ``kernel`` with ``thread_count`` threads.
+
+Parameter ``kernel``:
+    Compute kernel to dispatch.
+
+Parameter ``thread_count``:
+    Number of threads to dispatch.
+
+Parameter ``bind_vars``:
+    Callback to bind the parameters. Invoked once and again after a
+    hot reload.
+
+Returns:
+    Index of the recorded dispatch.)doc";
+
+static const char *__doc_sgl_DispatchSequence_set_thread_count = R"doc(Change the number of threads of a recorded dispatch.)doc";
+
+static const char *__doc_sgl_DispatchSequence_shader_object = R"doc(Root shader object of a recorded dispatch.)doc";
+
+static const char *__doc_sgl_DispatchSequence_submit =
+R"doc(Encode all recorded dispatches to ``command_buffer``. If
+``command_buffer`` is nullptr, the shared command buffer of the device
+is used.)doc";
+
+static const char *__doc_sgl_DispatchSequence_update = R"doc(Bind ``vars`` to a recorded dispatch, patching only the given parameters.)doc";
+
 static const char *__doc_sgl_EOFException = R"doc()doc";
 
 static const char *__doc_sgl_EOFException_EOFException = R"doc()doc";
@@ -3697,6 +4291,8 @@ static const char *__doc_sgl_FileLoggerOutput = R"doc(Logger output that writes
 
 static const char *__doc_sgl_FileLoggerOutput_FileLoggerOutput = R"doc()doc";
 
+static const char *__doc_sgl_FileLoggerOutput_flush = R"doc()doc";
+
 static const char *__doc_sgl_FileLoggerOutput_m_file = R"doc()doc";
 
 static const char *__doc_sgl_FileLoggerOutput_m_path = R"doc()doc";
@@ -3765,6 +4361,8 @@ static const char *__doc_sgl_FileSystemWatchDesc = R"doc(Init options for FileSy
 
 static const char *__doc_sgl_FileSystemWatchDesc_directory = R"doc(Directory to monitor.)doc";
 
+static const char *__doc_sgl_FileSystemWatchDesc_recursive = R"doc(Monitor all subdirectories (including subdirectories created later on).)doc";
+
 static const char *__doc_sgl_FileSystemWatchEvent =
 R"doc(Data reported on a given file system event to a file monitored by
 FileSystemWatcher.)doc";
@@ -3780,7 +4378,10 @@ static const char *__doc_sgl_FileSystemWatchEvent_time = R"doc(System time chang
 static const char *__doc_sgl_FileSystemWatcher =
 R"doc(Monitors directories for changes and calls a callback when they're
 detected. The watcher automatically queues up changes until disk has
-been idle for a period. Relies on regular polling of update().)doc";
+been idle for a period. Queued changes are coalesced, i.e. repeated
+changes of the same kind to a file are reported once. Relies on
+regular polling of update(), or on a background thread started with
+start_background_thread(), which calls the callback from the thread.)doc";
 
 static const char *__doc_sgl_FileSystemWatcherChange = R"doc(Types of file system event that can be reported.)doc";
 
@@ -3792,18 +4393,36 @@ static const char *__doc_sgl_FileSystemWatcherChange_modified = R"doc()doc";
 
 static const char *__doc_sgl_FileSystemWatcherChange_removed = R"doc()doc";
 
+static const char *__doc_sgl_FileSystemWatcher_DirectoryWatch = R"doc(Watch of a single directory (subdirectory of a recursive watch).)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_DirectoryWatch_path = R"doc(Path of the directory relative to the watched directory.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_DirectoryWatch_state = R"doc()doc";
+
 static const char *__doc_sgl_FileSystemWatcher_FileSystemWatcher = R"doc()doc";
 
 static const char *__doc_sgl_FileSystemWatcher_FileSystemWatcher_2 =
 R"doc(FileSystemWatch move constructor is deleted to allow for map of unique
 ptrs.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_add_directory_watch =
+R"doc(Add an inotify watch for a directory (and its subdirectories for
+recursive watches).)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_add_watch = R"doc(Add watch of a new directory.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_class_name = R"doc()doc";
 
 static const char *__doc_sgl_FileSystemWatcher_delay = R"doc(Delay period before queued events are output.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_is_background_thread_running = R"doc(True if the background thread is running.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_m_background_thread_running = R"doc(True if the background thread is running.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_m_directory_watches =
+R"doc(Map of inotify watch descriptor -> directory watches (a descriptor is
+shared by all watches of the same directory).)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_m_inotify_file_descriptor = R"doc(File descriptor for linux inotify watcher.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_m_last_event = R"doc(Time last event was recorded.)doc";
@@ -3816,22 +4435,51 @@ static const char *__doc_sgl_FileSystemWatcher_m_output_delay_ms = R"doc(Delay b
 
 static const char *__doc_sgl_FileSystemWatcher_m_queued_events = R"doc(Events reported since last call to watch event callback.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_m_queued_events_mutex = R"doc(Mutex to protect the queued events.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_m_stop_thread = R"doc()doc";
+
+static const char *__doc_sgl_FileSystemWatcher_m_thread = R"doc(Background thread waiting for inotify events.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_m_wake_file_descriptor = R"doc(Event file descriptor to wake up the background thread.)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_m_watches = R"doc(Map of id->watch.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_m_watches_mutex = R"doc(Mutex to protect the watch map.)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_notify_change = R"doc(Internal function called when OS reports an event.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_on_change = R"doc(Get callback for file system events.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_read_events = R"doc(Read and process all pending inotify events.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_remove_directory_watch = R"doc(Remove a single inotify watch of a watch state.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_remove_directory_watches =
+R"doc(Remove the inotify watches of a subdirectory (and its subdirectories)
+of a watch state.)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_remove_watch = R"doc(Remove existing watch.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_remove_watch_2 = R"doc(Remove existing watch.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_report_events = R"doc(Report queued events if the disk has been idle for the delay period.)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_set_delay = R"doc(Set delay period before queued events are output.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_set_on_change = R"doc(Set callback for file system events.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_start_background_thread =
+R"doc(Start a background thread that waits for file system events and reports
+them (from the background thread) once the disk has been idle for the
+delay period.)doc";
+
+static const char *__doc_sgl_FileSystemWatcher_stop_background_thread = R"doc(Stop the background thread.)doc";
+
 static const char *__doc_sgl_FileSystemWatcher_stop_watch = R"doc(Releases OS monitoring for a given watch.)doc";
 
+static const char *__doc_sgl_FileSystemWatcher_thread_func = R"doc()doc";
+
 static const char *__doc_sgl_FileSystemWatcher_update = R"doc(Update function to poll the watcher + report events.)doc";
 
 static const char *__doc_sgl_FileSystemWatcher_watch_count = R"doc(Get number of active watches)doc";
@@ -4354,7 +5002,36 @@ static const char *__doc_sgl_HitGroupDesc_intersection_entry_point = R"doc()doc"
 
 static const char *__doc_sgl_HotReload =
 R"doc(Shader hot reload management, detects when relevant slang files have
-been editor and triggers session recreates as necessary.)doc";
+been editor and triggers session recreates as necessary. Only programs
+depending on the changed files are relinked. Sessions read source
+files through a file system that records the content hash of the exact
+contents modules are compiled from, so that file system events that
+don't change the contents of a file (i.e. touching a file or saving it
+several times) don't trigger a reload.)doc";
+
+static const char *__doc_sgl_HotReload_FileSystem =
+R"doc(Slang file system recording the content hashes of source files read by
+sessions.)doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_addRef = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_castAs = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_file_hash = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_forget_files = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_loadFile = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_m_file_hashes = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_m_mutex = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_m_ref_count = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_queryInterface = R"doc()doc";
+
+static const char *__doc_sgl_HotReload_FileSystem_release = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_HotReload = R"doc()doc";
 
@@ -4366,24 +5043,51 @@ static const char *__doc_sgl_HotReload_class_name = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_clear_file_watches = R"doc(Exclusively for testing, erase all existing file watches)doc";
 
+static const char *__doc_sgl_HotReload_file_system = R"doc(File system used by sessions to load source files.)doc";
+
+static const char *__doc_sgl_HotReload_has_file_changed =
+R"doc(Returns true if the contents of a file differ from the contents modules
+were compiled from (or the file was not read by any session).)doc";
+
 static const char *__doc_sgl_HotReload_has_reloaded = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_last_build_failed =
 R"doc(Return true if last attempt to recreate sessions failed with
 exception.)doc";
 
+static const char *__doc_sgl_HotReload_last_changed_files =
+R"doc(Files with changed contents that triggered the last reload in
+update().)doc";
+
 static const char *__doc_sgl_HotReload_m_all_slang_sessions = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_m_auto_detect_changes = R"doc()doc";
 
+static const char *__doc_sgl_HotReload_m_changed_files =
+R"doc(Changed slang files detected by the file system watcher, processed in
+update().)doc";
+
 static const char *__doc_sgl_HotReload_m_device = R"doc()doc";
 
+static const char *__doc_sgl_HotReload_m_file_system =
+R"doc(File system recording the content hashes of source files read by
+sessions.)doc";
+
 static const char *__doc_sgl_HotReload_m_file_system_watcher = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_m_has_reloaded = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_m_last_build_failed = R"doc()doc";
 
+static const char *__doc_sgl_HotReload_m_last_changed_files =
+R"doc(Files with changed contents that triggered the last reload in
+update().)doc";
+
+static const char *__doc_sgl_HotReload_m_mutex =
+R"doc(Protects the session list, watched paths and file system watcher, as
+sessions can load modules on worker threads. Never held while
+recreating sessions (which lock the session mutex).)doc";
+
 static const char *__doc_sgl_HotReload_m_watched_paths = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_on_file_system_event = R"doc()doc";
@@ -4394,6 +5098,13 @@ static const char *__doc_sgl_HotReload_recreate_all_sessions =
 R"doc(Force immediate recreation of all registered sessions and any
 modules/programs they've loaded/linked.)doc";
 
+static const char *__doc_sgl_HotReload_recreate_dependent_sessions =
+R"doc(Recreate sessions that have modules depending on any of the given
+files, only relinking the affected programs. Falls back to recreating
+all sessions if the last attempt to recreate sessions failed.)doc";
+
+static const char *__doc_sgl_HotReload_recreate_sessions = R"doc()doc";
+
 static const char *__doc_sgl_HotReload_register_slang_session = R"doc()doc";
 
 static const char *__doc_sgl_HotReload_reset_reloaded = R"doc()doc";
@@ -4492,8 +5203,14 @@ static const char *__doc_sgl_Kernel = R"doc()doc";
 
 static const char *__doc_sgl_Kernel_Kernel = R"doc()doc";
 
+static const char *__doc_sgl_Kernel_binding_cache =
+R"doc(Opaque cache of resolved parameter bindings. Owned by the kernel but
+populated by language bindings (e.g. the Python `dispatch` method).)doc";
+
 static const char *__doc_sgl_Kernel_class_name = R"doc()doc";
 
+static const char *__doc_sgl_Kernel_m_binding_cache = R"doc()doc";
+
 static const char *__doc_sgl_Kernel_m_program = R"doc()doc";
 
 static const char *__doc_sgl_Kernel_program = R"doc()doc";
@@ -4808,12 +5525,27 @@ static const char *__doc_sgl_LogLevel_none = R"doc()doc";
 
 static const char *__doc_sgl_LogLevel_warn = R"doc()doc";
 
+static const char *__doc_sgl_LogOverflowPolicy = R"doc(Policy for handling a full message queue in asynchronous logging mode.)doc";
+
+static const char *__doc_sgl_LogOverflowPolicy_block = R"doc(Block the logging thread until there is space in the queue.)doc";
+
+static const char *__doc_sgl_LogOverflowPolicy_drop =
+R"doc(Drop the message. Messages with level ``error`` or higher are never
+dropped.)doc";
+
 static const char *__doc_sgl_Logger = R"doc()doc";
 
 static const char *__doc_sgl_LoggerOutput = R"doc(Abstract base class for logger outputs.)doc";
 
 static const char *__doc_sgl_LoggerOutput_class_name = R"doc()doc";
 
+static const char *__doc_sgl_LoggerOutput_flush = R"doc(Flush buffered messages.)doc";
+
+static const char *__doc_sgl_LoggerOutput_supports_async =
+R"doc(True if the output can be written from the background thread used in
+asynchronous logging mode. Outputs that need to acquire a lock held by
+logging threads (e.g. the Python GIL) must return false.)doc";
+
 static const char *__doc_sgl_LoggerOutput_write =
 R"doc(Write a log message.
 
@@ -4826,6 +5558,8 @@ Parameter ``module``:
 Parameter ``msg``:
     The message.)doc";
 
+static const char *__doc_sgl_Logger_AsyncWriter = R"doc(Background writer used in asynchronous mode.)doc";
+
 static const char *__doc_sgl_Logger_Logger =
 R"doc(Constructor.
 
@@ -4864,7 +5598,8 @@ Returns:
     The created logger output.)doc";
 
 static const char *__doc_sgl_Logger_add_output =
-R"doc(Add a logger output.
+R"doc(Add a logger output. Throws if asynchronous logging is enabled and the
+output does not support it.
 
 Parameter ``output``:
     The logger output to add.)doc";
@@ -4881,6 +5616,26 @@ static const char *__doc_sgl_Logger_debug_once = R"doc()doc";
 
 static const char *__doc_sgl_Logger_debug_once_2 = R"doc()doc";
 
+static const char *__doc_sgl_Logger_disable_async =
+R"doc(Disable asynchronous logging. Writes all queued messages before
+returning.)doc";
+
+static const char *__doc_sgl_Logger_dropped_count = R"doc(Number of messages dropped due to a full message queue.)doc";
+
+static const char *__doc_sgl_Logger_enable_async =
+R"doc(Enable asynchronous logging. In asynchronous mode, logging threads only
+push messages into a bounded lock-free queue. A background thread
+writes the queued messages to the outputs in batches and flushes the
+outputs periodically (instead of after every message). Error and fatal
+messages are flushed immediately. Throws if any of the outputs does not
+support asynchronous logging (see ``LoggerOutput::supports_async``).
+
+Parameter ``queue_capacity``:
+    The capacity of the message queue (rounded up to a power of two).
+
+Parameter ``overflow_policy``:
+    How to handle messages logged while the queue is full.)doc";
+
 static const char *__doc_sgl_Logger_error = R"doc()doc";
 
 static const char *__doc_sgl_Logger_error_2 = R"doc()doc";
@@ -4897,6 +5652,8 @@ static const char *__doc_sgl_Logger_fatal_once = R"doc()doc";
 
 static const char *__doc_sgl_Logger_fatal_once_2 = R"doc()doc";
 
+static const char *__doc_sgl_Logger_flush = R"doc(Block until all logged messages are written and flush all outputs.)doc";
+
 static const char *__doc_sgl_Logger_get = R"doc(Returns the global logger instance.)doc";
 
 static const char *__doc_sgl_Logger_info = R"doc()doc";
@@ -4907,6 +5664,8 @@ static const char *__doc_sgl_Logger_info_once = R"doc()doc";
 
 static const char *__doc_sgl_Logger_info_once_2 = R"doc()doc";
 
+static const char *__doc_sgl_Logger_is_async = R"doc(True if asynchronous logging is enabled.)doc";
+
 static const char *__doc_sgl_Logger_is_duplicate = R"doc(Checks if the given message has already been logged.)doc";
 
 static const char *__doc_sgl_Logger_level = R"doc(The log level.)doc";
@@ -4923,6 +5682,14 @@ Parameter ``msg``:
 Parameter ``frequency``:
     The log frequency.)doc";
 
+static const char *__doc_sgl_Logger_m_async_mutex = R"doc()doc";
+
+static const char *__doc_sgl_Logger_m_async_users = R"doc(Number of threads currently accessing the async writer.)doc";
+
+static const char *__doc_sgl_Logger_m_async_writer = R"doc()doc";
+
+static const char *__doc_sgl_Logger_m_dropped_count = R"doc()doc";
+
 static const char *__doc_sgl_Logger_m_level = R"doc()doc";
 
 static const char *__doc_sgl_Logger_m_messages = R"doc()doc";
@@ -4993,7 +5760,20 @@ freed while still in use by the device.
 
 Allocations are returned as unique pointers. When the pointer is
 destroyed, the allocation is released. This ensures that the memory is
-freed when it is no longer used.)doc";
+freed when it is no longer used.
+
+In ring-buffer mode, memory is allocated with ``allocate_transient``
+instead. Transient allocations are plain values that are never
+released individually. Each thread allocates from its own sub-heap,
+which owns a single page at a time. When the page is exhausted (or its
+thread exits), it is retired. Retired pages are handed to the fence
+with ``retire_pages``, passing the fence value of the submit that last
+used them, and reclaimed once the fence has reached it. Space is
+therefore retired in fence order at page granularity. Threads only
+synchronize when switching pages, which allows multiple threads to
+fill upload memory in parallel.
+
+Allocating and releasing memory is thread-safe.)doc";
 
 static const char *__doc_sgl_MemoryHeapDesc = R"doc()doc";
 
@@ -5005,6 +5785,10 @@ static const char *__doc_sgl_MemoryHeapDesc_page_size = R"doc(The size of a page
 
 static const char *__doc_sgl_MemoryHeapDesc_retain_large_pages = R"doc(True to retain large pages, false to release them after use.)doc";
 
+static const char *__doc_sgl_MemoryHeapDesc_ring_buffer =
+R"doc(True to use the heap as a ring buffer of pages (see
+``MemoryHeap::allocate_transient``).)doc";
+
 static const char *__doc_sgl_MemoryHeapDesc_usage = R"doc(The resource usage of the heap.)doc";
 
 static const char *__doc_sgl_MemoryHeap_AllocationData = R"doc()doc";
@@ -5027,7 +5811,7 @@ static const char *__doc_sgl_MemoryHeap_AllocationData_size = R"doc(The size of
 
 static const char *__doc_sgl_MemoryHeap_DeferredRelease = R"doc()doc";
 
-static const char *__doc_sgl_MemoryHeap_DeferredRelease_fence_value = R"doc()doc";
+static const char *__doc_sgl_MemoryHeap_DeferredRelease_fence_value = R"doc(Fence value that needs to be reached before releasing.)doc";
 
 static const char *__doc_sgl_MemoryHeap_DeferredRelease_page_id = R"doc()doc";
 
@@ -5051,6 +5835,12 @@ static const char *__doc_sgl_MemoryHeap_Page_data = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_Page_reset = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_RetiredPage = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_RetiredPage_page_id = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_RetiredPage_size = R"doc()doc";
+
 static const char *__doc_sgl_MemoryHeap_Stats = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_Stats_large_page_count = R"doc(The number of large pages in the heap.)doc";
@@ -5059,7 +5849,43 @@ static const char *__doc_sgl_MemoryHeap_Stats_page_count = R"doc(The number of p
 
 static const char *__doc_sgl_MemoryHeap_Stats_total_size = R"doc(The total size of the heap.)doc";
 
-static const char *__doc_sgl_MemoryHeap_Stats_used_size = R"doc(The used size of the heap.)doc";
+static const char *__doc_sgl_MemoryHeap_Stats_used_size =
+R"doc(The used size of the heap. In ring-buffer mode, only pages that have
+been retired are accounted for.)doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap =
+R"doc(Current page of a thread in ring-buffer mode. Only accessed by its
+thread, so it stores copies of the page data. Shared with the thread,
+which flags it as exited when it terminates.)doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_buffer = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_data = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_exited = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_heap_id = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_offset = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_page_id = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_SubHeap_size = R"doc()doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation =
+R"doc(Allocation from a ring-buffer heap. The memory is valid until its page
+is retired and the fence has reached the value passed to
+``retire_pages``.)doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation_buffer = R"doc(The buffer this allocation belongs to.)doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation_data = R"doc(Pointer to the host-visible memory.)doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation_device_address = R"doc(The device address of the allocation.)doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation_offset = R"doc(The offset of the allocation within the buffer.)doc";
+
+static const char *__doc_sgl_MemoryHeap_TransientAllocation_size = R"doc(The size of the allocation.)doc";
 
 static const char *__doc_sgl_MemoryHeap_allocate =
 R"doc(Allocate memory from this heap.
@@ -5075,6 +5901,22 @@ Returns:
 
 static const char *__doc_sgl_MemoryHeap_allocate_page = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_allocate_transient =
+R"doc(Allocate memory from the sub-heap of the calling thread.
+
+Only available in ring-buffer mode. The allocation does not need to be
+released. Allocations larger than the page size get a large page that
+is retired immediately.
+
+Parameter ``size``:
+    The number of bytes to allocate.
+
+Parameter ``alignment``:
+    The alignment of the allocation.
+
+Returns:
+    Returns the allocation.)doc";
+
 static const char *__doc_sgl_MemoryHeap_class_name = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_desc = R"doc(Description of the heap.)doc";
@@ -5086,6 +5928,8 @@ This function should be called regularly to execute deferred releases.)doc";
 
 static const char *__doc_sgl_MemoryHeap_free_page = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_get_sub_heap = R"doc()doc";
+
 static const char *__doc_sgl_MemoryHeap_m_available_pages = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_m_current_page = R"doc()doc";
@@ -5098,10 +5942,18 @@ static const char *__doc_sgl_MemoryHeap_m_fence = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_m_free_pages = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_m_id = R"doc(Unique ID used to look up sub-heaps in the per-thread cache.)doc";
+
+static const char *__doc_sgl_MemoryHeap_m_mutex = R"doc()doc";
+
 static const char *__doc_sgl_MemoryHeap_m_pages = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_m_retired_pages = R"doc()doc";
+
 static const char *__doc_sgl_MemoryHeap_m_stats = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_m_sub_heaps = R"doc()doc";
+
 static const char *__doc_sgl_MemoryHeap_operator_assign = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_operator_assign_2 = R"doc()doc";
@@ -5110,6 +5962,20 @@ static const char *__doc_sgl_MemoryHeap_reclaim_or_allocate_page = R"doc()doc";
 
 static const char *__doc_sgl_MemoryHeap_release = R"doc()doc";
 
+static const char *__doc_sgl_MemoryHeap_retire_page = R"doc(Put a page on the list of retired pages (ring-buffer mode).)doc";
+
+static const char *__doc_sgl_MemoryHeap_retire_pages =
+R"doc(Hand the pages retired since the last call over to the fence.
+
+Only available in ring-buffer mode. Pages are retired when they are
+exhausted or when the thread owning them has exited. They are
+reclaimed by ``execute_deferred_releases`` once the fence has reached
+``fence_value``.
+
+Parameter ``fence_value``:
+    The fence value of the last submit using memory from the retired
+    pages.)doc";
+
 static const char *__doc_sgl_MemoryHeap_stats = R"doc(Statistics of the heap.)doc";
 
 static const char *__doc_sgl_MemoryHeap_to_string = R"doc()doc";
@@ -5378,12 +6244,26 @@ static const char *__doc_sgl_MutableShaderObject_MutableShaderObject_3 = R"doc()
 
 static const char *__doc_sgl_MutableShaderObject_class_name = R"doc()doc";
 
+static const char *__doc_sgl_MutableShaderObject_collect_resource_views = R"doc()doc";
+
 static const char *__doc_sgl_MutableShaderObject_get_cuda_interop_buffers = R"doc()doc";
 
 static const char *__doc_sgl_MutableShaderObject_get_entry_point = R"doc()doc";
 
 static const char *__doc_sgl_MutableShaderObject_get_object = R"doc()doc";
 
+static const char *__doc_sgl_MutableShaderObject_invalidate = R"doc(Mark the bindings of this object as changed.)doc";
+
+static const char *__doc_sgl_MutableShaderObject_m_cached_resource_views =
+R"doc(Resource views of this object and all sub-objects, valid for
+``m_cached_resource_views_generation``.)doc";
+
+static const char *__doc_sgl_MutableShaderObject_m_cached_resource_views_generation = R"doc()doc";
+
+static const char *__doc_sgl_MutableShaderObject_m_generation =
+R"doc(Generation of the last change to the bindings (from a global counter,
+so it is unique across objects).)doc";
+
 static const char *__doc_sgl_MutableShaderObject_m_resource_views = R"doc()doc";
 
 static const char *__doc_sgl_MutableShaderObject_m_sub_objects = R"doc()doc";
@@ -5392,7 +6272,12 @@ static const char *__doc_sgl_MutableShaderObject_set_object = R"doc()doc";
 
 static const char *__doc_sgl_MutableShaderObject_set_resource = R"doc()doc";
 
-static const char *__doc_sgl_MutableShaderObject_set_resource_states = R"doc()doc";
+static const char *__doc_sgl_MutableShaderObject_set_resource_states =
+R"doc(Transition all resources bound to this object and its sub-objects for
+shader access. The list of resource views is cached and only rebuilt
+after bindings have changed.)doc";
+
+static const char *__doc_sgl_MutableShaderObject_subtree_generation = R"doc(Latest change of the bindings of this object or any of its sub-objects.)doc";
 
 static const char *__doc_sgl_NativeHandle =
 R"doc(Represents a native graphics API handle (e.g. D3D12 or Vulkan). Native
@@ -5618,6 +6503,16 @@ static const char *__doc_sgl_OwnedSubresourceData_owned_data = R"doc()doc";
 
 static const char *__doc_sgl_Pipeline = R"doc(Pipeline base class.)doc";
 
+static const char *__doc_sgl_PipelineCacheStats = R"doc()doc";
+
+static const char *__doc_sgl_PipelineCacheStats_entry_count = R"doc(Number of pipelines in the cache.)doc";
+
+static const char *__doc_sgl_PipelineCacheStats_eviction_count = R"doc(Number of least recently used pipelines evicted from the cache.)doc";
+
+static const char *__doc_sgl_PipelineCacheStats_hit_count = R"doc(Number of pipelines reused from the cache.)doc";
+
+static const char *__doc_sgl_PipelineCacheStats_miss_count = R"doc(Number of pipelines created and added to the cache.)doc";
+
 static const char *__doc_sgl_Pipeline_Pipeline = R"doc()doc";
 
 static const char *__doc_sgl_Pipeline_class_name = R"doc()doc";
@@ -5628,6 +6523,10 @@ VkPipeline)doc";
 
 static const char *__doc_sgl_Pipeline_gfx_pipeline_state = R"doc()doc";
 
+static const char *__doc_sgl_Pipeline_m_cache_key =
+R"doc(Key of the pipeline state in the device's pipeline cache (empty if not
+cached).)doc";
+
 static const char *__doc_sgl_Pipeline_m_gfx_pipeline_state = R"doc()doc";
 
 static const char *__doc_sgl_Pipeline_m_program =
@@ -5638,6 +6537,8 @@ a strong reference.)doc";
 
 static const char *__doc_sgl_Pipeline_notify_program_reloaded = R"doc()doc";
 
+static const char *__doc_sgl_Pipeline_program = R"doc(The program used by this pipeline.)doc";
+
 static const char *__doc_sgl_Pipeline_recreate = R"doc()doc";
 
 static const char *__doc_sgl_PluginManager =
@@ -5894,6 +6795,142 @@ static const char *__doc_sgl_PrimitiveType_point = R"doc()doc";
 
 static const char *__doc_sgl_PrimitiveType_triangle = R"doc()doc";
 
+static const char *__doc_sgl_Profiler =
+R"doc(Scoped CPU and GPU profiler.
+
+The profiler measures the duration of named scopes. GPU scopes are
+recorded into command buffers using timestamp queries, CPU scopes are
+measured on the host using ``Timer``. Scopes can be nested, each
+command buffer (and the host) maintains its own scope stack. Scopes are
+identified by their path (i.e. the names of all enclosing scopes joined
+by '/').
+
+Scopes are recorded in frames, delimited by ``begin_frame`` and
+``end_frame``. Command buffers containing GPU scopes of a frame must be
+submitted before calling ``end_frame``. Timestamp query pools are
+managed per frame in flight and resolved without stalling once the GPU
+has finished a frame (or after ``latency`` frames at the latest).
+
+Resolved scope durations are accumulated into rolling statistics (see
+``stats``) and the events of the last ``trace_frame_count`` frames can
+be exported as a Chrome trace (see ``trace_json``), which can be viewed
+in chrome://tracing or Perfetto.)doc";
+
+static const char *__doc_sgl_ProfilerDesc = R"doc()doc";
+
+static const char *__doc_sgl_ProfilerDesc_history_size = R"doc(Number of samples used for computing the rolling statistics of a scope.)doc";
+
+static const char *__doc_sgl_ProfilerDesc_latency =
+R"doc(Number of frames that can be in flight before the timestamps of a frame
+are resolved. Timestamps are resolved as soon as the GPU has finished a
+frame, but at the latest after this many frames (which blocks until the
+GPU has caught up).)doc";
+
+static const char *__doc_sgl_ProfilerDesc_queries_per_pool =
+R"doc(Number of timestamp queries per query pool. Additional pools are
+created on demand.)doc";
+
+static const char *__doc_sgl_ProfilerDesc_trace_frame_count = R"doc(Number of resolved frames kept for trace export.)doc";
+
+static const char *__doc_sgl_Profiler_Profiler = R"doc()doc";
+
+static const char *__doc_sgl_Profiler_Scope = R"doc(RAII helper for recording a CPU or GPU scope.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats = R"doc()doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_average_ms = R"doc(Average duration over the sample history in milliseconds.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_count = R"doc(Total number of samples.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_gpu = R"doc(True if this is a GPU scope.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_last_ms = R"doc(Duration of the last sample in milliseconds.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_max_ms = R"doc(Maximum duration over the sample history in milliseconds.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_min_ms = R"doc(Minimum duration over the sample history in milliseconds.)doc";
+
+static const char *__doc_sgl_Profiler_ScopeStats_name = R"doc(Scope path.)doc";
+
+static const char *__doc_sgl_Profiler_Scope_Scope =
+R"doc(Begin a scope.
+
+Parameter ``profiler``:
+    Profiler.
+
+Parameter ``name``:
+    Scope name.
+
+Parameter ``command_buffer``:
+    Command buffer to record a GPU scope into (nullptr for a CPU
+    scope).)doc";
+
+static const char *__doc_sgl_Profiler_Scope_Scope_2 =
+R"doc(End the scope. Errors (i.e. unbalanced scopes) are logged instead of
+thrown.)doc";
+
+static const char *__doc_sgl_Profiler_Scope_m_command_buffer = R"doc()doc";
+
+static const char *__doc_sgl_Profiler_Scope_m_profiler = R"doc()doc";
+
+static const char *__doc_sgl_Profiler_begin_cpu_scope = R"doc(Begin a CPU scope.)doc";
+
+static const char *__doc_sgl_Profiler_begin_frame = R"doc(Begin a new frame. Resolves all finished frames.)doc";
+
+static const char *__doc_sgl_Profiler_begin_scope =
+R"doc(Begin a GPU scope.
+
+Parameter ``command_buffer``:
+    Command buffer to record the begin timestamp into.
+
+Parameter ``name``:
+    Scope name.)doc";
+
+static const char *__doc_sgl_Profiler_desc = R"doc(Description of the profiler.)doc";
+
+static const char *__doc_sgl_Profiler_end_cpu_scope = R"doc(End the innermost CPU scope.)doc";
+
+static const char *__doc_sgl_Profiler_end_frame =
+R"doc(End the current frame. All scopes must be closed and all command
+buffers containing scopes submitted.)doc";
+
+static const char *__doc_sgl_Profiler_end_scope =
+R"doc(End the innermost GPU scope of a command buffer.
+
+Parameter ``command_buffer``:
+    Command buffer to record the end timestamp into.)doc";
+
+static const char *__doc_sgl_Profiler_flush = R"doc(Block until all frames have finished on the GPU and resolve them.)doc";
+
+static const char *__doc_sgl_Profiler_frame_index = R"doc(Index of the current (or last) frame.)doc";
+
+static const char *__doc_sgl_Profiler_reset_stats = R"doc(Reset all statistics and the trace history.)doc";
+
+static const char *__doc_sgl_Profiler_scope =
+R"doc(Create a context manager for recording a scope.
+
+Parameter ``name``:
+    Scope name.
+
+Parameter ``command_buffer``:
+    Command buffer to record a GPU scope into (None for a CPU scope).)doc";
+
+static const char *__doc_sgl_Profiler_scope_stats =
+R"doc(Rolling statistics of a resolved scope. Returns empty statistics if the
+scope does not exist.)doc";
+
+static const char *__doc_sgl_Profiler_stats = R"doc(Rolling statistics of all resolved scopes.)doc";
+
+static const char *__doc_sgl_Profiler_to_string = R"doc()doc";
+
+static const char *__doc_sgl_Profiler_trace_json =
+R"doc(Generate a Chrome trace (JSON) of the resolved frames in the trace
+history.)doc";
+
+static const char *__doc_sgl_Profiler_write_trace =
+R"doc(Write a Chrome trace (JSON) of the resolved frames in the trace
+history to a file.)doc";
+
 static const char *__doc_sgl_ProgramLayout = R"doc()doc";
 
 static const char *__doc_sgl_ProgramLayoutEntryPointList = R"doc(ProgramLayout lazy entry point list evaluation.)doc";
@@ -6246,6 +7283,52 @@ static const char *__doc_sgl_Ray_t_max = R"doc()doc";
 
 static const char *__doc_sgl_Ray_t_min = R"doc()doc";
 
+static const char *__doc_sgl_ReadBackRequest =
+R"doc(Handle to an asynchronous read-back of buffer or texture data to host
+memory.
+
+The copy is submitted to the device when the request is created (see
+``Device::read_buffer_data_async`` and
+``Device::read_texture_data_async``). The request is tied to the
+submission ID of the command buffer containing the copy and keeps the
+read-back heap allocation alive until it is destroyed.)doc";
+
+static const char *__doc_sgl_ReadBackRequest_ReadBackRequest = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_class_name = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_get_data =
+R"doc(Copy the read-back data to host memory. Blocks until the copy has
+completed.
+
+Parameter ``data``:
+    Destination to copy to.
+
+Parameter ``size``:
+    Size of the destination in bytes (needs to be at least ``size()``).)doc";
+
+static const char *__doc_sgl_ReadBackRequest_get_subresource_data = R"doc(Get the read-back texture subresource data. Blocks until the copy has completed.)doc";
+
+static const char *__doc_sgl_ReadBackRequest_is_ready = R"doc(True if the copy has completed and the data is available.)doc";
+
+static const char *__doc_sgl_ReadBackRequest_m_allocation = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_m_device = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_m_layout = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_m_size = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_m_submission_id = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_size = R"doc(Size of the read-back data in bytes (rows of texture data are tightly packed).)doc";
+
+static const char *__doc_sgl_ReadBackRequest_submission_id = R"doc(Submission ID of the command buffer containing the copy.)doc";
+
+static const char *__doc_sgl_ReadBackRequest_to_string = R"doc()doc";
+
+static const char *__doc_sgl_ReadBackRequest_wait = R"doc(Block until the copy has completed.)doc";
+
 static const char *__doc_sgl_ReflectionCursor = R"doc()doc";
 
 static const char *__doc_sgl_ReflectionCursor_ReflectionCursor = R"doc()doc";
@@ -6750,6 +7833,133 @@ static const char *__doc_sgl_ShaderCacheStats_miss_count = R"doc(Number of misse
 
 static const char *__doc_sgl_ShaderCursor = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursorPath =
+R"doc(Precompiled path to a shader variable.
+
+Navigating to a variable with \c ShaderCursor (e.g.
+`cursor["g_params"]["lights"][3]["color"]`) looks up every path
+component in the reflection data. A \c ShaderCursorPath does this
+lookup once and stores the resulting offsets together with the
+information needed for type checking. Binding values through the path
+skips the reflection walk entirely.
+
+A path can be applied to any shader object created for the same
+program generation as the shader object it was compiled for, e.g. the
+transient shader objects returned by binding the same pipeline in
+every frame. Paths need to be recompiled after the program is
+reloaded.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_ShaderCursorPath = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_ShaderCursorPath_2 =
+R"doc(Compile a path relative to a root cursor.
+
+Parameter ``cursor``:
+    Cursor pointing to the root of a shader object.
+
+Parameter ``path``:
+    Path to the variable. Fields are separated by `.` and
+    array/vector elements are accessed using `[index]`, e.g.
+    "g_params.lights[3].color".)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo = R"doc(Type information of the variable, cached when the path is compiled.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_col_count = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_element_count = R"doc(Number of array elements (0 if not an array).)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_element_kind = R"doc(Kind of the variable type with arrays unwrapped.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_element_stride = R"doc(Uniform stride of array elements (0 if not an array).)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_acceleration_structure = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_buffer_resource = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_parameter_block = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_resource = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_sampler = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_shader_resource = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_texture_resource = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_is_unordered_access = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_kind = R"doc(Kind of the variable type.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_name = R"doc(Name of the type (used for error messages).)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_parameter_category = R"doc(Parameter category of the variable.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_row_count = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_TypeInfo_scalar_type = R"doc(Scalar type of the variable type with arrays unwrapped.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_is_valid = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_object_offsets = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_offset = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_path = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_program_generation =
+R"doc(Program generation of the root shader object (zero if it was created
+from a type layout).)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_root_type_layout =
+R"doc(Element type layout of the root shader object, only compared if there
+is no program generation.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_type_info = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_m_type_layout = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_object_hop_count = R"doc(Number of constant buffers/parameter blocks that are dereferenced along the path.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_offset = R"doc(Offset of the variable within the innermost shader object.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_path = R"doc(The path string this path was compiled from.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_resolve = R"doc(Resolve the path to a regular cursor on the given shader object.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_resolve_object = R"doc(Walk the constant buffer/parameter block hops and return the innermost shader object.)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_acceleration_structure = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_array = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_buffer = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_buffer_2 = R"doc(Bind a range of a buffer (e.g. a ``BufferPool`` allocation).)doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_cuda_tensor_view = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_data = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_matrix = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_object = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_resource = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_sampler = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_scalar = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_texture = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_set_vector = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_to_string = R"doc()doc";
+
+static const char *__doc_sgl_ShaderCursorPath_type_info = R"doc(Cached type information of the variable.)doc";
+
 static const char *__doc_sgl_ShaderCursor_ShaderCursor = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_ShaderCursor_2 = R"doc()doc";
@@ -6790,6 +8000,8 @@ static const char *__doc_sgl_ShaderCursor_set_array = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_set_buffer = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_set_buffer_2 = R"doc(Bind a range of a buffer (e.g. a ``BufferPool`` allocation).)doc";
+
 static const char *__doc_sgl_ShaderCursor_set_cuda_tensor_view = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_set_data = R"doc()doc";
@@ -6808,6 +8020,8 @@ static const char *__doc_sgl_ShaderCursor_set_texture = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_set_vector = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_shader_object = R"doc()doc";
+
 static const char *__doc_sgl_ShaderCursor_to_string = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_type = R"doc()doc";
@@ -6862,8 +8076,15 @@ static const char *__doc_sgl_ShaderObject_m_cuda_interop_buffers = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_m_device = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_m_program_generation = R"doc()doc";
+
 static const char *__doc_sgl_ShaderObject_m_shader_object = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_program_generation =
+R"doc(Generation of the shader program this object was created for (see
+``ShaderProgram::generation``). Sub-objects inherit the generation of
+their parent. Zero if the object was created from a type layout.)doc";
+
 static const char *__doc_sgl_ShaderObject_set_acceleration_structure = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_cuda_tensor_view = R"doc()doc";
@@ -6917,8 +8138,14 @@ static const char *__doc_sgl_ShaderProgramData_2 = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgramData_gfx_shader_program = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgramData_hash = R"doc(Hash identifying the generated code (used as pipeline cache key).)doc";
+
 static const char *__doc_sgl_ShaderProgramData_linked_program = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgramData_session =
+R"doc(Session the program was linked in, kept alive as programs are not
+always relinked on hot reload.)doc";
+
 static const char *__doc_sgl_ShaderProgramDesc = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgramDesc_entry_points = R"doc()doc";
@@ -6927,24 +8154,54 @@ static const char *__doc_sgl_ShaderProgramDesc_link_options = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgramDesc_modules = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgramLoadDesc =
+R"doc(Description of a program to load (see SlangSession::load_program for
+details).)doc";
+
+static const char *__doc_sgl_ShaderProgramLoadDesc_additional_source = R"doc(Optional additional source code that is compiled into a separate module.)doc";
+
+static const char *__doc_sgl_ShaderProgramLoadDesc_entry_point_names = R"doc(Names of the entry points.)doc";
+
+static const char *__doc_sgl_ShaderProgramLoadDesc_link_options = R"doc(Optional link options.)doc";
+
+static const char *__doc_sgl_ShaderProgramLoadDesc_module_name = R"doc(Name of the module containing the entry points.)doc";
+
 static const char *__doc_sgl_ShaderProgram_ShaderProgram = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_class_name = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_desc = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_generation =
+R"doc(Generation of the linked program, updated each time the program is
+(re)linked (i.e. after a hot reload). Generations are unique across all
+programs. Objects derived from the program layout can compare the
+generation to detect a reload.)doc";
+
 static const char *__doc_sgl_ShaderProgram_gfx_shader_program = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_hash =
+R"doc(Hash identifying the generated code of the linked program. Programs
+linked from the same sources with the same options have the same hash.)doc";
+
 static const char *__doc_sgl_ShaderProgram_layout = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_link =
 R"doc(Links program and outputs the resulting ShaderProgramData to current
 build info.)doc";
 
+static const char *__doc_sgl_ShaderProgram_load_desc =
+R"doc(Description used to load the program. Only available for programs
+created with SlangSession::load_program.)doc";
+
 static const char *__doc_sgl_ShaderProgram_m_data = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_m_desc = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_m_generation = R"doc()doc";
+
+static const char *__doc_sgl_ShaderProgram_m_load_desc = R"doc()doc";
+
 static const char *__doc_sgl_ShaderProgram_m_registered_pipelines = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_m_session = R"doc()doc";
@@ -6953,6 +8210,10 @@ static const char *__doc_sgl_ShaderProgram_reflection = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_register_pipeline = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_session = R"doc(The session from which this program was linked.)doc";
+
+static const char *__doc_sgl_ShaderProgram_set_load_desc = R"doc()doc";
+
 static const char *__doc_sgl_ShaderProgram_store_built_data =
 R"doc(Finds this program in current build and updates internal m_data to
 point at it.)doc";
@@ -7203,6 +8464,10 @@ static const char *__doc_sgl_SlangModuleData = R"doc()doc";
 
 static const char *__doc_sgl_SlangModuleData_2 = R"doc()doc";
 
+static const char *__doc_sgl_SlangModuleData_dependencies =
+R"doc(Absolute paths of all files the module depends on (including
+transitive imports).)doc";
+
 static const char *__doc_sgl_SlangModuleData_name = R"doc()doc";
 
 static const char *__doc_sgl_SlangModuleData_path = R"doc()doc";
@@ -7355,8 +8620,12 @@ static const char *__doc_sgl_SlangSession_get_slang_session = R"doc()doc";
 
 static const char *__doc_sgl_SlangSession_link_program = R"doc(Link a program with a set of modules and entry points.)doc";
 
+static const char *__doc_sgl_SlangSession_link_program_async = R"doc(Link a program on the global thread pool.)doc";
+
 static const char *__doc_sgl_SlangSession_load_module = R"doc(Load a module by name.)doc";
 
+static const char *__doc_sgl_SlangSession_load_module_async = R"doc(Load a module by name on the global thread pool.)doc";
+
 static const char *__doc_sgl_SlangSession_load_module_from_source = R"doc(Load a module from string source code.)doc";
 
 static const char *__doc_sgl_SlangSession_load_program =
@@ -7364,6 +8633,8 @@ R"doc(Load a program from a given module with a set of entry points.
 Internally this simply wraps link_program without requiring the user
 to explicitly load modules.)doc";
 
+static const char *__doc_sgl_SlangSession_load_program_async = R"doc(Load a program on the global thread pool.)doc";
+
 static const char *__doc_sgl_SlangSession_load_source = R"doc(Load the source code for a given module.)doc";
 
 static const char *__doc_sgl_SlangSession_m_data = R"doc(Data pointer contains all slang pointers + data resulting from build.)doc";
@@ -7372,6 +8643,8 @@ static const char *__doc_sgl_SlangSession_m_desc = R"doc(Descriptor containing a
 
 static const char *__doc_sgl_SlangSession_m_device = R"doc()doc";
 
+static const char *__doc_sgl_SlangSession_m_mutex = R"doc()doc";
+
 static const char *__doc_sgl_SlangSession_m_nvapi_module = R"doc(Global NVAPI module linked to all programs.)doc";
 
 static const char *__doc_sgl_SlangSession_m_registered_modules =
@@ -7380,10 +8653,28 @@ load_module). Note: this is a vector, as order of creation matters.)doc";
 
 static const char *__doc_sgl_SlangSession_m_registered_programs = R"doc(All created sgl programs (via link_program))doc";
 
+static const char *__doc_sgl_SlangSession_mutex = R"doc(Internal mutex serializing access to the slang session.)doc";
+
 static const char *__doc_sgl_SlangSession_recreate_session =
 R"doc(Fully recreates this session and any loaded modules or linked
 programs.)doc";
 
+static const char *__doc_sgl_SlangSession_recreate_session_2 =
+R"doc(Recreates this session, only relinking programs that depend on changed
+files.
+
+Slang sessions cannot unload modules, so all modules are reloaded into
+a new session. However, only programs using a module that depends on
+any of the changed files are relinked (and their pipelines recreated).
+All other programs keep their existing data.
+
+Parameter ``changed_files``:
+    Absolute, lexically normalized paths of the changed files.
+
+Returns:
+    False if no module depends on the changed files (the session is
+    left untouched).)doc";
+
 static const char *__doc_sgl_SlangSession_register_module = R"doc()doc";
 
 static const char *__doc_sgl_SlangSession_register_program = R"doc()doc";
@@ -7456,6 +8747,24 @@ static const char *__doc_sgl_Stream_write =
 R"doc(Write data to the stream. Throws an exception if not all data could be
 written.)doc";
 
+static const char *__doc_sgl_StringSlangBlob = R"doc(Implementation of slang's ISlangBlob interface owning a string of data.)doc";
+
+static const char *__doc_sgl_StringSlangBlob_StringSlangBlob = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_addRef = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_getBufferPointer = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_getBufferSize = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_m_data = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_m_ref_count = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_queryInterface = R"doc()doc";
+
+static const char *__doc_sgl_StringSlangBlob_release = R"doc()doc";
+
 static const char *__doc_sgl_Struct =
 R"doc(Structured data definition.
 
@@ -7469,6 +8778,20 @@ R"doc(Struct converter.
 This helper class can be used to convert between structs with
 different layouts.)doc";
 
+static const char *__doc_sgl_StructConverterStats =
+R"doc(Statistics of the conversion program cache shared by all struct
+converters.)doc";
+
+static const char *__doc_sgl_StructConverterStats_code_size = R"doc(Total size of the cached programs in bytes.)doc";
+
+static const char *__doc_sgl_StructConverterStats_compile_time = R"doc(Total time spent compiling programs in seconds.)doc";
+
+static const char *__doc_sgl_StructConverterStats_hit_count = R"doc(Number of lookups that found an already compiled program.)doc";
+
+static const char *__doc_sgl_StructConverterStats_miss_count = R"doc(Number of lookups that had to compile a program.)doc";
+
+static const char *__doc_sgl_StructConverterStats_program_count = R"doc(Number of conversion programs in the cache.)doc";
+
 static const char *__doc_sgl_StructConverter_StructConverter =
 R"doc(Constructor.
 
@@ -7492,14 +8815,50 @@ Parameter ``dst``:
 Parameter ``count``:
     Number of structs to convert.)doc";
 
+static const char *__doc_sgl_StructConverter_convert_rows =
+R"doc(Convert rows of structs between strided source and destination data.
+The conversion program is looked up once for all rows. Rows are
+converted in parallel if the amount of data exceeds
+``PARALLEL_THRESHOLD`` bytes.
+
+Parameter ``src``:
+    Source data (first row).
+
+Parameter ``src_row_pitch``:
+    Offset between source rows in bytes (negative to convert rows
+    bottom-up).
+
+Parameter ``dst``:
+    Destination data (first row).
+
+Parameter ``dst_row_pitch``:
+    Offset between destination rows in bytes.
+
+Parameter ``count``:
+    Number of structs per row.
+
+Parameter ``row_count``:
+    Number of rows to convert.
+
+Parameter ``pool``:
+    Thread pool to use (defaults to the global thread pool).)doc";
+
 static const char *__doc_sgl_StructConverter_dst = R"doc(The destination struct definition.)doc";
 
 static const char *__doc_sgl_StructConverter_m_dst = R"doc()doc";
 
 static const char *__doc_sgl_StructConverter_m_src = R"doc()doc";
 
+static const char *__doc_sgl_StructConverter_program_kind =
+R"doc(Kind of the conversion program used by this converter. One of "copy"
+(identical structs), "simd_float" or "simd_double" (vectorized
+programs using single or double precision lanes), "x86" or "arm64"
+(just-in-time compiled programs) and "vm" (virtual machine).)doc";
+
 static const char *__doc_sgl_StructConverter_src = R"doc(The source struct definition.)doc";
 
+static const char *__doc_sgl_StructConverter_stats = R"doc(Statistics of the conversion program cache.)doc";
+
 static const char *__doc_sgl_StructConverter_to_string = R"doc()doc";
 
 static const char *__doc_sgl_Struct_ByteOrder = R"doc(Byte order.)doc";
@@ -7895,10 +9254,24 @@ static const char *__doc_sgl_TextureLoader_Options_load_as_srgb =
 R"doc(Use ``Format::rgba8_unorm_srgb`` format if bitmap is 8-bit RGBA with
 sRGB gamma.)doc";
 
+static const char *__doc_sgl_TextureLoader_Options_max_in_flight_bytes =
+R"doc(Maximum number of bytes of loaded source images kept in memory when
+loading multiple textures. Loading is throttled when the limit is
+reached, upload data is submitted in batches of at most this size. Set
+to 0 for no limit.)doc";
+
+static const char *__doc_sgl_TextureLoader_Options_progress_callback =
+R"doc(Callback invoked on the calling thread after each texture is created
+when loading multiple textures.)doc";
+
 static const char *__doc_sgl_TextureLoader_Options_usage =
 R"doc(Resource usage flags for the texture. ``ResourceUsage::render_target``
 will be added automatically if ``generate_mips`` is true.)doc";
 
+static const char *__doc_sgl_TextureLoader_ProgressCallback =
+R"doc(Callback reporting the number of created textures and the total number
+of textures.)doc";
+
 static const char *__doc_sgl_TextureLoader_TextureLoader = R"doc()doc";
 
 static const char *__doc_sgl_TextureLoader_class_name = R"doc()doc";
@@ -7958,6 +9331,9 @@ Returns:
 static const char *__doc_sgl_TextureLoader_load_textures =
 R"doc(Load textures from a list of bitmaps.
 
+Bitmaps are converted on the global thread pool and uploaded in order
+of completion.
+
 Parameter ``bitmaps``:
     Bitmaps to load.
 
@@ -7970,6 +9346,10 @@ Returns:
 static const char *__doc_sgl_TextureLoader_load_textures_2 =
 R"doc(Load textures from a list of image files.
 
+Images are loaded and converted on the global thread pool and uploaded
+in order of completion, keeping at most
+``Options::max_in_flight_bytes`` of loaded images in memory.
+
 Parameter ``paths``:
     Image file paths.
 
@@ -9109,6 +10489,23 @@ static const char *__doc_sgl_hash_3 = R"doc()doc";
 
 static const char *__doc_sgl_hash_combine = R"doc()doc";
 
+static const char *__doc_sgl_hash_data =
+R"doc(Compute a fast 64-bit non-cryptographic hash (XXH64) of the given data.
+Processes 32 bytes per iteration, which makes it much faster than
+``SHA1`` for change detection of larger blobs (i.e. file contents).
+
+Parameter ``data``:
+    Data to hash.
+
+Parameter ``len``:
+    Length of data in bytes.
+
+Parameter ``seed``:
+    Hash seed.
+
+Returns:
+    64-bit hash.)doc";
+
 static const char *__doc_sgl_hasher = R"doc()doc";
 
 static const char *__doc_sgl_hasher_operator_call = R"doc()doc";
@@ -31,7 +31,9 @@ SGL_PY_DECLARE(device_framebuffer);
 SGL_PY_DECLARE(device_input_layout);
 SGL_PY_DECLARE(device_kernel);
 SGL_PY_DECLARE(device_memory_heap);
+SGL_PY_DECLARE(device_buffer_pool);
 SGL_PY_DECLARE(device_pipeline);
+SGL_PY_DECLARE(device_profiler);
 SGL_PY_DECLARE(device_query);
 SGL_PY_DECLARE(device_raytracing);
 SGL_PY_DECLARE(device_reflection);
@@ -116,6 +118,8 @@ NB_MODULE(sgl_ext, m_)
     SGL_PY_IMPORT(device_command);
     SGL_PY_IMPORT(device_kernel);
     SGL_PY_IMPORT(device_memory_heap);
+    SGL_PY_IMPORT(device_buffer_pool);
+    SGL_PY_IMPORT(device_profiler);
     SGL_PY_IMPORT(device_device);
 
     m.def_submodule("ui", "UI module");
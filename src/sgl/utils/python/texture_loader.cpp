@@ -17,6 +17,8 @@ SGL_DICT_TO_DESC_FIELD(extend_alpha, bool)
 SGL_DICT_TO_DESC_FIELD(allocate_mips, bool)
 SGL_DICT_TO_DESC_FIELD(generate_mips, bool)
 SGL_DICT_TO_DESC_FIELD(usage, ResourceUsage)
+SGL_DICT_TO_DESC_FIELD(max_in_flight_bytes, size_t)
+SGL_DICT_TO_DESC_FIELD(progress_callback, TextureLoader::ProgressCallback)
 SGL_DICT_TO_DESC_END()
 } // namespace sgl
 
@@ -42,7 +44,17 @@ SGL_PY_EXPORT(utils_texture_loader)
         .def_rw("extend_alpha", &TextureLoader::Options::extend_alpha, D(TextureLoader, Options, extend_alpha))
         .def_rw("allocate_mips", &TextureLoader::Options::allocate_mips, D(TextureLoader, Options, allocate_mips))
         .def_rw("generate_mips", &TextureLoader::Options::generate_mips, D(TextureLoader, Options, generate_mips))
-        .def_rw("usage", &TextureLoader::Options::usage);
+        .def_rw("usage", &TextureLoader::Options::usage)
+        .def_rw(
+            "max_in_flight_bytes",
+            &TextureLoader::Options::max_in_flight_bytes,
+            D(TextureLoader, Options, max_in_flight_bytes)
+        )
+        .def_rw(
+            "progress_callback",
+            &TextureLoader::Options::progress_callback,
+            D(TextureLoader, Options, progress_callback)
+        );
 
     nb::implicitly_convertible<nb::dict, TextureLoader::Options>();
 
@@ -263,10 +263,37 @@ def test_load_texture_from_dds_file(device_type: sgl.DeviceType, filename: str):
 
 
 @pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
-def test_load_textures(device_type: sgl.DeviceType):
+@pytest.mark.parametrize("max_in_flight_bytes", [0, 1, 1 << 20])
+def test_load_textures(device_type: sgl.DeviceType, max_in_flight_bytes: int):
     device = helpers.get_device(type=device_type)
 
+    paths = [TEST_DDS_DIR / filename for filename in TEST_DDS_FILES] + [
+        TEST_IMAGE_DIR / filename for filename in TEST_BITMAP_FILES
+    ]
+
+    progress = []
     loader = TextureLoader(device)
+    textures = loader.load_textures(
+        paths,
+        options={
+            "max_in_flight_bytes": max_in_flight_bytes,
+            "progress_callback": lambda completed, total: progress.append(
+                (completed, total)
+            ),
+        },
+    )
+
+    assert len(textures) == len(paths)
+    assert progress == [(i + 1, len(paths)) for i in range(len(paths))]
+
+    # Textures are returned in input order, regardless of completion order.
+    for path, texture in zip(paths, textures):
+        ref = loader.load_texture(path)
+        assert texture.format == ref.format
+        assert texture.width == ref.width
+        assert texture.height == ref.height
+        assert texture.mip_count == ref.mip_count
+        assert np.all(texture.to_numpy() == ref.to_numpy())
 
 
 @pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
@@ -14,7 +14,13 @@
 #include "sgl/core/timer.h"
 #include "sgl/core/thread.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
 #include <map>
+#include <mutex>
 
 namespace sgl {
 
@@ -26,6 +32,16 @@ struct SourceImage {
     ref<Bitmap> bitmap;
     ref<DDSFile> dds_file;
     Format format{Format::unknown};
+
+    /// Size of the image data in bytes.
+    size_t size() const
+    {
+        if (bitmap)
+            return bitmap->buffer_size();
+        if (dds_file)
+            return dds_file->size();
+        return 0;
+    }
 };
 
 /**
@@ -181,7 +197,8 @@ inline SourceImage load_source_image(const std::filesystem::path& path)
     SourceImage source_image;
     FileStream stream(path, FileStream::Mode::read);
     if (DDSFile::detect_dds_file(&stream)) {
-        source_image.dds_file = ref(new DDSFile(&stream));
+        // Memory map DDS files, texture data is uploaded directly from the mapping.
+        source_image.dds_file = ref(new DDSFile(path));
         source_image.format = get_format(DXGI_FORMAT(source_image.dds_file->dxgi_format()));
     } else if (Bitmap::detect_file_format(&stream) != Bitmap::FileFormat::unknown) {
         source_image.bitmap = ref(new Bitmap(&stream));
@@ -255,24 +272,157 @@ inline ref<Texture> create_texture(
 }
 
 
+
+/**
+ * \brief Loads source images on the global thread pool and hands them out in order of completion.
+ *
+ * Loading tasks are only started while fewer tasks than threads in the pool are running and the
+ * total size of loaded images that have not been taken yet is below the in-flight limit.
+ * This bounds memory usage while keeping the thread pool busy.
+ */
+class SourceImagePipeline {
+public:
+    using LoadFunc = std::function<SourceImage(size_t index)>;
+
+    SourceImagePipeline(size_t count, LoadFunc load, size_t max_in_flight_bytes)
+        : m_count(count)
+        , m_load(std::move(load))
+        , m_max_in_flight_bytes(max_in_flight_bytes > 0 ? max_in_flight_bytes : std::numeric_limits<size_t>::max())
+        , m_max_running(std::max(size_t(thread::global_thread_pool().get_thread_count()), size_t(1)))
+    {
+        std::lock_guard lock(m_mutex);
+        schedule();
+    }
+
+    ~SourceImagePipeline()
+    {
+        // Stop scheduling and wait for running tasks.
+        std::unique_lock lock(m_mutex);
+        m_next = m_count;
+        m_cv.wait(lock, [this]() { return m_running == 0; });
+    }
+
+    /// Wait for the next loaded image. Rethrows exceptions thrown while loading.
+    std::pair<size_t, SourceImage> next()
+    {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !m_completed.empty(); });
+        Item item = std::move(m_completed.front());
+        m_completed.pop_front();
+        m_in_flight_bytes -= item.size;
+        schedule();
+        lock.unlock();
+
+        if (item.exception)
+            std::rethrow_exception(item.exception);
+        return {item.index, std::move(item.image)};
+    }
+
+private:
+    struct Item {
+        size_t index;
+        SourceImage image;
+        size_t size{0};
+        std::exception_ptr exception;
+    };
+
+    /// Start new loading tasks. Requires \c m_mutex to be locked.
+    void schedule()
+    {
+        while (m_next < m_count && m_running < m_max_running && m_in_flight_bytes < m_max_in_flight_bytes) {
+            size_t index = m_next++;
+            m_running++;
+            thread::global_thread_pool().push_task([this, index]() { run(index); });
+        }
+    }
+
+    void run(size_t index)
+    {
+        Item item{.index = index};
+        try {
+            item.image = m_load(index);
+            item.size = item.image.size();
+        } catch (...) {
+            item.exception = std::current_exception();
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_in_flight_bytes += item.size;
+        m_completed.push_back(std::move(item));
+        m_running--;
+        schedule();
+        m_cv.notify_all();
+    }
+
+    size_t m_count;
+    LoadFunc m_load;
+    size_t m_max_in_flight_bytes;
+    size_t m_max_running;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Item> m_completed;
+    size_t m_next{0};
+    size_t m_running{0};
+    size_t m_in_flight_bytes{0};
+};
+
+/// Batches texture uploads into command buffer submissions.
+class UploadBatch {
+public:
+    UploadBatch(Device* device, const TextureLoader::Options& options)
+        : m_device(device)
+        , m_max_bytes(options.max_in_flight_bytes)
+    {
+        m_command_buffer = m_device->create_command_buffer();
+    }
+
+    CommandBuffer* command_buffer() const { return m_command_buffer; }
+
+    /// Account for an upload and submit the batch if it is full.
+    void add(size_t size)
+    {
+        m_count++;
+        m_bytes += size;
+        if (m_count >= BATCH_SIZE || (m_max_bytes > 0 && m_bytes >= m_max_bytes)) {
+            m_command_buffer->submit();
+            m_device->run_garbage_collection();
+            m_command_buffer->open();
+            m_count = 0;
+            m_bytes = 0;
+        }
+    }
+
+    void submit() { m_command_buffer->submit(); }
+
+private:
+    Device* m_device;
+    size_t m_max_bytes;
+    ref<CommandBuffer> m_command_buffer;
+    size_t m_count{0};
+    size_t m_bytes{0};
+};
+
 inline std::vector<ref<Texture>> create_textures(
     Device* device,
     Blitter* blitter,
-    std::span<std::future<SourceImage>> source_images,
+    size_t count,
+    const SourceImagePipeline::LoadFunc& load,
     const TextureLoader::Options& options
 )
 {
-    std::vector<ref<Texture>> textures(source_images.size());
-    ref<CommandBuffer> command_buffer = device->create_command_buffer();
-    for (size_t i = 0; i < source_images.size(); ++i) {
-        textures[i] = create_texture(device, blitter, command_buffer, source_images[i].get(), options);
-        if (i && (i % BATCH_SIZE == 0)) {
-            command_buffer->submit();
-            device->run_garbage_collection();
-            command_buffer->open();
-        }
+    std::vector<ref<Texture>> textures(count);
+    SourceImagePipeline pipeline(count, load, options.max_in_flight_bytes);
+    UploadBatch batch(device, options);
+    for (size_t i = 0; i < count; ++i) {
+        auto [index, source_image] = pipeline.next();
+        size_t size = source_image.size();
+        textures[index] = create_texture(device, blitter, batch.command_buffer(), std::move(source_image), options);
+        batch.add(size);
+        if (options.progress_callback)
+            options.progress_callback(i + 1, count);
     }
-    command_buffer->submit();
+    batch.submit();
 
     return textures;
 }
@@ -280,11 +430,12 @@ inline std::vector<ref<Texture>> create_textures(
 inline ref<Texture> create_texture_array(
     Device* device,
     Blitter* blitter,
-    std::span<std::future<SourceImage>> source_images,
+    size_t count,
+    const SourceImagePipeline::LoadFunc& load,
     const TextureLoader::Options& options
 )
 {
-    SGL_ASSERT(source_images.size() > 0);
+    SGL_ASSERT(count > 0);
 
     bool allocate_mips = options.allocate_mips || options.generate_mips;
 
@@ -297,20 +448,22 @@ inline ref<Texture> create_texture_array(
     uint32_t first_height = 0;
     Format first_format = Format::unknown;
 
-    ref<CommandBuffer> command_buffer = device->create_command_buffer();
+    SourceImagePipeline pipeline(count, load, options.max_in_flight_bytes);
+    UploadBatch batch(device, options);
 
-    for (size_t i = 0; i < source_images.size(); ++i) {
-        SourceImage source_image = source_images[i].get();
+    for (size_t i = 0; i < count; ++i) {
+        auto [index, source_image] = pipeline.next();
         const Bitmap* bitmap = source_image.bitmap;
         if (!bitmap)
             SGL_THROW("Texture array requires all source images to be bitmaps");
 
-        if (i == 0) {
+        // Images complete out of order, the first one determines the texture layout.
+        if (!texture) {
             texture = device->create_texture({
                 .format = source_image.format,
                 .width = bitmap->width(),
                 .height = bitmap->height(),
-                .array_size = narrow_cast<uint32_t>(source_images.size()),
+                .array_size = narrow_cast<uint32_t>(count),
                 .mip_count = allocate_mips ? 0u : 1u,
                 .usage = usage,
             });
@@ -323,24 +476,22 @@ inline ref<Texture> create_texture_array(
                 SGL_THROW("Texture array requires all bitmaps to have the same dimensions and format");
         }
 
-        if (i && (i % BATCH_SIZE == 0)) {
-            command_buffer->submit();
-            device->run_garbage_collection();
-            command_buffer->open();
-        }
-
-        uint32_t subresource = texture->get_subresource_index(0, narrow_cast<uint32_t>(i));
+        uint32_t subresource = texture->get_subresource_index(0, narrow_cast<uint32_t>(index));
         SubresourceData subresource_data{
             .data = bitmap->data(),
             .size = bitmap->buffer_size(),
             .row_pitch = bitmap->width() * bitmap->bytes_per_pixel(),
         };
-        command_buffer->upload_texture_data(texture, subresource, subresource_data);
+        batch.command_buffer()->upload_texture_data(texture, subresource, subresource_data);
 
         if (options.generate_mips)
-            blitter->generate_mips(command_buffer, texture, narrow_cast<uint32_t>(i));
+            blitter->generate_mips(batch.command_buffer(), texture, narrow_cast<uint32_t>(index));
+
+        batch.add(bitmap->buffer_size());
+        if (options.progress_callback)
+            options.progress_callback(i + 1, count);
     }
-    command_buffer->submit();
+    batch.submit();
 
     if (options.generate_mips)
         texture->invalidate_views();
@@ -384,12 +535,9 @@ TextureLoader::load_textures(std::span<const Bitmap*> bitmaps, std::optional<Opt
     Options options = options_.value_or(Options{});
 
     // Convert bitmaps in parallel.
-    std::vector<std::future<SourceImage>> source_images;
-    source_images.reserve(bitmaps.size());
-    for (const auto& bitmap : bitmaps)
-        source_images.push_back(thread::do_async(convert_bitmap, ref(const_cast<Bitmap*>(bitmap)), options));
+    auto load = [&](size_t index) { return convert_bitmap(ref(const_cast<Bitmap*>(bitmaps[index])), options); };
 
-    return create_textures(m_device, m_blitter, source_images, options);
+    return create_textures(m_device, m_blitter, bitmaps.size(), load, options);
 }
 
 std::vector<ref<Texture>>
@@ -398,12 +546,9 @@ TextureLoader::load_textures(std::span<std::filesystem::path> paths, std::option
     Options options = options_.value_or(Options{});
 
     // Load & convert source images in parallel.
-    std::vector<std::future<SourceImage>> source_images;
-    source_images.reserve(paths.size());
-    for (const auto& path : paths)
-        source_images.push_back(thread::do_async(load_and_convert_source_image, path, options));
+    auto load = [&](size_t index) { return load_and_convert_source_image(paths[index], options); };
 
-    return create_textures(m_device, m_blitter, source_images, options);
+    return create_textures(m_device, m_blitter, paths.size(), load, options);
 }
 
 ref<Texture> TextureLoader::load_texture_array(std::span<const Bitmap*> bitmaps, std::optional<Options> options_)
@@ -414,12 +559,9 @@ ref<Texture> TextureLoader::load_texture_array(std::span<const Bitmap*> bitmaps,
     Options options = options_.value_or(Options{});
 
     // Convert bitmaps in parallel.
-    std::vector<std::future<SourceImage>> source_images;
-    source_images.reserve(bitmaps.size());
-    for (const auto& bitmap : bitmaps)
-        source_images.push_back(thread::do_async(convert_bitmap, ref(const_cast<Bitmap*>(bitmap)), options));
+    auto load = [&](size_t index) { return convert_bitmap(ref(const_cast<Bitmap*>(bitmaps[index])), options); };
 
-    return create_texture_array(m_device, m_blitter, source_images, options);
+    return create_texture_array(m_device, m_blitter, bitmaps.size(), load, options);
 }
 
 ref<Texture> TextureLoader::load_texture_array(std::span<std::filesystem::path> paths, std::optional<Options> options_)
@@ -430,12 +572,9 @@ ref<Texture> TextureLoader::load_texture_array(std::span<std::filesystem::path>
     Options options = options_.value_or(Options{});
 
     // Load & convert source images in parallel.
-    std::vector<std::future<SourceImage>> source_images;
-    source_images.reserve(paths.size());
-    for (const auto& path : paths)
-        source_images.push_back(thread::do_async(load_and_convert_source_image, path, options));
+    auto load = [&](size_t index) { return load_and_convert_source_image(paths[index], options); };
 
-    return create_texture_array(m_device, m_blitter, source_images, options);
+    return create_texture_array(m_device, m_blitter, paths.size(), load, options);
 }
 
 } // namespace sgl
@@ -9,6 +9,7 @@
 #include "sgl/core/object.h"
 
 #include <filesystem>
+#include <functional>
 
 namespace sgl {
 
@@ -21,6 +22,9 @@ public:
     TextureLoader(ref<Device> device);
     ~TextureLoader();
 
+    /// Callback reporting the number of created textures and the total number of textures.
+    using ProgressCallback = std::function<void(size_t completed, size_t total)>;
+
     struct SGL_API Options {
         /// Load 8/16-bit integer data as normalized resource format.
         bool load_as_normalized{true};
@@ -35,6 +39,12 @@ public:
         /// Resource usage flags for the texture.
         /// \c ResourceUsage::render_target will be added automatically if \c generate_mips is true.
         ResourceUsage usage{ResourceUsage::shader_resource};
+        /// Maximum number of bytes of loaded source images kept in memory when loading multiple textures.
+        /// Loading is throttled when the limit is reached, upload data is submitted in batches of at most this size.
+        /// Set to 0 for no limit.
+        size_t max_in_flight_bytes{size_t(1) << 30};
+        /// Callback invoked on the calling thread after each texture is created when loading multiple textures.
+        ProgressCallback progress_callback;
 
         Options();
     };
@@ -60,6 +70,8 @@ public:
     /**
      * \brief Load textures from a list of bitmaps.
      *
+     * Bitmaps are converted on the global thread pool and uploaded in order of completion.
+     *
      * \param bitmaps Bitmaps to load.
      * \param options Texture loading options.
      * \return List of new of texture objects.
@@ -69,6 +81,9 @@ public:
     /**
      * \brief Load textures from a list of image files.
      *
+     * Images are loaded and converted on the global thread pool and uploaded in order of completion,
+     * keeping at most \c Options::max_in_flight_bytes of loaded images in memory.
+     *
      * \param paths Image file paths.
      * \param options Texture loading options.
      * \return List of new texture objects.